@@ -59,7 +59,7 @@ DEFINE_double(rel_res_goal, 1e-6, "The relative residual goal of the solver");
 
 DEFINE_string(solvers, "cg",
               "A comma-separated list of solvers to run."
-              "Supported values are: bicgstab, cg, cgs, fcg, gmres");
+              "Supported values are: bicgstab, cg, cgs, fcg, gmres, pipe_cg");
 
 DEFINE_string(preconditioners, "none",
               "A comma-separated list of preconditioners to use."
@@ -119,7 +119,8 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOpFactory>(
                    {"cg", create_solver<gko::solver::Cg<>>},
                    {"cgs", create_solver<gko::solver::Cgs<>>},
                    {"fcg", create_solver<gko::solver::Fcg<>>},
-                   {"gmres", create_solver<gko::solver::Gmres<>>}};
+                   {"gmres", create_solver<gko::solver::Gmres<>>},
+                   {"pipe_cg", create_solver<gko::solver::PipeCg<>>}};
 
 
 // TODO: Workaround until GPU matrix conversions are implemented
@@ -0,0 +1,601 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/base/binary_io.hpp>
+
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+
+
+#include <ginkgo/config.hpp>
+
+
+#ifdef GKO_HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // GKO_HAVE_SYS_MMAN_H
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace {
+
+
+constexpr char binary_magic[8] = {'G', 'K', 'O', 'B', 'I', 'N', 'A', 'R'};
+constexpr size_type binary_alignment = 64;
+
+
+enum class binary_format : uint32 { dense = 1, coo = 2, csr = 3 };
+
+
+/**
+ * The header at the start of each binary file.
+ */
+struct binary_header {
+    char magic[8];
+    uint32 version;
+    uint32 format;
+    uint32 value_type;
+    uint32 index_type;
+    uint64 num_rows;
+    uint64 num_cols;
+    uint64 num_stored_elements;
+    uint64 reserved[2];
+};
+
+static_assert(sizeof(binary_header) == binary_alignment,
+              "the binary header has to fill exactly one aligned block");
+
+
+// the tag 0 is used for the index type of formats without indexes
+template <typename T>
+struct type_tag;
+
+template <>
+struct type_tag<float> : std::integral_constant<uint32, 1> {};
+
+template <>
+struct type_tag<double> : std::integral_constant<uint32, 2> {};
+
+template <>
+struct type_tag<std::complex<float>> : std::integral_constant<uint32, 3> {};
+
+template <>
+struct type_tag<std::complex<double>> : std::integral_constant<uint32, 4> {};
+
+template <>
+struct type_tag<int32> : std::integral_constant<uint32, 5> {};
+
+template <>
+struct type_tag<int64> : std::integral_constant<uint32, 6> {};
+
+
+size_type get_type_size(uint32 tag)
+{
+    switch (tag) {
+    case type_tag<float>::value:
+    case type_tag<int32>::value:
+        return 4;
+    case type_tag<double>::value:
+    case type_tag<std::complex<float>>::value:
+    case type_tag<int64>::value:
+        return 8;
+    case type_tag<std::complex<double>>::value:
+        return 16;
+    default:
+        throw GKO_STREAM_ERROR("unknown type tag in the binary header");
+    }
+}
+
+
+size_type align_offset(size_type offset)
+{
+    return (offset + binary_alignment - 1) / binary_alignment *
+           binary_alignment;
+}
+
+
+/**
+ * Returns the number of elements and the element sizes of the arrays stored
+ * after the header, in the order they appear in the file.
+ */
+std::vector<std::pair<size_type, size_type>> get_array_layout(
+    const binary_header &header)
+{
+    const auto value_size = get_type_size(header.value_type);
+    const auto nnz = static_cast<size_type>(header.num_stored_elements);
+    switch (static_cast<binary_format>(header.format)) {
+    case binary_format::dense:
+        return {{nnz, value_size}};
+    case binary_format::coo: {
+        const auto index_size = get_type_size(header.index_type);
+        return {{nnz, index_size}, {nnz, index_size}, {nnz, value_size}};
+    }
+    case binary_format::csr: {
+        const auto index_size = get_type_size(header.index_type);
+        return {{static_cast<size_type>(header.num_rows) + 1, index_size},
+                {nnz, index_size},
+                {nnz, value_size}};
+    }
+    default:
+        throw GKO_STREAM_ERROR("unknown storage format in the binary header");
+    }
+}
+
+
+size_type get_binary_size(const binary_header &header)
+{
+    size_type size = sizeof(binary_header);
+    for (const auto &array : get_array_layout(header)) {
+        size = align_offset(size) + array.first * array.second;
+    }
+    return size;
+}
+
+
+void check_header(const binary_header &header)
+{
+    if (!std::equal(std::begin(binary_magic), std::end(binary_magic),
+                    std::begin(header.magic))) {
+        throw GKO_STREAM_ERROR("the data is not stored in the binary format");
+    }
+    if (header.version != binary_format_version) {
+        throw GKO_STREAM_ERROR("unsupported binary format version " +
+                               std::to_string(header.version));
+    }
+}
+
+
+/**
+ * A contiguous chunk of host memory holding the contents of a binary file.
+ * The arrays read from it keep it alive as long as they use it.
+ */
+class binary_storage {
+public:
+    virtual ~binary_storage() = default;
+
+    char *get_data() const noexcept { return data_; }
+
+    size_type get_size() const noexcept { return size_; }
+
+protected:
+    char *data_{};
+    size_type size_{};
+};
+
+
+/**
+ * Stores the data read from a stream in a buffer allocated on the heap.
+ */
+class buffer_storage : public binary_storage {
+public:
+    explicit buffer_storage(std::istream &is)
+    {
+        binary_header header{};
+        if (!is.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+            throw GKO_STREAM_ERROR("error when reading the binary header");
+        }
+        check_header(header);
+        size_ = get_binary_size(header);
+        // allocate 64 bit words to keep all stored types aligned
+        buffer_.reset(new uint64[ceildiv(size_, sizeof(uint64))]);
+        data_ = reinterpret_cast<char *>(buffer_.get());
+        std::memcpy(data_, &header, sizeof(header));
+        if (!is.read(data_ + sizeof(header), size_ - sizeof(header))) {
+            throw GKO_STREAM_ERROR("error when reading the binary data");
+        }
+    }
+
+private:
+    std::unique_ptr<uint64[]> buffer_;
+};
+
+
+#ifdef GKO_HAVE_SYS_MMAN_H
+
+
+/**
+ * Maps a file privately into memory. Writes to the mapped memory do not
+ * change the file.
+ */
+class mapped_storage : public binary_storage {
+public:
+    explicit mapped_storage(const std::string &filename)
+    {
+        const auto fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw GKO_STREAM_ERROR("error opening the file " + filename);
+        }
+        struct stat file_stat {};
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            throw GKO_STREAM_ERROR("error reading the size of " + filename);
+        }
+        size_ = static_cast<size_type>(file_stat.st_size);
+        if (size_ < sizeof(binary_header)) {
+            close(fd);
+            throw GKO_STREAM_ERROR("error when reading the binary header");
+        }
+        auto ptr = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                        fd, 0);
+        close(fd);
+        if (ptr == MAP_FAILED) {
+            throw GKO_STREAM_ERROR("error mapping the file " + filename);
+        }
+        data_ = static_cast<char *>(ptr);
+    }
+
+    ~mapped_storage() override { munmap(data_, size_); }
+};
+
+
+std::shared_ptr<binary_storage> open_binary_file(const std::string &filename)
+{
+    return std::make_shared<mapped_storage>(filename);
+}
+
+
+#else  // !GKO_HAVE_SYS_MMAN_H
+
+
+std::shared_ptr<binary_storage> open_binary_file(const std::string &filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        throw GKO_STREAM_ERROR("error opening the file " + filename);
+    }
+    return std::make_shared<buffer_storage>(is);
+}
+
+
+#endif  // GKO_HAVE_SYS_MMAN_H
+
+
+/**
+ * Creates arrays on top of a binary_storage.
+ */
+class binary_reader {
+public:
+    explicit binary_reader(std::shared_ptr<binary_storage> storage)
+        : storage_{std::move(storage)}, offset_{sizeof(binary_header)}
+    {
+        std::memcpy(&header_, storage_->get_data(), sizeof(header_));
+        check_header(header_);
+        if (get_binary_size(header_) > storage_->get_size()) {
+            throw GKO_STREAM_ERROR("the binary data is truncated");
+        }
+    }
+
+    dim<2> get_size() const
+    {
+        return dim<2>{static_cast<size_type>(header_.num_rows),
+                      static_cast<size_type>(header_.num_cols)};
+    }
+
+    size_type get_num_stored_elements() const
+    {
+        return static_cast<size_type>(header_.num_stored_elements);
+    }
+
+    void check_types(binary_format format, uint32 value_type,
+                     uint32 index_type) const
+    {
+        if (header_.format != static_cast<uint32>(format)) {
+            throw GKO_STREAM_ERROR(
+                "the storage format in the binary header does not match the "
+                "matrix type");
+        }
+        if (header_.value_type != value_type) {
+            throw GKO_STREAM_ERROR(
+                "the value type in the binary header does not match the "
+                "matrix type");
+        }
+        if (header_.index_type != index_type) {
+            throw GKO_STREAM_ERROR(
+                "the index type in the binary header does not match the "
+                "matrix type");
+        }
+    }
+
+    /**
+     * Returns the next array stored in the binary data. It is created on the
+     * host without copying and keeps the storage alive.
+     */
+    template <typename T>
+    Array<T> read_array(std::shared_ptr<const Executor> exec, size_type count)
+    {
+        offset_ = align_offset(offset_);
+        auto data = reinterpret_cast<T *>(storage_->get_data() + offset_);
+        offset_ += count * sizeof(T);
+        if (count == 0) {
+            return Array<T>{exec};
+        }
+        auto storage = storage_;
+        return Array<T>{exec, count, data, [storage](T *) {}};
+    }
+
+private:
+    std::shared_ptr<binary_storage> storage_;
+    binary_header header_;
+    size_type offset_;
+};
+
+
+/**
+ * Writes the header and the padded arrays of the binary format.
+ */
+class binary_writer {
+public:
+    binary_writer(std::ostream &os, binary_format format, uint32 value_type,
+                  uint32 index_type, const dim<2> &size,
+                  size_type num_stored_elements)
+        : os_(os), offset_{}
+    {
+        binary_header header{};
+        std::copy(std::begin(binary_magic), std::end(binary_magic),
+                  std::begin(header.magic));
+        header.version = binary_format_version;
+        header.format = static_cast<uint32>(format);
+        header.value_type = value_type;
+        header.index_type = index_type;
+        header.num_rows = size[0];
+        header.num_cols = size[1];
+        header.num_stored_elements = num_stored_elements;
+        this->write(&header, 1);
+    }
+
+    // pads the output to the start of the next array
+    void begin_array()
+    {
+        const char padding[binary_alignment]{};
+        const auto aligned = align_offset(offset_);
+        if (!os_.write(padding, aligned - offset_)) {
+            throw GKO_STREAM_ERROR("error when writing the binary data");
+        }
+        offset_ = aligned;
+    }
+
+    template <typename T>
+    void write(const T *data, size_type count)
+    {
+        if (!os_.write(reinterpret_cast<const char *>(data),
+                       count * sizeof(T))) {
+            throw GKO_STREAM_ERROR("error when writing the binary data");
+        }
+        offset_ += count * sizeof(T);
+    }
+
+    template <typename T>
+    void write_array(const Array<T> &array)
+    {
+        this->begin_array();
+        this->write(array.get_const_data(), array.get_num_elems());
+    }
+
+private:
+    std::ostream &os_;
+    size_type offset_;
+};
+
+
+/**
+ * The binary_io class provides reading and writing for a specific matrix
+ * format.
+ */
+template <typename MatrixType>
+struct binary_io;
+
+
+template <typename ValueType>
+struct binary_io<matrix::Dense<ValueType>> {
+    using matrix_type = matrix::Dense<ValueType>;
+
+    static std::unique_ptr<matrix_type> read(
+        binary_reader &reader, std::shared_ptr<const Executor> exec)
+    {
+        reader.check_types(binary_format::dense, type_tag<ValueType>::value,
+                           0);
+        const auto size = reader.get_size();
+        if (reader.get_num_stored_elements() != size[0] * size[1]) {
+            throw GKO_STREAM_ERROR(
+                "the number of stored elements does not match the size of "
+                "the dense matrix");
+        }
+        if (size[0] * size[1] == 0) {
+            return matrix_type::create(exec, size);
+        }
+        auto values = reader.template read_array<ValueType>(exec->get_master(),
+                                                            size[0] * size[1]);
+        return matrix_type::create(exec, size, std::move(values), size[1]);
+    }
+
+    static void write(std::ostream &os, const matrix_type *matrix)
+    {
+        const auto size = matrix->get_size();
+        binary_writer writer(os, binary_format::dense,
+                             type_tag<ValueType>::value, 0, size,
+                             size[0] * size[1]);
+        writer.begin_array();
+        for (size_type row = 0; row < size[0]; ++row) {
+            writer.write(matrix->get_const_values() +
+                             row * matrix->get_stride(),
+                         size[1]);
+        }
+    }
+};
+
+
+template <typename ValueType, typename IndexType>
+struct binary_io<matrix::Coo<ValueType, IndexType>> {
+    using matrix_type = matrix::Coo<ValueType, IndexType>;
+
+    static std::unique_ptr<matrix_type> read(
+        binary_reader &reader, std::shared_ptr<const Executor> exec)
+    {
+        reader.check_types(binary_format::coo, type_tag<ValueType>::value,
+                           type_tag<IndexType>::value);
+        const auto master = exec->get_master();
+        const auto nnz = reader.get_num_stored_elements();
+        auto row_idxs = reader.template read_array<IndexType>(master, nnz);
+        auto col_idxs = reader.template read_array<IndexType>(master, nnz);
+        auto values = reader.template read_array<ValueType>(master, nnz);
+        return matrix_type::create(exec, reader.get_size(), std::move(values),
+                                   std::move(col_idxs), std::move(row_idxs));
+    }
+
+    static void write(std::ostream &os, const matrix_type *matrix)
+    {
+        binary_writer writer(os, binary_format::coo,
+                             type_tag<ValueType>::value,
+                             type_tag<IndexType>::value, matrix->get_size(),
+                             matrix->get_num_stored_elements());
+        const auto nnz = matrix->get_num_stored_elements();
+        writer.begin_array();
+        writer.write(matrix->get_const_row_idxs(), nnz);
+        writer.begin_array();
+        writer.write(matrix->get_const_col_idxs(), nnz);
+        writer.begin_array();
+        writer.write(matrix->get_const_values(), nnz);
+    }
+};
+
+
+template <typename ValueType, typename IndexType>
+struct binary_io<matrix::Csr<ValueType, IndexType>> {
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+
+    static std::unique_ptr<matrix_type> read(
+        binary_reader &reader, std::shared_ptr<const Executor> exec)
+    {
+        reader.check_types(binary_format::csr, type_tag<ValueType>::value,
+                           type_tag<IndexType>::value);
+        const auto master = exec->get_master();
+        const auto size = reader.get_size();
+        const auto nnz = reader.get_num_stored_elements();
+        auto row_ptrs = reader.template read_array<IndexType>(master,
+                                                              size[0] + 1);
+        if (static_cast<size_type>(row_ptrs.get_const_data()[size[0]]) !=
+            nnz) {
+            throw GKO_STREAM_ERROR(
+                "the row pointers do not match the number of stored "
+                "elements");
+        }
+        auto col_idxs = reader.template read_array<IndexType>(master, nnz);
+        auto values = reader.template read_array<ValueType>(master, nnz);
+        return matrix_type::create(exec, size, std::move(values),
+                                   std::move(col_idxs), std::move(row_ptrs));
+    }
+
+    static void write(std::ostream &os, const matrix_type *matrix)
+    {
+        binary_writer writer(os, binary_format::csr,
+                             type_tag<ValueType>::value,
+                             type_tag<IndexType>::value, matrix->get_size(),
+                             matrix->get_num_stored_elements());
+        const auto nnz = matrix->get_num_stored_elements();
+        writer.begin_array();
+        writer.write(matrix->get_const_row_ptrs(), matrix->get_size()[0] + 1);
+        writer.begin_array();
+        writer.write(matrix->get_const_col_idxs(), nnz);
+        writer.begin_array();
+        writer.write(matrix->get_const_values(), nnz);
+    }
+};
+
+
+}  // namespace
+
+
+template <typename MatrixType>
+std::unique_ptr<MatrixType> read_binary(std::istream &is,
+                                        std::shared_ptr<const Executor> exec)
+{
+    binary_reader reader{std::make_shared<buffer_storage>(is)};
+    return binary_io<MatrixType>::read(reader, std::move(exec));
+}
+
+
+template <typename MatrixType>
+std::unique_ptr<MatrixType> read_binary(const std::string &filename,
+                                        std::shared_ptr<const Executor> exec)
+{
+    binary_reader reader{open_binary_file(filename)};
+    return binary_io<MatrixType>::read(reader, std::move(exec));
+}
+
+
+template <typename MatrixType>
+void write_binary(std::ostream &os, const MatrixType *matrix)
+{
+    const auto master = matrix->get_executor()->get_master();
+    std::unique_ptr<MatrixType> host_matrix;
+    if (matrix->get_executor() != master) {
+        host_matrix = clone(master, matrix);
+        matrix = host_matrix.get();
+    }
+    binary_io<MatrixType>::write(os, matrix);
+}
+
+
+#define GKO_DECLARE_BINARY_IO(...)                                           \
+    std::unique_ptr<__VA_ARGS__> read_binary<__VA_ARGS__>(                   \
+        std::istream & is, std::shared_ptr<const Executor> exec);            \
+    template std::unique_ptr<__VA_ARGS__> read_binary<__VA_ARGS__>(          \
+        const std::string &filename, std::shared_ptr<const Executor> exec); \
+    template void write_binary<__VA_ARGS__>(std::ostream & os,               \
+                                            const __VA_ARGS__ *matrix)
+#define GKO_DECLARE_BINARY_IO_DENSE(ValueType) \
+    GKO_DECLARE_BINARY_IO(matrix::Dense<ValueType>)
+#define GKO_DECLARE_BINARY_IO_COO(ValueType, IndexType) \
+    GKO_DECLARE_BINARY_IO(matrix::Coo<ValueType, IndexType>)
+#define GKO_DECLARE_BINARY_IO_CSR(ValueType, IndexType) \
+    GKO_DECLARE_BINARY_IO(matrix::Csr<ValueType, IndexType>)
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BINARY_IO_DENSE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BINARY_IO_COO);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BINARY_IO_CSR);
+
+
+}  // namespace gko
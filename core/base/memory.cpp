@@ -0,0 +1,259 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <algorithm>
+#include <cstdlib>
+
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#include <malloc.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+
+
+constexpr size_type AlignedCpuAllocator::cache_line_alignment;
+constexpr size_type AlignedCpuAllocator::huge_page_alignment;
+constexpr size_type PooledCpuAllocator::default_min_block_size;
+constexpr size_type PooledCpuAllocator::default_max_block_size;
+constexpr size_type PooledCpuAllocator::default_max_cached_bytes;
+
+
+namespace {
+
+
+bool is_power_of_two(size_type value) noexcept
+{
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+
+}  // namespace
+
+
+AlignedCpuAllocator::AlignedCpuAllocator(size_type alignment)
+    : alignment_{alignment}
+{
+    if (!is_power_of_two(alignment_)) {
+        GKO_NOT_SUPPORTED(*this);
+    }
+}
+
+
+void *AlignedCpuAllocator::allocate(const Executor *, size_type num_bytes)
+{
+    // small blocks would waste most of a huge page, so they only get aligned
+    // to cache lines
+    auto alignment = alignment_;
+    if (alignment > cache_line_alignment && num_bytes < alignment) {
+        alignment = cache_line_alignment;
+    }
+    alignment = std::max<size_type>(alignment, sizeof(void *));
+#if defined(_WIN32) || defined(__CYGWIN__)
+    return _aligned_malloc(num_bytes, alignment);
+#else
+    void *ptr{};
+    if (posix_memalign(&ptr, alignment, num_bytes) != 0) {
+        return nullptr;
+    }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alignment >= huge_page_alignment) {
+        // only a hint, the block stays usable if the kernel refuses
+        madvise(ptr, num_bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+#endif
+}
+
+
+void AlignedCpuAllocator::deallocate(const Executor *, void *ptr) noexcept
+{
+#if defined(_WIN32) || defined(__CYGWIN__)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+
+PooledCpuAllocator::PooledCpuAllocator(std::shared_ptr<Allocator> upstream,
+                                       size_type max_cached_bytes,
+                                       size_type min_block_size,
+                                       size_type max_block_size)
+    : upstream_{std::move(upstream)},
+      max_cached_bytes_{max_cached_bytes},
+      min_block_size_{min_block_size},
+      max_block_size_{max_block_size},
+      cached_bytes_{},
+      num_hits_{},
+      num_misses_{}
+{
+    if (!is_power_of_two(min_block_size_)) {
+        GKO_NOT_SUPPORTED(*this);
+    }
+}
+
+
+PooledCpuAllocator::~PooledCpuAllocator()
+{
+    this->release();
+    // blocks still in use at this point are leaked by the user, but they
+    // still need to go back to the upstream allocator
+    for (const auto &block : used_blocks_) {
+        upstream_->deallocate(nullptr, block.first);
+    }
+}
+
+
+size_type PooledCpuAllocator::get_block_size(size_type num_bytes) const
+    noexcept
+{
+    auto block_size = min_block_size_;
+    while (block_size < num_bytes && block_size <= max_block_size_ / 2) {
+        block_size *= 2;
+    }
+    // requests exceeding the largest size class are not rounded up
+    return block_size < num_bytes ? num_bytes : block_size;
+}
+
+
+void *PooledCpuAllocator::allocate(const Executor *exec, size_type num_bytes)
+{
+    const auto block_size = this->get_block_size(num_bytes);
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = free_blocks_.find(block_size);
+    if (it != free_blocks_.end() && !it->second.empty()) {
+        // a hit does not obtain any memory from the upstream allocator
+        this->template log<log::Logger::allocation_started>(exec,
+                                                            size_type{});
+        auto ptr = it->second.back();
+        it->second.pop_back();
+        cached_bytes_ -= block_size;
+        used_blocks_[ptr] = block_size;
+        ++num_hits_;
+        this->template log<log::Logger::allocation_completed>(
+            exec, block_size, reinterpret_cast<uintptr>(ptr));
+        return ptr;
+    }
+    ++num_misses_;
+    this->template log<log::Logger::allocation_started>(exec, block_size);
+    auto ptr = upstream_->allocate(exec, block_size);
+    this->template log<log::Logger::allocation_completed>(
+        exec, block_size, reinterpret_cast<uintptr>(ptr));
+    if (ptr != nullptr) {
+        used_blocks_[ptr] = block_size;
+    }
+    return ptr;
+}
+
+
+void PooledCpuAllocator::deallocate(const Executor *exec, void *ptr) noexcept
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = used_blocks_.find(ptr);
+    if (it == used_blocks_.end()) {
+        return;
+    }
+    const auto block_size = it->second;
+    used_blocks_.erase(it);
+    if (block_size > max_block_size_ ||
+        cached_bytes_ + block_size > max_cached_bytes_) {
+        this->free_upstream(exec, ptr);
+        return;
+    }
+    try {
+        free_blocks_[block_size].push_back(ptr);
+        cached_bytes_ += block_size;
+    } catch (...) {
+        this->free_upstream(exec, ptr);
+    }
+}
+
+
+void PooledCpuAllocator::release() noexcept
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto &size_class : free_blocks_) {
+        for (auto ptr : size_class.second) {
+            this->free_upstream(nullptr, ptr);
+        }
+    }
+    free_blocks_.clear();
+    cached_bytes_ = 0;
+}
+
+
+void PooledCpuAllocator::free_upstream(const Executor *exec, void *ptr) const
+    noexcept
+{
+    const auto location = reinterpret_cast<uintptr>(ptr);
+    this->template log<log::Logger::free_started>(exec, location);
+    upstream_->deallocate(exec, ptr);
+    this->template log<log::Logger::free_completed>(exec, location);
+}
+
+
+size_type PooledCpuAllocator::get_num_hits() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return num_hits_;
+}
+
+
+size_type PooledCpuAllocator::get_num_misses() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return num_misses_;
+}
+
+
+size_type PooledCpuAllocator::get_cached_bytes() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return cached_bytes_;
+}
+
+
+}  // namespace gko
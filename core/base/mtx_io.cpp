@@ -34,15 +34,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cstdlib>
+#include <exception>
 #include <map>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/iterator_factory.hpp"
 
 
 namespace gko {
@@ -62,6 +74,191 @@ namespace {
     }
 
 
+/**
+ * Runs `fn(thread_id)` on `num_threads` threads and rethrows the first
+ * exception thrown by any of them.
+ */
+template <typename Function>
+void run_in_parallel(size_type num_threads, Function fn)
+{
+    std::vector<std::exception_ptr> errors(num_threads);
+    auto run = [&](size_type thread_id) {
+        try {
+            fn(thread_id);
+        } catch (...) {
+            errors[thread_id] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_type thread_id = 1; thread_id < num_threads; ++thread_id) {
+        threads.emplace_back(run, thread_id);
+    }
+    run(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+
+/**
+ * Reads the remainder of the stream into a string.
+ */
+std::string read_content(std::istream &is)
+{
+    std::string content;
+    const auto begin = is.tellg();
+    if (begin >= 0 && is.seekg(0, std::ios::end)) {
+        const auto end = is.tellg();
+        is.seekg(begin);
+        content.resize(static_cast<size_type>(end - begin));
+        is.read(&content[0], content.size());
+        content.resize(static_cast<size_type>(is.gcount()));
+    } else {
+        // the stream is not seekable
+        is.clear();
+        std::ostringstream content_stream;
+        content_stream << is.rdbuf();
+        content = content_stream.str();
+    }
+    return content;
+}
+
+
+/**
+ * Locale-independent parsers for the entries of a matrix market file. They
+ * return the position after the parsed token, or nullptr if the input does
+ * not start with a valid token.
+ */
+const char *skip_blanks(const char *it, const char *end)
+{
+    while (it != end && (*it == ' ' || *it == '\t' || *it == '\r')) {
+        ++it;
+    }
+    return it;
+}
+
+
+bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+
+const char *parse_index(const char *it, const char *end, int64 &result)
+{
+    it = skip_blanks(it, end);
+    if (it == end || !is_digit(*it)) {
+        return nullptr;
+    }
+    result = 0;
+    for (; it != end && is_digit(*it); ++it) {
+        result = result * 10 + (*it - '0');
+    }
+    return it;
+}
+
+
+const char *parse_real(const char *it, const char *end, double &result)
+{
+    // powers of ten that are exactly representable as double
+    static constexpr double exact_powers[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    it = skip_blanks(it, end);
+    const auto token_begin = it;
+    const bool negative = it != end && *it == '-';
+    if (it != end && (*it == '-' || *it == '+')) {
+        ++it;
+    }
+    uint64 mantissa{};
+    int num_digits{};
+    int exponent{};
+    bool exact = true;
+    bool has_digits = false;
+    auto add_digit = [&](char digit, bool fractional) {
+        has_digits = true;
+        if (mantissa == 0 && digit == '0') {
+            exponent -= fractional;
+        } else if (num_digits < 19) {
+            mantissa = mantissa * 10 + (digit - '0');
+            ++num_digits;
+            exponent -= fractional;
+        } else {
+            exact = exact && digit == '0';
+            exponent += !fractional;
+        }
+    };
+    for (; it != end && is_digit(*it); ++it) {
+        add_digit(*it, false);
+    }
+    if (it != end && *it == '.') {
+        for (++it; it != end && is_digit(*it); ++it) {
+            add_digit(*it, true);
+        }
+    }
+    if (has_digits && it != end && (*it == 'e' || *it == 'E')) {
+        int64 exponent_value{};
+        auto exponent_it = it + 1;
+        const bool negative_exponent =
+            exponent_it != end && *exponent_it == '-';
+        if (exponent_it != end &&
+            (*exponent_it == '-' || *exponent_it == '+')) {
+            ++exponent_it;
+        }
+        if (exponent_it == end || !is_digit(*exponent_it)) {
+            return nullptr;
+        }
+        for (; exponent_it != end && is_digit(*exponent_it); ++exponent_it) {
+            exponent_value = std::min<int64>(exponent_value * 10 +
+                                                 (*exponent_it - '0'),
+                                             100000);
+        }
+        exponent += static_cast<int>(negative_exponent ? -exponent_value
+                                                       : exponent_value);
+        it = exponent_it;
+    }
+    if (has_digits && exact && mantissa < (uint64{1} << 53) &&
+        std::abs(exponent) <= 22) {
+        // both operands are exact, so the result is correctly rounded
+        const auto value = static_cast<double>(mantissa);
+        result = exponent < 0 ? value / exact_powers[-exponent]
+                              : value * exact_powers[exponent];
+        result = negative ? -result : result;
+        return it;
+    }
+    // fall back to the C library for long mantissas, large exponents and
+    // special values like inf and nan
+    while (it != end && !std::isspace(static_cast<unsigned char>(*it))) {
+        ++it;
+    }
+    const std::string token(token_begin, it);
+    char *token_end{};
+    result = std::strtod(token.c_str(), &token_end);
+    if (token.empty() || token_end != token.c_str() + token.size()) {
+        return nullptr;
+    }
+    return it;
+}
+
+
+template <typename ValueType>
+xstd::enable_if_t<is_complex_s<ValueType>::value, ValueType> make_entry(
+    double real, double imag)
+{
+    using real_type = remove_complex<ValueType>;
+    return {static_cast<real_type>(real), static_cast<real_type>(imag)};
+}
+
+template <typename ValueType>
+xstd::enable_if_t<!is_complex_s<ValueType>::value, ValueType> make_entry(
+    double real, double)
+{
+    return static_cast<ValueType>(real);
+}
+
+
 /**
  * The mtx_io class provides the functionality of reading and writing matrix
  * market format files.
@@ -117,6 +314,180 @@ public:
                                          parsed_header.modifier);
     }
 
+    /**
+     * Reads a matrix from a stream directly into a CSR matrix, parsing
+     * coordinate layouts in parallel.
+     *
+     * @param is  the input stream.
+     * @param exec  the executor on which the matrix is created.
+     * @param num_threads  the number of threads used for parsing.
+     *
+     * @return the CSR matrix.
+     */
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr(
+        std::istream &is, std::shared_ptr<const Executor> exec,
+        size_type num_threads) const
+    {
+        using csr_type = matrix::Csr<ValueType, IndexType>;
+        auto parsed_header = this->read_header(is);
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        if (parsed_header.layout != &coordinate_layout) {
+            auto data = parsed_header.layout->read_data(
+                dimensions_stream, is, parsed_header.entry,
+                parsed_header.modifier);
+            data.ensure_row_major_order();
+            auto result = csr_type::create(std::move(exec));
+            result->read(data);
+            return result;
+        }
+        size_type num_rows{};
+        size_type num_cols{};
+        size_type num_nonzeros{};
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        if (parsed_header.entry == &complex_format &&
+            !is_complex<ValueType>()) {
+            throw GKO_STREAM_ERROR(
+                "trying to read a complex matrix into a real storage type");
+        }
+        const auto num_values =
+            parsed_header.entry == &pattern_format
+                ? 0
+                : parsed_header.entry == &complex_format ? 2 : 1;
+        const auto modifier = parsed_header.modifier;
+        if (num_threads == 0) {
+            num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        // parse the byte range of each thread into its own list of entries
+        const auto content = read_content(is);
+        const auto content_end = content.data() + content.size();
+        // with at least one byte per thread, every chunk but the first starts
+        // after the beginning of the content
+        num_threads = std::max<size_type>(
+            std::min<size_type>(num_threads, content.size()), 1);
+        std::vector<const char *> chunk_begins(num_threads + 1, content_end);
+        for (size_type chunk = 0; chunk < num_threads; ++chunk) {
+            auto begin = content.data() + content.size() * chunk / num_threads;
+            if (chunk > 0 && begin[-1] != '\n') {
+                begin = std::find(begin, content_end, '\n');
+                begin += begin != content_end;
+            }
+            chunk_begins[chunk] = begin;
+        }
+        std::vector<std::vector<IndexType>> local_rows(num_threads);
+        std::vector<std::vector<IndexType>> local_cols(num_threads);
+        std::vector<std::vector<ValueType>> local_values(num_threads);
+        std::vector<size_type> local_num_entries(num_threads);
+        run_in_parallel(num_threads, [&](size_type thread_id) {
+            auto &rows = local_rows[thread_id];
+            auto &cols = local_cols[thread_id];
+            auto &values = local_values[thread_id];
+            auto it = chunk_begins[thread_id];
+            const auto end = chunk_begins[thread_id + 1];
+            auto insert = [&](int64 row, int64 col, ValueType value) {
+                rows.push_back(static_cast<IndexType>(row));
+                cols.push_back(static_cast<IndexType>(col));
+                values.push_back(value);
+            };
+            while (it != end) {
+                it = skip_blanks(it, end);
+                if (it != end && *it == '%') {
+                    it = std::find(it, end, '\n');
+                }
+                if (it == end || *it == '\n') {
+                    it += it != end;
+                    continue;
+                }
+                int64 row{};
+                int64 col{};
+                double real{1.0};
+                double imag{};
+                it = parse_index(it, end, row);
+                it = it ? parse_index(it, end, col) : it;
+                if (it && num_values > 0) {
+                    it = parse_real(it, end, real);
+                }
+                if (it && num_values > 1) {
+                    it = parse_real(it, end, imag);
+                }
+                it = it ? skip_blanks(it, end) : it;
+                GKO_CHECK_MATCH((it && (it == end || *it == '\n')),
+                                "error when reading matrix entry");
+                GKO_CHECK_MATCH(
+                    (row >= 1 && row <= static_cast<int64>(num_rows) &&
+                     col >= 1 && col <= static_cast<int64>(num_cols)),
+                    "matrix entry out of bounds");
+                const auto entry = make_entry<ValueType>(real, imag);
+                insert(row - 1, col - 1, entry);
+                if (modifier == &skew_symmetric_modifier) {
+                    insert(col - 1, row - 1, -entry);
+                } else if (row != col && modifier == &symmetric_modifier) {
+                    insert(col - 1, row - 1, entry);
+                } else if (row != col && modifier == &hermitian_modifier) {
+                    insert(col - 1, row - 1, conj(entry));
+                }
+                ++local_num_entries[thread_id];
+            }
+        });
+        size_type num_entries{};
+        for (auto local : local_num_entries) {
+            num_entries += local;
+        }
+        GKO_CHECK_MATCH((num_entries == num_nonzeros),
+                        "expected " + std::to_string(num_nonzeros) +
+                            " matrix entries, found " +
+                            std::to_string(num_entries));
+
+        // build the row pointers from a histogram of the row indexes
+        const auto master = exec->get_master();
+        Array<IndexType> row_ptrs(master, num_rows + 1);
+        std::vector<std::atomic<IndexType>> row_counters(num_rows);
+        run_in_parallel(num_threads, [&](size_type thread_id) {
+            for (auto row : local_rows[thread_id]) {
+                row_counters[row].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        auto row_ptrs_data = row_ptrs.get_data();
+        row_ptrs_data[0] = 0;
+        for (size_type row = 0; row < num_rows; ++row) {
+            row_ptrs_data[row + 1] = row_ptrs_data[row] + row_counters[row];
+            row_counters[row].store(row_ptrs_data[row],
+                                    std::memory_order_relaxed);
+        }
+
+        // scatter the entries into their rows and sort each row
+        const auto nnz = static_cast<size_type>(row_ptrs_data[num_rows]);
+        Array<IndexType> col_idxs(master, nnz);
+        Array<ValueType> values(master, nnz);
+        auto col_idxs_data = col_idxs.get_data();
+        auto values_data = values.get_data();
+        run_in_parallel(num_threads, [&](size_type thread_id) {
+            const auto &rows = local_rows[thread_id];
+            for (size_type i = 0; i < rows.size(); ++i) {
+                const auto nz = row_counters[rows[i]].fetch_add(
+                    1, std::memory_order_relaxed);
+                col_idxs_data[nz] = local_cols[thread_id][i];
+                values_data[nz] = local_values[thread_id][i];
+            }
+        });
+        run_in_parallel(num_threads, [&](size_type thread_id) {
+            const auto row_end = num_rows * (thread_id + 1) / num_threads;
+            for (auto row = num_rows * thread_id / num_threads; row < row_end;
+                 ++row) {
+                const auto begin = row_ptrs_data[row];
+                auto helper = detail::IteratorFactory<IndexType, ValueType>(
+                    col_idxs_data + begin, values_data + begin,
+                    row_ptrs_data[row + 1] - begin);
+                std::sort(helper.begin(), helper.end());
+            }
+        });
+        return csr_type::create(exec, dim<2>{num_rows, num_cols},
+                                std::move(values), std::move(col_idxs),
+                                std::move(row_ptrs));
+    }
+
 private:
     /**
      * entry format hierarchy provides algorithms for reading/writing a single
@@ -759,6 +1130,25 @@ matrix_data<ValueType, IndexType> read_raw(std::istream &is)
 }
 
 
+/**
+ * Reads a CSR matrix from the stream, parsing it in parallel.
+ *
+ * @param is  the input stream
+ * @param exec  the executor on which the matrix is created
+ * @param num_threads  the number of threads used for parsing
+ *
+ * @return the CSR matrix.
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr(
+    std::istream &is, std::shared_ptr<const Executor> exec,
+    size_type num_threads)
+{
+    return mtx_io<ValueType, IndexType>::get().read_csr(is, std::move(exec),
+                                                        num_threads);
+}
+
+
 /**
  * Writes raw data to the stream.
  *
@@ -785,7 +1175,12 @@ void write_raw(std::ostream &os, const matrix_data<ValueType, IndexType> &data,
     void write_raw(std::ostream &os,                              \
                    const matrix_data<ValueType, IndexType> &data, \
                    layout_type layout)
+#define GKO_DECLARE_READ_CSR(ValueType, IndexType)               \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr( \
+        std::istream &is, std::shared_ptr<const Executor> exec,  \
+        size_type num_threads)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_CSR);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 
 
@@ -33,7 +33,6 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/executor.hpp>
 
 
-#include <cstdlib>
 #include <cstring>
 
 
@@ -44,7 +43,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace gko {
 
 
-void OmpExecutor::raw_free(void *ptr) const noexcept { std::free(ptr); }
+void OmpExecutor::raw_free(void *ptr) const noexcept
+{
+    alloc_->deallocate(this, ptr);
+}
 
 
 std::shared_ptr<Executor> OmpExecutor::get_master() noexcept
@@ -61,7 +63,8 @@ std::shared_ptr<const Executor> OmpExecutor::get_master() const noexcept
 
 void *OmpExecutor::raw_alloc(size_type num_bytes) const
 {
-    return GKO_ENSURE_ALLOCATED(std::malloc(num_bytes), "OMP", num_bytes);
+    return GKO_ENSURE_ALLOCATED(alloc_->allocate(this, num_bytes), "OMP",
+                                num_bytes);
 }
 
 
@@ -0,0 +1,225 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/par_ic.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/factorization/par_ic_kernels.hpp"
+#include "core/matrix/csr_kernels.hpp"
+
+
+namespace gko {
+namespace factorization {
+namespace par_ic_factorization {
+
+
+GKO_REGISTER_OPERATION(initialize_row_ptrs_l,
+                       par_ic_factorization::initialize_row_ptrs_l);
+GKO_REGISTER_OPERATION(initialize_l, par_ic_factorization::initialize_l);
+GKO_REGISTER_OPERATION(compute_factor, par_ic_factorization::compute_factor);
+GKO_REGISTER_OPERATION(csr_conj_transpose, csr::conj_transpose);
+
+
+}  // namespace par_ic_factorization
+
+
+namespace {
+
+
+/**
+ * Converts the system matrix to a Csr matrix on `exec`, sorted by column index
+ * unless `skip_sorting` is set.
+ *
+ * Only copies the matrix if it is not on the same executor, was not in the
+ * right format or has to be sorted, in which case `owned_copy` holds the copy.
+ * Throws an exception if it is not convertable.
+ */
+template <typename CsrMatrix>
+const CsrMatrix *convert_to_sorted_csr(std::shared_ptr<const Executor> exec,
+                                       const LinOp *system_matrix,
+                                       bool skip_sorting,
+                                       std::unique_ptr<CsrMatrix> &owned_copy)
+{
+    auto csr_system_matrix = dynamic_cast<const CsrMatrix *>(system_matrix);
+    if (csr_system_matrix == nullptr ||
+        csr_system_matrix->get_executor() != exec) {
+        owned_copy = CsrMatrix::create(exec);
+        as<ConvertibleTo<CsrMatrix>>(system_matrix)
+            ->convert_to(owned_copy.get());
+        csr_system_matrix = owned_copy.get();
+    }
+    // If it needs to be sorted, copy it if necessary and sort it
+    if (!skip_sorting) {
+        if (owned_copy == nullptr) {
+            owned_copy = CsrMatrix::create(exec);
+            owned_copy->copy_from(csr_system_matrix);
+        }
+        owned_copy->sort_by_column_index();
+        csr_system_matrix = owned_copy.get();
+    }
+    return csr_system_matrix;
+}
+
+
+/**
+ * Computes the values of the incomplete Cholesky factor L, whose row pointers
+ * already describe the sparsity pattern of the lower triangle of the system
+ * matrix.
+ */
+template <typename ValueType, typename IndexType>
+void compute_factor(std::shared_ptr<const Executor> exec, size_type iterations,
+                    const matrix::Csr<ValueType, IndexType> *csr_system_matrix,
+                    std::unique_ptr<matrix::Csr<ValueType, IndexType>>
+                        csr_system_matrix_unique_ptr,
+                    matrix::Csr<ValueType, IndexType> *l_factor)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+
+    const auto matrix_size = l_factor->get_size();
+    const auto l_nnz = l_factor->get_num_stored_elements();
+    Array<IndexType> a_row_ptrs{exec, matrix_size[0] + 1};
+    exec->copy_from(exec.get(), a_row_ptrs.get_num_elems(),
+                    l_factor->get_const_row_ptrs(), a_row_ptrs.get_data());
+    // The lower triangle of the system matrix uses the same sparsity pattern
+    // as L, so the sweeps can access both with the same index
+    auto a_lower = CsrMatrix::create(exec, matrix_size,
+                                     Array<ValueType>{exec, l_nnz},
+                                     Array<IndexType>{exec, l_nnz},
+                                     std::move(a_row_ptrs));
+    exec->run(par_ic_factorization::make_initialize_l(
+        csr_system_matrix, a_lower.get(), false));
+    exec->run(par_ic_factorization::make_initialize_l(csr_system_matrix,
+                                                      l_factor, true));
+    // The system matrix is no longer needed, so a copy can be freed early
+    csr_system_matrix_unique_ptr.reset();
+
+    exec->run(par_ic_factorization::make_compute_factor(
+        iterations, a_lower.get(), l_factor));
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>> ParIc<ValueType, IndexType>::generate_l(
+    const std::shared_ptr<const LinOp> &system_matrix) const
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+
+    const auto exec = this->get_executor();
+    const auto host_exec = exec->get_master();
+
+    std::unique_ptr<CsrMatrix> csr_system_matrix_unique_ptr{};
+    auto csr_system_matrix = convert_to_sorted_csr(
+        exec, system_matrix.get(), parameters_.skip_sorting,
+        csr_system_matrix_unique_ptr);
+
+    const auto matrix_size = csr_system_matrix->get_size();
+    const auto number_rows = matrix_size[0];
+    Array<IndexType> l_row_ptrs{exec, number_rows + 1};
+    exec->run(par_ic_factorization::make_initialize_row_ptrs_l(
+        csr_system_matrix, l_row_ptrs.get_data()));
+
+    IndexType l_nnz_it;
+    // Since nnz is always at row_ptrs[m], it can be extracted easily
+    host_exec->copy_from(exec.get(), 1, l_row_ptrs.get_data() + number_rows,
+                         &l_nnz_it);
+    auto l_nnz = static_cast<size_type>(l_nnz_it);
+
+    std::shared_ptr<CsrMatrix> l_factor = matrix_type::create(
+        exec, matrix_size, Array<ValueType>{exec, l_nnz},
+        Array<IndexType>{exec, l_nnz}, std::move(l_row_ptrs),
+        parameters_.l_strategy);
+    compute_factor(exec, parameters_.iterations, csr_system_matrix,
+                   std::move(csr_system_matrix_unique_ptr), l_factor.get());
+
+    if (!parameters_.both_factors) {
+        return Composition<ValueType>::create(std::move(l_factor));
+    }
+    // `conj_transpose()` keeps the strategy of L, and its result is
+    // guaranteed to be a CsrMatrix
+    std::shared_ptr<CsrMatrix> lt_factor{
+        static_cast<CsrMatrix *>(l_factor->conj_transpose().release())};
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(lt_factor));
+}
+
+
+template <typename ValueType, typename IndexType>
+void ParIc<ValueType, IndexType>::update_values(
+    const std::shared_ptr<const LinOp> &system_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+    std::unique_ptr<CsrMatrix> csr_system_matrix_unique_ptr{};
+    auto csr_system_matrix = convert_to_sorted_csr(
+        exec, system_matrix.get(), parameters_.skip_sorting,
+        csr_system_matrix_unique_ptr);
+
+    // The factors were created by this object, so they can be refilled in
+    // place, which keeps their sparsity pattern and load balancing data
+    auto l_factor = std::const_pointer_cast<matrix_type>(this->get_l_factor());
+    compute_factor(exec, parameters_.iterations, csr_system_matrix,
+                   std::move(csr_system_matrix_unique_ptr), l_factor.get());
+    if (this->get_operators().size() == 2) {
+        auto lt_factor =
+            std::const_pointer_cast<matrix_type>(this->get_lt_factor());
+        exec->run(par_ic_factorization::make_csr_conj_transpose(
+            lt_factor.get(), l_factor.get()));
+    }
+}
+
+
+#define GKO_DECLARE_PAR_IC(ValueType, IndexType) \
+    class ParIc<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_IC);
+
+
+}  // namespace factorization
+}  // namespace gko
@@ -64,6 +64,109 @@ GKO_REGISTER_OPERATION(csr_transpose, csr::transpose);
 }  // namespace par_ilu_factorization
 
 
+namespace {
+
+
+/**
+ * Converts the system matrix to a Csr matrix on `exec`, sorted by column index
+ * unless `skip_sorting` is set.
+ *
+ * Only copies the matrix if it is not on the same executor, was not in the
+ * right format or has to be sorted, in which case `owned_copy` holds the copy.
+ * Throws an exception if it is not convertable.
+ */
+template <typename CsrMatrix>
+const CsrMatrix *convert_to_sorted_csr(std::shared_ptr<const Executor> exec,
+                                       const LinOp *system_matrix,
+                                       bool skip_sorting,
+                                       std::unique_ptr<CsrMatrix> &owned_copy)
+{
+    auto csr_system_matrix = dynamic_cast<const CsrMatrix *>(system_matrix);
+    if (csr_system_matrix == nullptr ||
+        csr_system_matrix->get_executor() != exec) {
+        owned_copy = CsrMatrix::create(exec);
+        as<ConvertibleTo<CsrMatrix>>(system_matrix)
+            ->convert_to(owned_copy.get());
+        csr_system_matrix = owned_copy.get();
+    }
+    // If it needs to be sorted, copy it if necessary and sort it
+    if (!skip_sorting) {
+        if (owned_copy == nullptr) {
+            owned_copy = CsrMatrix::create(exec);
+            owned_copy->copy_from(csr_system_matrix);
+        }
+        owned_copy->sort_by_column_index();
+        csr_system_matrix = owned_copy.get();
+    }
+    return csr_system_matrix;
+}
+
+
+/**
+ * Computes the values of the incomplete factors L and U, whose row pointers
+ * already describe the sparsity pattern of the lower and upper triangle of
+ * the system matrix.
+ */
+template <typename ValueType, typename IndexType>
+void compute_factors(
+    std::shared_ptr<const Executor> exec, size_type iterations,
+    const LinOp *system_matrix,
+    const matrix::Csr<ValueType, IndexType> *csr_system_matrix,
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>>
+        csr_system_matrix_unique_ptr,
+    bool skip_sorting, matrix::Csr<ValueType, IndexType> *l_factor,
+    matrix::Csr<ValueType, IndexType> *u_factor)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    exec->run(par_ilu_factorization::make_initialize_l_u(csr_system_matrix,
+                                                         l_factor, u_factor));
+
+    // We use `transpose()` here to convert the Csr format to Csc.
+    auto u_factor_transpose_lin_op = u_factor->transpose();
+    // Since `transpose()` returns an `std::unique_ptr<LinOp>`, we need to
+    // convert it to `CsrMatrix *` in order to use it.
+    auto u_factor_transpose =
+        static_cast<CsrMatrix *>(u_factor_transpose_lin_op.get());
+
+    // At first, test if the given system_matrix was already a Coo matrix,
+    // so no conversion would be necessary.
+    std::unique_ptr<CooMatrix> coo_system_matrix_unique_ptr{nullptr};
+    auto coo_system_matrix_ptr = dynamic_cast<const CooMatrix *>(system_matrix);
+
+    // If it was not, and we already own a CSR `system_matrix`,
+    // we can move the Csr matrix to Coo, which has very little overhead.
+    // Otherwise, we convert from the Csr matrix, since it is the conversion
+    // with the least overhead.
+    // We also have to convert / move from the CSR matrix if it was not already
+    // sorted (in which case we definitively own a CSR `system_matrix`).
+    if (!skip_sorting || coo_system_matrix_ptr == nullptr) {
+        coo_system_matrix_unique_ptr = CooMatrix::create(exec);
+        if (csr_system_matrix_unique_ptr == nullptr) {
+            csr_system_matrix->convert_to(coo_system_matrix_unique_ptr.get());
+        } else {
+            csr_system_matrix_unique_ptr->move_to(
+                coo_system_matrix_unique_ptr.get());
+        }
+        coo_system_matrix_ptr = coo_system_matrix_unique_ptr.get();
+    }
+
+    exec->run(par_ilu_factorization::make_compute_l_u_factors(
+        iterations, coo_system_matrix_ptr, l_factor, u_factor_transpose));
+
+    // Transpose it again, which is basically a conversion from CSC back to CSR
+    // Since the transposed version has the exact same non-zero positions
+    // as `u_factor`, we can both skip the allocation and the `make_srow()`
+    // call from CSR, leaving just the `transpose()` kernel call
+    exec->run(par_ilu_factorization::make_csr_transpose(u_factor,
+                                                        u_factor_transpose));
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 std::unique_ptr<Composition<ValueType>>
 ParIlu<ValueType, IndexType>::generate_l_u(
@@ -72,34 +175,15 @@ ParIlu<ValueType, IndexType>::generate_l_u(
     std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy) const
 {
     using CsrMatrix = matrix::Csr<ValueType, IndexType>;
-    using CooMatrix = matrix::Coo<ValueType, IndexType>;
 
     GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
 
     const auto exec = this->get_executor();
     const auto host_exec = exec->get_master();
 
-    // Only copies the matrix if it is not on the same executor or was not in
-    // the right format. Throws an exception if it is not convertable.
     std::unique_ptr<CsrMatrix> csr_system_matrix_unique_ptr{};
-    auto csr_system_matrix =
-        dynamic_cast<const CsrMatrix *>(system_matrix.get());
-    if (csr_system_matrix == nullptr ||
-        csr_system_matrix->get_executor() != exec) {
-        csr_system_matrix_unique_ptr = CsrMatrix::create(exec);
-        as<ConvertibleTo<CsrMatrix>>(system_matrix.get())
-            ->convert_to(csr_system_matrix_unique_ptr.get());
-        csr_system_matrix = csr_system_matrix_unique_ptr.get();
-    }
-    // If it needs to be sorted, copy it if necessary and sort it
-    if (!skip_sorting) {
-        if (csr_system_matrix_unique_ptr == nullptr) {
-            csr_system_matrix_unique_ptr = CsrMatrix::create(exec);
-            csr_system_matrix_unique_ptr->copy_from(csr_system_matrix);
-        }
-        csr_system_matrix_unique_ptr->sort_by_column_index();
-        csr_system_matrix = csr_system_matrix_unique_ptr.get();
-    }
+    auto csr_system_matrix = convert_to_sorted_csr(
+        exec, system_matrix.get(), skip_sorting, csr_system_matrix_unique_ptr);
 
     const auto matrix_size = csr_system_matrix->get_size();
     const auto number_rows = matrix_size[0];
@@ -131,52 +215,36 @@ ParIlu<ValueType, IndexType>::generate_l_u(
         exec, matrix_size, std::move(u_vals), std::move(u_col_idxs),
         std::move(u_row_ptrs), u_strategy);
 
-    exec->run(par_ilu_factorization::make_initialize_l_u(
-        csr_system_matrix, l_factor.get(), u_factor.get()));
-
-    // We use `transpose()` here to convert the Csr format to Csc.
-    auto u_factor_transpose_lin_op = u_factor->transpose();
-    // Since `transpose()` returns an `std::unique_ptr<LinOp>`, we need to
-    // convert it to `u_matrix_type *` in order to use it.
-    auto u_factor_transpose =
-        static_cast<u_matrix_type *>(u_factor_transpose_lin_op.get());
+    compute_factors(exec, parameters_.iterations, system_matrix.get(),
+                    csr_system_matrix, std::move(csr_system_matrix_unique_ptr),
+                    skip_sorting, l_factor.get(), u_factor.get());
 
-    // At first, test if the given system_matrix was already a Coo matrix,
-    // so no conversion would be necessary.
-    std::unique_ptr<CooMatrix> coo_system_matrix_unique_ptr{nullptr};
-    auto coo_system_matrix_ptr =
-        dynamic_cast<const CooMatrix *>(system_matrix.get());
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(u_factor));
+}
 
-    // If it was not, and we already own a CSR `system_matrix`,
-    // we can move the Csr matrix to Coo, which has very little overhead.
-    // Otherwise, we convert from the Csr matrix, since it is the conversion
-    // with the least overhead.
-    // We also have to convert / move from the CSR matrix if it was not already
-    // sorted (in which case we definitively own a CSR `system_matrix`).
-    if (!skip_sorting || coo_system_matrix_ptr == nullptr) {
-        coo_system_matrix_unique_ptr = CooMatrix::create(exec);
-        if (csr_system_matrix_unique_ptr == nullptr) {
-            csr_system_matrix->convert_to(coo_system_matrix_unique_ptr.get());
-        } else {
-            csr_system_matrix_unique_ptr->move_to(
-                coo_system_matrix_unique_ptr.get());
-        }
-        coo_system_matrix_ptr = coo_system_matrix_unique_ptr.get();
-    }
 
-    exec->run(par_ilu_factorization::make_compute_l_u_factors(
-        parameters_.iterations, coo_system_matrix_ptr, l_factor.get(),
-        u_factor_transpose));
+template <typename ValueType, typename IndexType>
+void ParIlu<ValueType, IndexType>::update_values(
+    const std::shared_ptr<const LinOp> &system_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
 
-    // Transpose it again, which is basically a conversion from CSC back to CSR
-    // Since the transposed version has the exact same non-zero positions
-    // as `u_factor`, we can both skip the allocation and the `make_srow()`
-    // call from CSR, leaving just the `transpose()` kernel call
-    exec->run(par_ilu_factorization::make_csr_transpose(u_factor.get(),
-                                                        u_factor_transpose));
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
 
-    return Composition<ValueType>::create(std::move(l_factor),
-                                          std::move(u_factor));
+    const auto exec = this->get_executor();
+    std::unique_ptr<CsrMatrix> csr_system_matrix_unique_ptr{};
+    auto csr_system_matrix = convert_to_sorted_csr(
+        exec, system_matrix.get(), parameters_.skip_sorting,
+        csr_system_matrix_unique_ptr);
+
+    // The factors were created by this object, so they can be refilled in
+    // place, which keeps their sparsity pattern and load balancing data
+    compute_factors(
+        exec, parameters_.iterations, system_matrix.get(), csr_system_matrix,
+        std::move(csr_system_matrix_unique_ptr), parameters_.skip_sorting,
+        std::const_pointer_cast<l_matrix_type>(this->get_l_factor()).get(),
+        std::const_pointer_cast<u_matrix_type>(this->get_u_factor()).get());
 }
 
 
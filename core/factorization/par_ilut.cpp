@@ -0,0 +1,214 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/par_ilut.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/factorization/par_ilu_kernels.hpp"
+#include "core/factorization/par_ilut_kernels.hpp"
+
+
+namespace gko {
+namespace factorization {
+namespace par_ilut_factorization {
+
+
+GKO_REGISTER_OPERATION(initialize_row_ptrs_l_u,
+                       par_ilu_factorization::initialize_row_ptrs_l_u);
+GKO_REGISTER_OPERATION(initialize_l_u, par_ilu_factorization::initialize_l_u);
+GKO_REGISTER_OPERATION(add_candidates, par_ilut_factorization::add_candidates);
+GKO_REGISTER_OPERATION(compute_l_u_factors,
+                       par_ilut_factorization::compute_l_u_factors);
+GKO_REGISTER_OPERATION(threshold_select,
+                       par_ilut_factorization::threshold_select);
+GKO_REGISTER_OPERATION(threshold_filter,
+                       par_ilut_factorization::threshold_filter);
+
+
+}  // namespace par_ilut_factorization
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>>
+ParIlut<ValueType, IndexType>::generate_l_u(
+    const std::shared_ptr<const LinOp> &system_matrix) const
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+
+    const auto exec = this->get_executor();
+    const auto host_exec = exec->get_master();
+
+    // Only copies the matrix if it is not on the same executor or was not in
+    // the right format. Throws an exception if it is not convertable.
+    std::unique_ptr<CsrMatrix> csr_system_matrix_unique_ptr{};
+    auto csr_system_matrix =
+        dynamic_cast<const CsrMatrix *>(system_matrix.get());
+    if (csr_system_matrix == nullptr ||
+        csr_system_matrix->get_executor() != exec) {
+        csr_system_matrix_unique_ptr = CsrMatrix::create(exec);
+        as<ConvertibleTo<CsrMatrix>>(system_matrix.get())
+            ->convert_to(csr_system_matrix_unique_ptr.get());
+        csr_system_matrix = csr_system_matrix_unique_ptr.get();
+    }
+    // If it needs to be sorted, copy it if necessary and sort it
+    if (!parameters_.skip_sorting) {
+        if (csr_system_matrix_unique_ptr == nullptr) {
+            csr_system_matrix_unique_ptr = CsrMatrix::create(exec);
+            csr_system_matrix_unique_ptr->copy_from(csr_system_matrix);
+        }
+        csr_system_matrix_unique_ptr->sort_by_column_index();
+        csr_system_matrix = csr_system_matrix_unique_ptr.get();
+    }
+
+    const auto matrix_size = csr_system_matrix->get_size();
+    const auto number_rows = matrix_size[0];
+    const auto l_strategy = parameters_.l_strategy;
+    const auto u_strategy = parameters_.u_strategy;
+
+    // The initial factors are the lower and upper triangle of the system
+    // matrix, exactly as for ParILU
+    Array<IndexType> l_row_ptrs{exec, number_rows + 1};
+    Array<IndexType> u_row_ptrs{exec, number_rows + 1};
+    exec->run(par_ilut_factorization::make_initialize_row_ptrs_l_u(
+        csr_system_matrix, l_row_ptrs.get_data(), u_row_ptrs.get_data()));
+    IndexType l_nnz_it;
+    IndexType u_nnz_it;
+    host_exec->copy_from(exec.get(), 1, l_row_ptrs.get_data() + number_rows,
+                         &l_nnz_it);
+    host_exec->copy_from(exec.get(), 1, u_row_ptrs.get_data() + number_rows,
+                         &u_nnz_it);
+    auto l_nnz = static_cast<size_type>(l_nnz_it);
+    auto u_nnz = static_cast<size_type>(u_nnz_it);
+    std::shared_ptr<CsrMatrix> l_factor = l_matrix_type::create(
+        exec, matrix_size, Array<ValueType>{exec, l_nnz},
+        Array<IndexType>{exec, l_nnz}, std::move(l_row_ptrs), l_strategy);
+    std::shared_ptr<CsrMatrix> u_factor = u_matrix_type::create(
+        exec, matrix_size, Array<ValueType>{exec, u_nnz},
+        Array<IndexType>{exec, u_nnz}, std::move(u_row_ptrs), u_strategy);
+    exec->run(par_ilut_factorization::make_initialize_l_u(
+        csr_system_matrix, l_factor.get(), u_factor.get()));
+
+    // The fill-in limit is relative to the initial number of non-zeros
+    const auto l_nnz_limit =
+        static_cast<size_type>(parameters_.fill_in_limit * l_nnz);
+    const auto u_nnz_limit =
+        static_cast<size_type>(parameters_.fill_in_limit * u_nnz);
+
+    // Applies the fill-in limit and the drop tolerance to `factor`, returning
+    // the thresholded matrix
+    Array<ValueType> selection_tmp{exec};
+    auto filter = [&](const CsrMatrix *factor, size_type nnz_limit,
+                      std::shared_ptr<typename CsrMatrix::strategy_type>
+                          strategy) {
+        const auto nnz = factor->get_num_stored_elements();
+        remove_complex<ValueType> threshold{};
+        if (nnz > nnz_limit) {
+            exec->run(par_ilut_factorization::make_threshold_select(
+                factor, static_cast<IndexType>(nnz - nnz_limit),
+                selection_tmp, threshold));
+        }
+        Array<IndexType> new_row_ptrs{exec};
+        Array<IndexType> new_col_idxs{exec};
+        Array<ValueType> new_vals{exec};
+        exec->run(par_ilut_factorization::make_threshold_filter(
+            csr_system_matrix, factor, threshold, parameters_.drop_tolerance,
+            new_row_ptrs, new_col_idxs, new_vals));
+        return CsrMatrix::create(exec, matrix_size, std::move(new_vals),
+                                 std::move(new_col_idxs),
+                                 std::move(new_row_ptrs), strategy);
+    };
+    // Runs a single fixed-point sweep on the given factors, using a CSC copy
+    // of U to access its columns
+    auto sweep = [&](CsrMatrix *l, CsrMatrix *u) {
+        auto u_csc_lin_op = u->transpose();
+        auto u_csc = static_cast<CsrMatrix *>(u_csc_lin_op.get());
+        exec->run(par_ilut_factorization::make_compute_l_u_factors(
+            csr_system_matrix, l, u, u_csc));
+    };
+
+    auto lu = CsrMatrix::create(exec, matrix_size);
+    for (size_type step = 0; step < parameters_.iterations; ++step) {
+        // add the non-zero locations of A - LU as candidates
+        l_factor->apply(u_factor.get(), lu.get());
+        lu->sort_by_column_index();
+        Array<IndexType> l_new_row_ptrs{exec};
+        Array<IndexType> l_new_col_idxs{exec};
+        Array<ValueType> l_new_vals{exec};
+        Array<IndexType> u_new_row_ptrs{exec};
+        Array<IndexType> u_new_col_idxs{exec};
+        Array<ValueType> u_new_vals{exec};
+        exec->run(par_ilut_factorization::make_add_candidates(
+            lu.get(), csr_system_matrix, l_factor.get(), u_factor.get(),
+            l_new_row_ptrs, l_new_col_idxs, l_new_vals, u_new_row_ptrs,
+            u_new_col_idxs, u_new_vals));
+        auto l_new = CsrMatrix::create(
+            exec, matrix_size, std::move(l_new_vals), std::move(l_new_col_idxs),
+            std::move(l_new_row_ptrs), l_strategy);
+        auto u_new = CsrMatrix::create(
+            exec, matrix_size, std::move(u_new_vals), std::move(u_new_col_idxs),
+            std::move(u_new_row_ptrs), u_strategy);
+
+        // update the enlarged factors, then remove the smallest entries
+        sweep(l_new.get(), u_new.get());
+        l_factor = filter(l_new.get(), l_nnz_limit, l_strategy);
+        u_factor = filter(u_new.get(), u_nnz_limit, u_strategy);
+
+        // update the remaining entries
+        sweep(l_factor.get(), u_factor.get());
+    }
+
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(u_factor));
+}
+
+
+#define GKO_DECLARE_PAR_ILUT(ValueType, IndexType) \
+    class ParIlut<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILUT);
+
+
+}  // namespace factorization
+}  // namespace gko
@@ -0,0 +1,339 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/compact_record.hpp>
+
+
+#include <complex>
+#include <limits>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+template <typename ValueType>
+bool read_first_norm(const LinOp *residual_norm, double &result)
+{
+    auto dense = dynamic_cast<const matrix::Dense<ValueType> *>(residual_norm);
+    if (dense == nullptr) {
+        return false;
+    }
+    const auto exec = dense->get_executor();
+    const auto master = exec->get_master();
+    auto value = zero<ValueType>();
+    if (exec == master) {
+        value = dense->get_const_values()[0];
+    } else {
+        master->copy_from(exec.get(), 1, dense->get_const_values(), &value);
+    }
+    result = static_cast<double>(abs(value));
+    return true;
+}
+
+
+/**
+ * Returns the residual norm of the first right hand side, or NaN if it is not
+ * available. Only a single value is copied to the host.
+ */
+double get_first_norm(const LinOp *residual_norm)
+{
+    auto result = std::numeric_limits<double>::quiet_NaN();
+    if (residual_norm != nullptr && residual_norm->get_size()[0] > 0 &&
+        residual_norm->get_size()[1] > 0) {
+        read_first_norm<double>(residual_norm, result) ||
+            read_first_norm<float>(residual_norm, result) ||
+            read_first_norm<std::complex<double>>(residual_norm, result) ||
+            read_first_norm<std::complex<float>>(residual_norm, result);
+    }
+    return result;
+}
+
+
+template <typename T>
+uintptr as_id(const T *ptr)
+{
+    return reinterpret_cast<uintptr>(ptr);
+}
+
+
+constexpr auto no_norm = std::numeric_limits<double>::quiet_NaN();
+
+
+}  // namespace
+
+
+void CompactRecord::append(mask_type event, const char *name, uintptr object,
+                           uintptr input, uintptr output, size_type size,
+                           double residual_norm) const
+{
+    if (!events_.empty()) {
+        const auto timestamp =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_)
+                .count();
+        auto &data = events_[num_logged_ % events_.size()];
+        data.event = event;
+        data.timestamp = static_cast<int64>(timestamp);
+        data.name = name;
+        data.object = object;
+        data.input = input;
+        data.output = output;
+        data.size = size;
+        data.residual_norm = residual_norm;
+    }
+    ++num_logged_;
+}
+
+
+std::vector<CompactRecord::event_data> CompactRecord::get_events() const
+{
+    std::vector<event_data> result;
+    result.reserve(this->get_num_events());
+    for (size_type i = 0; i < this->get_num_events(); ++i) {
+        result.push_back(this->get_event(i));
+    }
+    return result;
+}
+
+
+void CompactRecord::on_allocation_started(const Executor *exec,
+                                          const size_type &num_bytes) const
+{
+    append(allocation_started_mask, nullptr, as_id(exec), 0, 0, num_bytes,
+           no_norm);
+}
+
+
+void CompactRecord::on_allocation_completed(const Executor *exec,
+                                            const size_type &num_bytes,
+                                            const uintptr &location) const
+{
+    append(allocation_completed_mask, nullptr, as_id(exec), location, 0,
+           num_bytes, no_norm);
+}
+
+
+void CompactRecord::on_free_started(const Executor *exec,
+                                    const uintptr &location) const
+{
+    append(free_started_mask, nullptr, as_id(exec), location, 0, 0, no_norm);
+}
+
+
+void CompactRecord::on_free_completed(const Executor *exec,
+                                      const uintptr &location) const
+{
+    append(free_completed_mask, nullptr, as_id(exec), location, 0, 0, no_norm);
+}
+
+
+void CompactRecord::on_copy_started(const Executor *from, const Executor *to,
+                                    const uintptr &location_from,
+                                    const uintptr &location_to,
+                                    const size_type &num_bytes) const
+{
+    append(copy_started_mask, nullptr, as_id(from), location_from, location_to,
+           num_bytes, no_norm);
+}
+
+
+void CompactRecord::on_copy_completed(const Executor *from, const Executor *to,
+                                      const uintptr &location_from,
+                                      const uintptr &location_to,
+                                      const size_type &num_bytes) const
+{
+    append(copy_completed_mask, nullptr, as_id(from), location_from,
+           location_to, num_bytes, no_norm);
+}
+
+
+void CompactRecord::on_operation_launched(const Executor *exec,
+                                          const Operation *operation) const
+{
+    append(operation_launched_mask, operation->get_name(), as_id(exec),
+           as_id(operation), 0, 0, no_norm);
+}
+
+
+void CompactRecord::on_operation_completed(const Executor *exec,
+                                           const Operation *operation) const
+{
+    append(operation_completed_mask, operation->get_name(), as_id(exec),
+           as_id(operation), 0, 0, no_norm);
+}
+
+
+void CompactRecord::on_polymorphic_object_create_started(
+    const Executor *exec, const PolymorphicObject *po) const
+{
+    append(polymorphic_object_create_started_mask, nullptr, as_id(exec),
+           as_id(po), 0, 0, no_norm);
+}
+
+
+void CompactRecord::on_polymorphic_object_create_completed(
+    const Executor *exec, const PolymorphicObject *input,
+    const PolymorphicObject *output) const
+{
+    append(polymorphic_object_create_completed_mask, nullptr, as_id(exec),
+           as_id(input), as_id(output), 0, no_norm);
+}
+
+
+void CompactRecord::on_polymorphic_object_copy_started(
+    const Executor *exec, const PolymorphicObject *from,
+    const PolymorphicObject *to) const
+{
+    append(polymorphic_object_copy_started_mask, nullptr, as_id(exec),
+           as_id(from), as_id(to), 0, no_norm);
+}
+
+
+void CompactRecord::on_polymorphic_object_copy_completed(
+    const Executor *exec, const PolymorphicObject *from,
+    const PolymorphicObject *to) const
+{
+    append(polymorphic_object_copy_completed_mask, nullptr, as_id(exec),
+           as_id(from), as_id(to), 0, no_norm);
+}
+
+
+void CompactRecord::on_polymorphic_object_deleted(
+    const Executor *exec, const PolymorphicObject *po) const
+{
+    append(polymorphic_object_deleted_mask, nullptr, as_id(exec), as_id(po), 0,
+           0, no_norm);
+}
+
+
+void CompactRecord::on_linop_apply_started(const LinOp *A, const LinOp *b,
+                                           const LinOp *x) const
+{
+    append(linop_apply_started_mask, nullptr, as_id(A), as_id(b), as_id(x), 0,
+           no_norm);
+}
+
+
+void CompactRecord::on_linop_apply_completed(const LinOp *A, const LinOp *b,
+                                             const LinOp *x) const
+{
+    append(linop_apply_completed_mask, nullptr, as_id(A), as_id(b), as_id(x),
+           0, no_norm);
+}
+
+
+void CompactRecord::on_linop_advanced_apply_started(const LinOp *A,
+                                                    const LinOp *alpha,
+                                                    const LinOp *b,
+                                                    const LinOp *beta,
+                                                    const LinOp *x) const
+{
+    append(linop_advanced_apply_started_mask, nullptr, as_id(A), as_id(b),
+           as_id(x), 0, no_norm);
+}
+
+
+void CompactRecord::on_linop_advanced_apply_completed(const LinOp *A,
+                                                      const LinOp *alpha,
+                                                      const LinOp *b,
+                                                      const LinOp *beta,
+                                                      const LinOp *x) const
+{
+    append(linop_advanced_apply_completed_mask, nullptr, as_id(A), as_id(b),
+           as_id(x), 0, no_norm);
+}
+
+
+void CompactRecord::on_linop_factory_generate_started(
+    const LinOpFactory *factory, const LinOp *input) const
+{
+    append(linop_factory_generate_started_mask, nullptr, as_id(factory),
+           as_id(input), 0, 0, no_norm);
+}
+
+
+void CompactRecord::on_linop_factory_generate_completed(
+    const LinOpFactory *factory, const LinOp *input, const LinOp *output) const
+{
+    append(linop_factory_generate_completed_mask, nullptr, as_id(factory),
+           as_id(input), as_id(output), 0, no_norm);
+}
+
+
+void CompactRecord::on_criterion_check_started(
+    const stop::Criterion *criterion, const size_type &num_iterations,
+    const LinOp *residual, const LinOp *residual_norm, const LinOp *solution,
+    const uint8 &stopping_id, const bool &set_finalized) const
+{
+    append(criterion_check_started_mask, nullptr, as_id(criterion),
+           as_id(residual), as_id(solution), num_iterations, no_norm);
+}
+
+
+void CompactRecord::on_criterion_check_completed(
+    const stop::Criterion *criterion, const size_type &num_iterations,
+    const LinOp *residual, const LinOp *residual_norm, const LinOp *solution,
+    const uint8 &stopping_id, const bool &set_finalized,
+    const Array<stopping_status> *status, const bool &oneChanged,
+    const bool &converged) const
+{
+    // the norm is only read once per check, as it may require a device
+    // synchronization
+    append(criterion_check_completed_mask, nullptr, as_id(criterion),
+           as_id(residual), as_id(solution), num_iterations,
+           capture_norms_ ? get_first_norm(residual_norm) : no_norm);
+}
+
+
+void CompactRecord::on_iteration_complete(const LinOp *solver,
+                                          const size_type &num_iterations,
+                                          const LinOp *residual,
+                                          const LinOp *solution,
+                                          const LinOp *residual_norm) const
+{
+    append(iteration_complete_mask, nullptr, as_id(solver), as_id(residual),
+           as_id(solution), num_iterations, no_norm);
+}
+
+
+}  // namespace log
+}  // namespace gko
@@ -53,17 +53,29 @@ void Convergence<ValueType>::on_criterion_check_completed(
 {
     if (converged) {
         this->num_iterations_ = num_iterations;
-        if (residual != nullptr) {
+        if (residual != nullptr && store_residual_) {
             this->residual_.reset(residual->clone().release());
         }
         if (residual_norm != nullptr) {
-            this->residual_norm_.reset(residual_norm->clone().release());
+            if (!store_residual_ && this->residual_norm_ &&
+                this->residual_norm_->get_size() == residual_norm->get_size()) {
+                this->residual_norm_->copy_from(residual_norm);
+            } else {
+                this->residual_norm_.reset(residual_norm->clone().release());
+            }
         } else if (residual != nullptr) {
             using Vector = matrix::Dense<ValueType>;
-            this->residual_norm_ = Vector::create(
-                residual->get_executor(), dim<2>{1, residual->get_size()[1]});
+            const auto norm_size = dim<2>{1, residual->get_size()[1]};
+            auto norm = dynamic_cast<Vector *>(this->residual_norm_.get());
+            if (store_residual_ || norm == nullptr ||
+                norm->get_size() != norm_size ||
+                norm->get_executor() != residual->get_executor()) {
+                this->residual_norm_ =
+                    Vector::create(residual->get_executor(), norm_size);
+                norm = static_cast<Vector *>(this->residual_norm_.get());
+            }
             auto dense_r = as<Vector>(residual);
-            dense_r->compute_norm2(this->residual_norm_.get());
+            dense_r->compute_norm2(norm);
         }
     }
 }
@@ -0,0 +1,338 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/profiler_hook.hpp>
+
+
+#include <algorithm>
+#include <iomanip>
+#include <ios>
+#include <iterator>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+void write_json_string(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (auto c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << static_cast<int>(c) << std::dec << std::setfill(' ');
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+
+}  // namespace
+
+
+void ProfilerHook::on_allocation_completed(const Executor *exec,
+                                           const size_type &num_bytes,
+                                           const uintptr &location) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &stack = this->get_thread_data().stack;
+    if (!stack.empty()) {
+        stack.back().bytes += num_bytes;
+    }
+}
+
+
+void ProfilerHook::on_copy_completed(const Executor *from, const Executor *to,
+                                     const uintptr &location_from,
+                                     const uintptr &location_to,
+                                     const size_type &num_bytes) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &stack = this->get_thread_data().stack;
+    if (!stack.empty()) {
+        stack.back().bytes += num_bytes;
+    }
+}
+
+
+void ProfilerHook::on_operation_launched(const Executor *exec,
+                                         const Operation *operation) const
+{
+    exec->synchronize();
+    this->begin_range(operation, operation->get_name());
+}
+
+
+void ProfilerHook::on_operation_completed(const Executor *exec,
+                                          const Operation *operation) const
+{
+    exec->synchronize();
+    this->end_range(operation);
+}
+
+
+void ProfilerHook::on_linop_apply_started(const LinOp *A, const LinOp *b,
+                                          const LinOp *x) const
+{
+    A->get_executor()->synchronize();
+    this->begin_range(A, "apply(" + this->get_type_name(typeid(*A)) + ")");
+}
+
+
+void ProfilerHook::on_linop_apply_completed(const LinOp *A, const LinOp *b,
+                                            const LinOp *x) const
+{
+    A->get_executor()->synchronize();
+    this->end_range(A);
+}
+
+
+void ProfilerHook::on_linop_advanced_apply_started(const LinOp *A,
+                                                   const LinOp *alpha,
+                                                   const LinOp *b,
+                                                   const LinOp *beta,
+                                                   const LinOp *x) const
+{
+    A->get_executor()->synchronize();
+    this->begin_range(
+        A, "advanced_apply(" + this->get_type_name(typeid(*A)) + ")");
+}
+
+
+void ProfilerHook::on_linop_advanced_apply_completed(const LinOp *A,
+                                                     const LinOp *alpha,
+                                                     const LinOp *b,
+                                                     const LinOp *beta,
+                                                     const LinOp *x) const
+{
+    A->get_executor()->synchronize();
+    this->end_range(A);
+}
+
+
+void ProfilerHook::on_linop_factory_generate_started(
+    const LinOpFactory *factory, const LinOp *input) const
+{
+    factory->get_executor()->synchronize();
+    this->begin_range(
+        factory, "generate(" + this->get_type_name(typeid(*factory)) + ")");
+}
+
+
+void ProfilerHook::on_linop_factory_generate_completed(
+    const LinOpFactory *factory, const LinOp *input, const LinOp *output) const
+{
+    factory->get_executor()->synchronize();
+    this->end_range(factory);
+}
+
+
+std::vector<ProfilerHook::summary_entry> ProfilerHook::get_summary() const
+{
+    std::vector<summary_entry> result;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        result.reserve(summary_.size());
+        for (const auto &entry : summary_) {
+            result.push_back(entry.second);
+        }
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const summary_entry &a, const summary_entry &b) {
+                         return a.inclusive_time > b.inclusive_time;
+                     });
+    return result;
+}
+
+
+void ProfilerHook::print_summary(std::ostream &os) const
+{
+    const auto summary = this->get_summary();
+    size_type name_width = 4;
+    for (const auto &entry : summary) {
+        name_width = std::max(name_width, entry.name.size());
+    }
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::left << std::setw(name_width) << "name" << std::right
+       << std::setw(10) << "calls" << std::setw(14) << "total [ms]"
+       << std::setw(14) << "self [ms]" << std::setw(14) << "avg [us]"
+       << std::setw(16) << "bytes" << '\n';
+    os << std::fixed << std::setprecision(3);
+    for (const auto &entry : summary) {
+        os << std::left << std::setw(name_width) << entry.name << std::right
+           << std::setw(10) << entry.count << std::setw(14)
+           << entry.inclusive_time * 1e-6 << std::setw(14)
+           << entry.exclusive_time * 1e-6 << std::setw(14)
+           << entry.inclusive_time * 1e-3 / entry.count << std::setw(16)
+           << entry.bytes << '\n';
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+
+void ProfilerHook::write_chrome_trace(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\":[";
+    for (size_type i = 0; i < trace_.size(); ++i) {
+        const auto &event = trace_[i];
+        os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(os, event.name);
+        os << ",\"cat\":\"ginkgo\",\"ph\":\"X\",\"ts\":" << event.begin * 1e-3
+           << ",\"dur\":" << event.duration * 1e-3
+           << ",\"pid\":0,\"tid\":" << event.thread << '}';
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
+
+void ProfilerHook::clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    summary_.clear();
+    trace_.clear();
+}
+
+
+int64 ProfilerHook::get_time() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+}
+
+
+ProfilerHook::thread_data &ProfilerHook::get_thread_data() const
+{
+    const auto id = std::this_thread::get_id();
+    auto it = threads_.find(id);
+    if (it == threads_.end()) {
+        it = threads_.emplace(id, thread_data{threads_.size(), {}}).first;
+    }
+    return it->second;
+}
+
+
+void ProfilerHook::begin_range(const void *id, std::string name) const
+{
+    const auto time = this->get_time();
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->get_thread_data().stack.push_back(
+        range_frame{id, std::move(name), time, 0, 0});
+}
+
+
+void ProfilerHook::end_range(const void *id) const
+{
+    const auto time = this->get_time();
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &data = this->get_thread_data();
+    auto &stack = data.stack;
+    auto it = std::find_if(
+        stack.rbegin(), stack.rend(),
+        [id](const range_frame &frame) { return frame.id == id; });
+    if (it == stack.rend()) {
+        return;
+    }
+    // ranges which were not closed, e.g. due to an exception, end here as well
+    const auto num_closed = std::distance(stack.rbegin(), it) + 1;
+    for (auto i = num_closed; i > 0; --i) {
+        auto frame = std::move(stack.back());
+        stack.pop_back();
+        const auto duration = time - frame.begin;
+        if (!stack.empty()) {
+            stack.back().child_time += duration;
+            stack.back().bytes += frame.bytes;
+        }
+        auto &entry = summary_[frame.name];
+        if (entry.count == 0) {
+            entry.name = frame.name;
+        }
+        entry.count++;
+        entry.inclusive_time += duration;
+        entry.exclusive_time += duration - frame.child_time;
+        entry.bytes += frame.bytes;
+        if (record_trace_) {
+            trace_.push_back(trace_event{std::move(frame.name), data.index,
+                                         frame.begin, duration});
+        }
+    }
+}
+
+
+std::string ProfilerHook::get_type_name(const std::type_info &type) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = type_names_.find(std::type_index(type));
+    if (it == type_names_.end()) {
+        it = type_names_
+                 .emplace(std::type_index(type),
+                          name_demangling::get_type_name(type))
+                 .first;
+    }
+    return it->second;
+}
+
+
+}  // namespace log
+}  // namespace gko
@@ -33,6 +33,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/csr.hpp>
 
 
+#include <algorithm>
+#include <vector>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
@@ -57,6 +61,7 @@ GKO_REGISTER_OPERATION(spmv, csr::spmv);
 GKO_REGISTER_OPERATION(advanced_spmv, csr::advanced_spmv);
 GKO_REGISTER_OPERATION(spgemm, csr::spgemm);
 GKO_REGISTER_OPERATION(advanced_spgemm, csr::advanced_spgemm);
+GKO_REGISTER_OPERATION(spgemm_numeric, csr::spgemm_numeric);
 GKO_REGISTER_OPERATION(convert_to_coo, csr::convert_to_coo);
 GKO_REGISTER_OPERATION(convert_to_dense, csr::convert_to_dense);
 GKO_REGISTER_OPERATION(convert_to_sellp, csr::convert_to_sellp);
@@ -76,6 +81,7 @@ GKO_REGISTER_OPERATION(calculate_nonzeros_per_row,
 GKO_REGISTER_OPERATION(sort_by_column_index, csr::sort_by_column_index);
 GKO_REGISTER_OPERATION(is_sorted_by_column_index,
                        csr::is_sorted_by_column_index);
+GKO_REGISTER_OPERATION(scatter_values, csr::scatter_values);
 
 
 }  // namespace csr
@@ -452,6 +458,99 @@ bool Csr<ValueType, IndexType>::is_sorted_by_column_index() const
 }
 
 
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::update_product_values(const Csr *a,
+                                                      const Csr *b)
+{
+    GKO_ASSERT_CONFORMANT(a, b);
+    GKO_ASSERT_EQUAL_ROWS(this, a);
+    GKO_ASSERT_EQUAL_COLS(this, b);
+    auto exec = this->get_executor();
+    exec->run(csr::make_spgemm_numeric(make_temporary_clone(exec, a).get(),
+                                       make_temporary_clone(exec, b).get(),
+                                       this));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::update_values(const Array<ValueType> &values)
+{
+    GKO_ASSERT_EQ(values.get_num_elems(), this->get_num_stored_elements());
+    auto exec = this->get_executor();
+    exec->copy_from(values.get_executor().get(), values.get_num_elems(),
+                    values.get_const_data(), this->get_values());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::update_values(
+    const Array<ValueType> &values, const Array<IndexType> &positions)
+{
+    GKO_ASSERT_EQ(values.get_num_elems(), positions.get_num_elems());
+    auto exec = this->get_executor();
+    if (values.get_executor() == exec && positions.get_executor() == exec) {
+        exec->run(csr::make_scatter_values(values, positions, this));
+    } else {
+        exec->run(csr::make_scatter_values(Array<ValueType>{exec, values},
+                                           Array<IndexType>{exec, positions},
+                                           this));
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+Array<IndexType> Csr<ValueType, IndexType>::compute_value_positions(
+    const mat_data &data) const
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(data.size, this->get_size());
+    auto exec = this->get_executor();
+    const auto host_this = make_temporary_clone(exec->get_master(), this);
+    const auto row_ptrs = host_this->get_const_row_ptrs();
+    const auto col_idxs = host_this->get_const_col_idxs();
+    Array<IndexType> positions(exec->get_master(), data.nonzeros.size());
+    auto out = positions.get_data();
+    const auto num_rows = host_this->get_size()[0];
+    // sorted rows are searched by bisection, only unsorted ones linearly
+    std::vector<bool> sorted_row(num_rows);
+    for (size_type row = 0; row < num_rows; ++row) {
+        sorted_row[row] = std::is_sorted(col_idxs + row_ptrs[row],
+                                         col_idxs + row_ptrs[row + 1]);
+    }
+    // duplicate entries are matched to distinct storage positions, so no two
+    // values of the stream are scattered to the same position
+    std::vector<bool> taken(host_this->get_num_stored_elements());
+    for (size_type i = 0; i < data.nonzeros.size(); ++i) {
+        const auto &elem = data.nonzeros[i];
+        const auto begin = col_idxs + row_ptrs[elem.row];
+        const auto end = col_idxs + row_ptrs[elem.row + 1];
+        const auto column = static_cast<IndexType>(elem.column);
+        auto it = end;
+        if (sorted_row[elem.row]) {
+            // duplicates are adjacent in a sorted row
+            it = std::lower_bound(begin, end, column);
+            while (it != end && *it == column && taken[it - col_idxs]) {
+                ++it;
+            }
+            if (it != end && *it != column) {
+                it = end;
+            }
+        } else {
+            it = std::find(begin, end, column);
+            while (it != end && taken[it - col_idxs]) {
+                it = std::find(it + 1, end, column);
+            }
+        }
+        if (it == end) {
+            out[i] = -1;
+        } else {
+            taken[it - col_idxs] = true;
+            out[i] = static_cast<IndexType>(it - col_idxs);
+        }
+    }
+    return Array<IndexType>(exec, std::move(positions));
+}
+
+
 #define GKO_DECLARE_CSR_MATRIX(ValueType, IndexType) \
     class Csr<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_MATRIX);
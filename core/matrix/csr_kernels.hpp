@@ -80,6 +80,12 @@ namespace kernels {
                          Array<IndexType> &c_col_idxs,                \
                          Array<ValueType> &c_vals)
 
+#define GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL(ValueType, IndexType)  \
+    void spgemm_numeric(std::shared_ptr<const DefaultExecutor> exec, \
+                        const matrix::Csr<ValueType, IndexType> *a,  \
+                        const matrix::Csr<ValueType, IndexType> *b,  \
+                        matrix::Csr<ValueType, IndexType> *c)
+
 #define GKO_DECLARE_CSR_CONVERT_TO_DENSE_KERNEL(ValueType, IndexType)  \
     void convert_to_dense(std::shared_ptr<const DefaultExecutor> exec, \
                           matrix::Dense<ValueType> *result,            \
@@ -167,6 +173,17 @@ namespace kernels {
         std::shared_ptr<const DefaultExecutor> exec,                    \
         const matrix::Csr<ValueType, IndexType> *to_check, bool *is_sorted)
 
+#define GKO_DECLARE_CSR_EXTRACT_DIAGONAL(ValueType, IndexType)           \
+    void extract_diagonal(std::shared_ptr<const DefaultExecutor> exec,    \
+                          const matrix::Csr<ValueType, IndexType> *orig, \
+                          Array<ValueType> &diag)
+
+#define GKO_DECLARE_CSR_SCATTER_VALUES_KERNEL(ValueType, IndexType)  \
+    void scatter_values(std::shared_ptr<const DefaultExecutor> exec, \
+                        const Array<ValueType> &values,              \
+                        const Array<IndexType> &positions,           \
+                        matrix::Csr<ValueType, IndexType> *mtx)
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES                                         \
     template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_SPMV_KERNEL(ValueType, IndexType);                       \
@@ -177,6 +194,8 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL(ValueType, IndexType);            \
     template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL(ValueType, IndexType);             \
+    template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_CONVERT_TO_DENSE_KERNEL(ValueType, IndexType);           \
     template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_CONVERT_TO_COO_KERNEL(ValueType, IndexType);             \
@@ -207,7 +226,11 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_SORT_BY_COLUMN_INDEX(ValueType, IndexType);              \
     template <typename ValueType, typename IndexType>                        \
-    GKO_DECLARE_CSR_IS_SORTED_BY_COLUMN_INDEX(ValueType, IndexType)
+    GKO_DECLARE_CSR_IS_SORTED_BY_COLUMN_INDEX(ValueType, IndexType);         \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_CSR_EXTRACT_DIAGONAL(ValueType, IndexType);                  \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_CSR_SCATTER_VALUES_KERNEL(ValueType, IndexType)
 
 
 namespace omp {
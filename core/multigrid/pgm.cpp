@@ -0,0 +1,208 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/multigrid/pgm.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/csr_kernels.hpp"
+#include "core/multigrid/pgm_kernels.hpp"
+
+
+namespace gko {
+namespace multigrid {
+namespace pgm {
+
+
+GKO_REGISTER_OPERATION(initialize_agg, pgm::initialize_agg);
+GKO_REGISTER_OPERATION(find_strongest_neighbor, pgm::find_strongest_neighbor);
+GKO_REGISTER_OPERATION(match_edge, pgm::match_edge);
+GKO_REGISTER_OPERATION(count_unagg, pgm::count_unagg);
+GKO_REGISTER_OPERATION(assign_to_exist_agg, pgm::assign_to_exist_agg);
+GKO_REGISTER_OPERATION(renumber, pgm::renumber);
+GKO_REGISTER_OPERATION(fill_tentative_prolong, pgm::fill_tentative_prolong);
+GKO_REGISTER_OPERATION(scale_by_inverse_diag, pgm::scale_by_inverse_diag);
+GKO_REGISTER_OPERATION(extract_diagonal, csr::extract_diagonal);
+
+
+}  // namespace pgm
+
+
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::generate()
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using Vector = matrix::Dense<ValueType>;
+
+    const auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+
+    // Only copies the matrix if it is not on the same executor or was not in
+    // the right format. Throws an exception if it is not convertable.
+    std::shared_ptr<const CsrMatrix> csr_mtx =
+        std::dynamic_pointer_cast<const CsrMatrix>(system_matrix_);
+    if (csr_mtx == nullptr || csr_mtx->get_executor() != exec) {
+        auto converted = CsrMatrix::create(exec);
+        as<ConvertibleTo<CsrMatrix>>(system_matrix_.get())
+            ->convert_to(converted.get());
+        csr_mtx = std::move(converted);
+    }
+
+    Array<ValueType> diag{exec, num_rows};
+    exec->run(pgm::make_extract_diagonal(csr_mtx.get(), diag));
+
+    // Matching phase: pair up mutually strongest neighbors until (almost)
+    // everything is aggregated or no further progress is made
+    Array<IndexType> strongest_neighbor{exec, num_rows};
+    exec->run(pgm::make_initialize_agg(agg_));
+    auto num_unagg = static_cast<IndexType>(num_rows);
+    for (unsigned iter = 0; iter < parameters_.max_iterations; ++iter) {
+        exec->run(pgm::make_find_strongest_neighbor(csr_mtx.get(), diag, agg_,
+                                                    strongest_neighbor));
+        exec->run(pgm::make_match_edge(strongest_neighbor, agg_));
+        const auto prev_num_unagg = num_unagg;
+        exec->run(pgm::make_count_unagg(agg_, &num_unagg));
+        if (num_unagg == prev_num_unagg ||
+            num_unagg < parameters_.max_unassigned_ratio * num_rows) {
+            break;
+        }
+    }
+    if (num_unagg > 0) {
+        // strongest_neighbor is no longer needed and has the right size
+        exec->run(pgm::make_assign_to_exist_agg(csr_mtx.get(), diag, agg_,
+                                                strongest_neighbor));
+    }
+    IndexType num_agg{};
+    exec->run(pgm::make_renumber(agg_, &num_agg));
+    const auto coarse_dim = static_cast<size_type>(num_agg);
+
+    std::shared_ptr<CsrMatrix> prolong =
+        CsrMatrix::create(exec, dim<2>{num_rows, coarse_dim}, num_rows);
+    exec->run(pgm::make_fill_tentative_prolong(agg_, prolong.get()));
+    if (parameters_.smoothed_prolongation) {
+        // P = P_tent - omega * D^{-1} A P_tent, where omega is scaled by
+        // the Gershgorin bound of the spectral radius of D^{-1} A
+        auto scaled_mtx = csr_mtx->clone();
+        auto max_row_sum = zero<remove_complex<ValueType>>();
+        exec->run(pgm::make_scale_by_inverse_diag(diag, scaled_mtx.get(),
+                                                  &max_row_sum));
+        const auto weight =
+            max_row_sum == zero<remove_complex<ValueType>>()
+                ? zero<remove_complex<ValueType>>()
+                : parameters_.prolongation_smoothing_weight / max_row_sum;
+        auto neg_weight = initialize<Vector>({-ValueType{weight}}, exec);
+        auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+        auto tentative = prolong->clone();
+        scaled_mtx->apply(lend(neg_weight), lend(tentative), lend(one_op),
+                          lend(prolong));
+        prolong->sort_by_column_index();
+    }
+    // The restriction is the conjugate transpose, so the coarse operator of
+    // a Hermitian matrix stays Hermitian even for a complex smoothed
+    // prolongation. The result of `conj_transpose()` is guaranteed to be a
+    // CsrMatrix
+    std::shared_ptr<CsrMatrix> restrict{
+        static_cast<CsrMatrix *>(prolong->conj_transpose().release())};
+
+    // Galerkin product A_c = R (A P)
+    auto ap = CsrMatrix::create(exec, dim<2>{num_rows, coarse_dim});
+    csr_mtx->apply(lend(prolong), lend(ap));
+    std::shared_ptr<CsrMatrix> coarse =
+        CsrMatrix::create(exec, dim<2>{coarse_dim, coarse_dim});
+    restrict->apply(lend(ap), lend(coarse));
+    coarse->sort_by_column_index();
+
+    prolong_op_ = std::move(prolong);
+    restrict_op_ = std::move(restrict);
+    coarse_op_ = std::move(coarse);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+
+    const auto exec = this->get_executor();
+    const auto num_rhs = b->get_size()[1];
+    const auto coarse_dim = coarse_op_->get_size()[0];
+    const auto coarse_size = dim<2>{coarse_dim, num_rhs};
+    if (cache_.coarse_b == nullptr ||
+        cache_.coarse_b->get_size() != coarse_size) {
+        cache_.coarse_b = Vector::create(exec, coarse_size);
+        cache_.coarse_x = Vector::create(exec, coarse_size);
+    }
+    auto coarse_b = cache_.coarse_b.get();
+    auto coarse_x = cache_.coarse_x.get();
+
+    restrict_op_->apply(b, coarse_b);
+    coarse_op_->apply(coarse_b, coarse_x);
+    prolong_op_->apply(coarse_x, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                           const LinOp *beta, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    auto dense_x = as<Vector>(x);
+
+    if (cache_.x_copy == nullptr ||
+        cache_.x_copy->get_size() != dense_x->get_size()) {
+        cache_.x_copy =
+            Vector::create(this->get_executor(), dense_x->get_size());
+    }
+    auto x_copy = cache_.x_copy.get();
+    this->apply(b, x_copy);
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_copy);
+}
+
+
+#define GKO_DECLARE_PGM(ValueType, IndexType) class Pgm<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM);
+
+
+}  // namespace multigrid
+}  // namespace gko
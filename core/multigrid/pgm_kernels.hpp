@@ -0,0 +1,160 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MULTIGRID_PGM_KERNELS_HPP_
+#define GKO_CORE_MULTIGRID_PGM_KERNELS_HPP_
+
+
+#include <ginkgo/core/multigrid/pgm.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_PGM_INITIALIZE_AGG_KERNEL(IndexType)             \
+    void initialize_agg(std::shared_ptr<const DefaultExecutor> exec, \
+                        Array<IndexType> &agg)
+
+#define GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR_KERNEL(ValueType, IndexType) \
+    void find_strongest_neighbor(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                         \
+        const matrix::Csr<ValueType, IndexType> *source,                     \
+        const Array<ValueType> &diag, const Array<IndexType> &agg,           \
+        Array<IndexType> &strongest_neighbor)
+
+#define GKO_DECLARE_PGM_MATCH_EDGE_KERNEL(IndexType)             \
+    void match_edge(std::shared_ptr<const DefaultExecutor> exec, \
+                    const Array<IndexType> &strongest_neighbor,  \
+                    Array<IndexType> &agg)
+
+#define GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL(IndexType)             \
+    void count_unagg(std::shared_ptr<const DefaultExecutor> exec, \
+                     const Array<IndexType> &agg, IndexType *num_unagg)
+
+#define GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG_KERNEL(ValueType, IndexType) \
+    void assign_to_exist_agg(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                     \
+        const matrix::Csr<ValueType, IndexType> *source,                 \
+        const Array<ValueType> &diag, Array<IndexType> &agg,             \
+        Array<IndexType> &intermediate_agg)
+
+#define GKO_DECLARE_PGM_RENUMBER_KERNEL(IndexType)             \
+    void renumber(std::shared_ptr<const DefaultExecutor> exec, \
+                  Array<IndexType> &agg, IndexType *num_agg)
+
+#define GKO_DECLARE_PGM_FILL_TENTATIVE_PROLONG_KERNEL(ValueType, IndexType) \
+    void fill_tentative_prolong(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const Array<IndexType> &agg,                                        \
+        matrix::Csr<ValueType, IndexType> *prolong)
+
+#define GKO_DECLARE_PGM_SCALE_BY_INVERSE_DIAG_KERNEL(ValueType, IndexType)  \
+    void scale_by_inverse_diag(std::shared_ptr<const DefaultExecutor> exec, \
+                               const Array<ValueType> &diag,                \
+                               matrix::Csr<ValueType, IndexType> *mtx,      \
+                               remove_complex<ValueType> *max_row_sum)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                      \
+    template <typename IndexType>                                         \
+    GKO_DECLARE_PGM_INITIALIZE_AGG_KERNEL(IndexType);                     \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR_KERNEL(ValueType, IndexType); \
+    template <typename IndexType>                                         \
+    GKO_DECLARE_PGM_MATCH_EDGE_KERNEL(IndexType);                         \
+    template <typename IndexType>                                         \
+    GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL(IndexType);                        \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG_KERNEL(ValueType, IndexType);     \
+    template <typename IndexType>                                         \
+    GKO_DECLARE_PGM_RENUMBER_KERNEL(IndexType);                           \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_PGM_FILL_TENTATIVE_PROLONG_KERNEL(ValueType, IndexType);  \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_PGM_SCALE_BY_INVERSE_DIAG_KERNEL(ValueType, IndexType)
+
+
+namespace omp {
+namespace pgm {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace pgm
+}  // namespace omp
+
+
+namespace cuda {
+namespace pgm {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace pgm
+}  // namespace cuda
+
+
+namespace reference {
+namespace pgm {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace pgm
+}  // namespace reference
+
+
+namespace hip {
+namespace pgm {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace pgm
+}  // namespace hip
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_PGM_KERNELS_HPP_
@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/preconditioner/jacobi.hpp>
 
 
+#include <numeric>
+
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
@@ -42,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "core/base/extended_float.hpp"
+#include "core/matrix/csr_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
 #include "core/preconditioner/jacobi_utils.hpp"
 
@@ -57,6 +61,10 @@ GKO_REGISTER_OPERATION(find_blocks, jacobi::find_blocks);
 GKO_REGISTER_OPERATION(generate, jacobi::generate);
 GKO_REGISTER_OPERATION(convert_to_dense, jacobi::convert_to_dense);
 GKO_REGISTER_OPERATION(initialize_precisions, jacobi::initialize_precisions);
+GKO_REGISTER_OPERATION(extract_diagonal, csr::extract_diagonal);
+GKO_REGISTER_OPERATION(invert_diagonal, jacobi::invert_diagonal);
+GKO_REGISTER_OPERATION(scalar_apply, jacobi::scalar_apply);
+GKO_REGISTER_OPERATION(simple_scalar_apply, jacobi::simple_scalar_apply);
 
 
 }  // namespace jacobi
@@ -66,6 +74,11 @@ template <typename ValueType, typename IndexType>
 void Jacobi<ValueType, IndexType>::apply_impl(const LinOp *b, LinOp *x) const
 {
     using dense = matrix::Dense<ValueType>;
+    if (this->is_scalar()) {
+        this->get_executor()->run(jacobi::make_simple_scalar_apply(
+            blocks_, as<dense>(b), as<dense>(x)));
+        return;
+    }
     this->get_executor()->run(jacobi::make_simple_apply(
         num_blocks_, parameters_.max_block_size, storage_scheme_,
         parameters_.storage_optimization.block_wise, parameters_.block_pointers,
@@ -79,6 +92,12 @@ void Jacobi<ValueType, IndexType>::apply_impl(const LinOp *alpha,
                                               LinOp *x) const
 {
     using dense = matrix::Dense<ValueType>;
+    if (this->is_scalar()) {
+        this->get_executor()->run(jacobi::make_scalar_apply(
+            blocks_, as<dense>(alpha), as<dense>(b), as<dense>(beta),
+            as<dense>(x)));
+        return;
+    }
     this->get_executor()->run(jacobi::make_apply(
         num_blocks_, parameters_.max_block_size, storage_scheme_,
         parameters_.storage_optimization.block_wise, parameters_.block_pointers,
@@ -92,6 +111,14 @@ void Jacobi<ValueType, IndexType>::convert_to(
     matrix::Dense<ValueType> *result) const
 {
     auto exec = this->get_executor();
+    if (this->is_scalar()) {
+        mat_data data;
+        this->write(data);
+        auto tmp = matrix::Dense<ValueType>::create(exec);
+        tmp->read(data);
+        tmp->move_to(result);
+        return;
+    }
     auto tmp = matrix::Dense<ValueType>::create(exec, this->get_size());
     exec->run(jacobi::make_convert_to_dense(
         num_blocks_, parameters_.storage_optimization.block_wise,
@@ -115,6 +142,14 @@ void Jacobi<ValueType, IndexType>::write(mat_data &data) const
         make_temporary_clone(this->get_executor()->get_master(), this);
     data = {local_clone->get_size(), {}};
 
+    if (local_clone->is_scalar()) {
+        const auto diag = local_clone->blocks_.get_const_data();
+        for (size_type row = 0; row < local_clone->get_num_blocks(); ++row) {
+            data.nonzeros.emplace_back(row, row, diag[row]);
+        }
+        return;
+    }
+
     const auto ptrs = local_clone->parameters_.block_pointers.get_const_data();
     for (size_type block = 0; block < local_clone->get_num_blocks(); ++block) {
         const auto scheme = local_clone->get_storage_scheme();
@@ -165,6 +200,20 @@ void Jacobi<ValueType, IndexType>::generate(const LinOp *system_matrix)
     const auto csr_mtx = copy_and_convert_to<matrix::Csr<ValueType, IndexType>>(
         exec, system_matrix);
 
+    if (this->is_scalar()) {
+        num_blocks_ = csr_mtx->get_size()[0];
+        if (parameters_.block_pointers.get_data() == nullptr) {
+            // every row forms its own block
+            Array<IndexType> block_ptrs(exec->get_master(), num_blocks_ + 1);
+            std::iota(block_ptrs.get_data(),
+                      block_ptrs.get_data() + num_blocks_ + 1, IndexType{});
+            parameters_.block_pointers = block_ptrs;
+        }
+        blocks_.resize_and_reset(num_blocks_);
+        this->compute_blocks(csr_mtx.get());
+        return;
+    }
+
     if (parameters_.block_pointers.get_data() == nullptr) {
         this->detect_blocks(csr_mtx.get());
     }
@@ -182,12 +231,44 @@ void Jacobi<ValueType, IndexType>::generate(const LinOp *system_matrix)
             exec, parameters_.block_pointers.get_num_elems() - 1);
         exec->run(jacobi::make_initialize_precisions(precisions, tmp));
         precisions = std::move(tmp);
+        // the generate kernel replaces the hints with the chosen precisions,
+        // keep them around for update_values
+        precision_hints_ = precisions;
         conditioning_.resize_and_reset(num_blocks_);
     }
 
+    this->compute_blocks(csr_mtx.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::update_values(const LinOp *system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    const auto exec = this->get_executor();
+    const auto csr_mtx = copy_and_convert_to<matrix::Csr<ValueType, IndexType>>(
+        exec, system_matrix);
+    if (precision_hints_.get_num_elems() > 0) {
+        parameters_.storage_optimization.block_wise = precision_hints_;
+    }
+    this->compute_blocks(csr_mtx.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::compute_blocks(
+    const matrix::Csr<ValueType, IndexType> *system_matrix)
+{
+    const auto exec = this->get_executor();
+    if (this->is_scalar()) {
+        exec->run(jacobi::make_extract_diagonal(system_matrix, blocks_));
+        exec->run(jacobi::make_invert_diagonal(blocks_));
+        return;
+    }
     exec->run(jacobi::make_generate(
-        csr_mtx.get(), num_blocks_, parameters_.max_block_size,
-        parameters_.accuracy, storage_scheme_, conditioning_, precisions,
+        system_matrix, num_blocks_, parameters_.max_block_size,
+        parameters_.accuracy, storage_scheme_, conditioning_,
+        parameters_.storage_optimization.block_wise,
         parameters_.block_pointers, blocks_));
 }
 
@@ -83,6 +83,24 @@ namespace kernels {
         const Array<ValueType> &blocks, const matrix::Dense<ValueType> *b, \
         matrix::Dense<ValueType> *x)
 
+#define GKO_DECLARE_JACOBI_INVERT_DIAGONAL_KERNEL(ValueType)              \
+    void invert_diagonal(std::shared_ptr<const DefaultExecutor> exec, \
+                         Array<ValueType> &diag)
+
+#define GKO_DECLARE_JACOBI_SCALAR_APPLY_KERNEL(ValueType)                   \
+    void scalar_apply(std::shared_ptr<const DefaultExecutor> exec,          \
+                      const Array<ValueType> &inverse_diag,                 \
+                      const matrix::Dense<ValueType> *alpha,                \
+                      const matrix::Dense<ValueType> *b,                    \
+                      const matrix::Dense<ValueType> *beta,                 \
+                      matrix::Dense<ValueType> *x)
+
+#define GKO_DECLARE_JACOBI_SIMPLE_SCALAR_APPLY_KERNEL(ValueType)            \
+    void simple_scalar_apply(std::shared_ptr<const DefaultExecutor> exec,   \
+                             const Array<ValueType> &inverse_diag,          \
+                             const matrix::Dense<ValueType> *b,             \
+                             matrix::Dense<ValueType> *x)
+
 #define GKO_DECLARE_JACOBI_CONVERT_TO_DENSE_KERNEL(ValueType, IndexType)   \
     void convert_to_dense(                                                 \
         std::shared_ptr<const DefaultExecutor> exec, size_type num_blocks, \
@@ -109,6 +127,12 @@ namespace kernels {
     GKO_DECLARE_JACOBI_SIMPLE_APPLY_KERNEL(ValueType, IndexType);     \
     template <typename ValueType, typename IndexType>                 \
     GKO_DECLARE_JACOBI_CONVERT_TO_DENSE_KERNEL(ValueType, IndexType); \
+    template <typename ValueType>                                     \
+    GKO_DECLARE_JACOBI_INVERT_DIAGONAL_KERNEL(ValueType);             \
+    template <typename ValueType>                                     \
+    GKO_DECLARE_JACOBI_SCALAR_APPLY_KERNEL(ValueType);                \
+    template <typename ValueType>                                     \
+    GKO_DECLARE_JACOBI_SIMPLE_SCALAR_APPLY_KERNEL(ValueType);         \
     GKO_DECLARE_JACOBI_INITIALIZE_PRECISIONS_KERNEL()
 
 
@@ -67,105 +67,114 @@ void Bicgstab<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     constexpr uint8 RelativeStoppingId{1};
 
     auto exec = this->get_executor();
+    auto &workspace = this->get_workspace();
 
-    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
-    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+    auto one_op = workspace.get_constant(exec, 0, one<ValueType>());
+    auto neg_one_op = workspace.get_constant(exec, 1, -one<ValueType>());
 
     auto dense_b = as<Vector>(b);
     auto dense_x = as<Vector>(x);
-    auto r = Vector::create_with_config_of(dense_b);
-    auto z = Vector::create_with_config_of(dense_b);
-    auto y = Vector::create_with_config_of(dense_b);
-    auto v = Vector::create_with_config_of(dense_b);
-    auto s = Vector::create_with_config_of(dense_b);
-    auto t = Vector::create_with_config_of(dense_b);
-    auto p = Vector::create_with_config_of(dense_b);
-    auto rr = Vector::create_with_config_of(dense_b);
-
-    auto alpha = Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
-    auto beta = Vector::create_with_config_of(alpha.get());
-    auto gamma = Vector::create_with_config_of(alpha.get());
-    auto prev_rho = Vector::create_with_config_of(alpha.get());
-    auto rho = Vector::create_with_config_of(alpha.get());
-    auto omega = Vector::create_with_config_of(alpha.get());
+    const auto vector_size = dense_b->get_size();
+    const auto scalar_size = dim<2>{1, vector_size[1]};
+    auto r = workspace.get_vector<ValueType>(exec, 0, vector_size);
+    auto z = workspace.get_vector<ValueType>(exec, 1, vector_size);
+    auto y = workspace.get_vector<ValueType>(exec, 2, vector_size);
+    auto v = workspace.get_vector<ValueType>(exec, 3, vector_size);
+    auto s = workspace.get_vector<ValueType>(exec, 4, vector_size);
+    auto t = workspace.get_vector<ValueType>(exec, 5, vector_size);
+    auto p = workspace.get_vector<ValueType>(exec, 6, vector_size);
+    auto rr = workspace.get_vector<ValueType>(exec, 7, vector_size);
+
+    auto alpha = workspace.get_vector<ValueType>(exec, 8, scalar_size);
+    auto beta = workspace.get_vector<ValueType>(exec, 9, scalar_size);
+    auto gamma = workspace.get_vector<ValueType>(exec, 10, scalar_size);
+    auto prev_rho = workspace.get_vector<ValueType>(exec, 11, scalar_size);
+    auto rho = workspace.get_vector<ValueType>(exec, 12, scalar_size);
+    auto omega = workspace.get_vector<ValueType>(exec, 13, scalar_size);
+    auto residual_norm =
+        workspace.get_vector<ValueType>(exec, 14, scalar_size);
+    auto s_norm = workspace.get_vector<ValueType>(exec, 15, scalar_size);
 
     bool one_changed{};
-    Array<stopping_status> stop_status(alpha->get_executor(),
-                                       dense_b->get_size()[1]);
+    auto &stop_status =
+        workspace.get_array<stopping_status>(exec, 0, vector_size[1]);
 
     // TODO: replace this with automatic merged kernel generator
-    exec->run(bicgstab::make_initialize(
-        dense_b, r.get(), rr.get(), y.get(), s.get(), t.get(), z.get(), v.get(),
-        p.get(), prev_rho.get(), rho.get(), alpha.get(), beta.get(),
-        gamma.get(), omega.get(), &stop_status));
+    exec->run(bicgstab::make_initialize(dense_b, r, rr, y, s, t, z, v, p,
+                                        prev_rho, rho, alpha, beta, gamma,
+                                        omega, &stop_status));
     // r = dense_b
     // prev_rho = rho = omega = alpha = beta = gamma = 1.0
     // rr = v = s = t = z = y = p = 0
     // stop_status = 0x00
 
-    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(), r.get());
+    system_matrix_->apply(neg_one_op, dense_x, one_op, r);
     auto stop_criterion = stop_criterion_factory_->generate(
         system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
-        x, r.get());
-    rr->copy_from(r.get());
+        x, r);
+    rr->copy_from(r);
+    // later values of rho and the residual norm are computed by step_3 while
+    // updating r
+    rr->compute_dot(r, rho);
+    r->compute_norm2(residual_norm);
 
     int iter = -1;
     while (true) {
         ++iter;
-        this->template log<log::Logger::iteration_complete>(this, iter, r.get(),
+        this->template log<log::Logger::iteration_complete>(this, iter, r,
                                                             dense_x);
         if (stop_criterion->update()
                 .num_iterations(iter)
-                .residual(r.get())
+                .residual(r)
+                .residual_norm(residual_norm)
                 .solution(dense_x)
                 .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
             break;
         }
 
-        rr->compute_dot(r.get(), rho.get());
-
-        exec->run(bicgstab::make_step_1(r.get(), p.get(), v.get(), rho.get(),
-                                        prev_rho.get(), alpha.get(),
-                                        omega.get(), &stop_status));
+        exec->run(bicgstab::make_step_1(r, p, v, rho, prev_rho, alpha, omega,
+                                        &stop_status));
         // tmp = rho / prev_rho * alpha / omega
         // p = r + tmp * (p - omega * v)
 
-        get_preconditioner()->apply(p.get(), y.get());
-        system_matrix_->apply(y.get(), v.get());
-        rr->compute_dot(v.get(), beta.get());
-        exec->run(bicgstab::make_step_2(r.get(), s.get(), v.get(), rho.get(),
-                                        alpha.get(), beta.get(), &stop_status));
+        get_preconditioner()->apply(p, y);
+        system_matrix_->apply(y, v);
+        rr->compute_dot(v, beta);
+        exec->run(bicgstab::make_step_2(r, s, v, rho, alpha, beta, s_norm,
+                                        &stop_status));
         // alpha = rho / beta
         // s = r - alpha * v
+        // s_norm = norm2(s)
 
         ++iter;
         auto all_converged =
             stop_criterion->update()
                 .num_iterations(iter)
-                .residual(s.get())
+                .residual(s)
+                .residual_norm(s_norm)
                 // .solution(dense_x) // outdated at this point
                 .check(RelativeStoppingId, false, &stop_status, &one_changed);
         if (one_changed) {
-            exec->run(bicgstab::make_finalize(dense_x, y.get(), alpha.get(),
-                                              &stop_status));
+            exec->run(bicgstab::make_finalize(dense_x, y, alpha, &stop_status));
         }
-        this->template log<log::Logger::iteration_complete>(this, iter,
-                                                            r.get());
+        this->template log<log::Logger::iteration_complete>(this, iter, r);
         if (all_converged) {
             break;
         }
 
-        get_preconditioner()->apply(s.get(), z.get());
-        system_matrix_->apply(z.get(), t.get());
-        s->compute_dot(t.get(), gamma.get());
-        t->compute_dot(t.get(), beta.get());
-        exec->run(bicgstab::make_step_3(
-            dense_x, r.get(), s.get(), t.get(), y.get(), z.get(), alpha.get(),
-            beta.get(), gamma.get(), omega.get(), &stop_status));
+        get_preconditioner()->apply(s, z);
+        system_matrix_->apply(z, t);
+        s->compute_dot(t, gamma);
+        t->compute_dot(t, beta);
+        swap(prev_rho, rho);
+        exec->run(bicgstab::make_step_3(dense_x, r, s, t, y, z, alpha, beta,
+                                        gamma, omega, rr, rho, residual_norm,
+                                        &stop_status));
         // omega = gamma / beta
         // x = x + alpha * y + omega * z
         // r = s - omega * t
-        swap(prev_rho, rho);
+        // rho = dot(rr, r)
+        // residual_norm = norm2(r)
     }
 }  // namespace solver
 
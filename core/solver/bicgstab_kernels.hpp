@@ -75,6 +75,7 @@ namespace bicgstab {
                 const matrix::Dense<_type> *v,                                \
                 const matrix::Dense<_type> *rho, matrix::Dense<_type> *alpha, \
                 const matrix::Dense<_type> *beta,                             \
+                matrix::Dense<_type> *s_norm,                                 \
                 const Array<stopping_status> *stop_status)
 
 
@@ -85,7 +86,8 @@ namespace bicgstab {
         const matrix::Dense<_type> *t, const matrix::Dense<_type> *y,         \
         const matrix::Dense<_type> *z, const matrix::Dense<_type> *alpha,     \
         const matrix::Dense<_type> *beta, const matrix::Dense<_type> *gamma,  \
-        matrix::Dense<_type> *omega,                                          \
+        matrix::Dense<_type> *omega, const matrix::Dense<_type> *rr,          \
+        matrix::Dense<_type> *rho, matrix::Dense<_type> *residual_norm,       \
         const Array<stopping_status> *stop_status)
 
 
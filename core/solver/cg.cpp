@@ -68,66 +68,74 @@ void Cg<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     constexpr uint8 RelativeStoppingId{1};
 
     auto exec = this->get_executor();
+    auto &workspace = this->get_workspace();
 
-    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
-    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+    auto one_op = workspace.get_constant(exec, 0, one<ValueType>());
+    auto neg_one_op = workspace.get_constant(exec, 1, -one<ValueType>());
 
     auto dense_b = as<const Vector>(b);
     auto dense_x = as<Vector>(x);
-    auto r = Vector::create_with_config_of(dense_b);
-    auto z = Vector::create_with_config_of(dense_b);
-    auto p = Vector::create_with_config_of(dense_b);
-    auto q = Vector::create_with_config_of(dense_b);
-
-    auto alpha = Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
-    auto beta = Vector::create_with_config_of(alpha.get());
-    auto prev_rho = Vector::create_with_config_of(alpha.get());
-    auto rho = Vector::create_with_config_of(alpha.get());
+    const auto vector_size = dense_b->get_size();
+    const auto scalar_size = dim<2>{1, vector_size[1]};
+    auto r = workspace.get_vector<ValueType>(exec, 0, vector_size);
+    auto z = workspace.get_vector<ValueType>(exec, 1, vector_size);
+    auto p = workspace.get_vector<ValueType>(exec, 2, vector_size);
+    auto q = workspace.get_vector<ValueType>(exec, 3, vector_size);
+
+    auto alpha = workspace.get_vector<ValueType>(exec, 4, scalar_size);
+    auto beta = workspace.get_vector<ValueType>(exec, 5, scalar_size);
+    auto prev_rho = workspace.get_vector<ValueType>(exec, 6, scalar_size);
+    auto rho = workspace.get_vector<ValueType>(exec, 7, scalar_size);
+    auto residual_norm =
+        workspace.get_vector<ValueType>(exec, 8, scalar_size);
 
     bool one_changed{};
-    Array<stopping_status> stop_status(alpha->get_executor(),
-                                       dense_b->get_size()[1]);
+    auto &stop_status =
+        workspace.get_array<stopping_status>(exec, 0, vector_size[1]);
 
     // TODO: replace this with automatic merged kernel generator
-    exec->run(cg::make_initialize(dense_b, r.get(), z.get(), p.get(), q.get(),
-                                  prev_rho.get(), rho.get(), &stop_status));
+    exec->run(cg::make_initialize(dense_b, r, z, p, q, prev_rho, rho,
+                                  &stop_status));
     // r = dense_b
     // rho = 0.0
     // prev_rho = 1.0
     // z = p = q = 0
 
-    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(), r.get());
+    system_matrix_->apply(neg_one_op, dense_x, one_op, r);
     auto stop_criterion = stop_criterion_factory_->generate(
         system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
-        x, r.get());
+        x, r);
+    // later residual norms are computed by step_2 while updating r
+    r->compute_norm2(residual_norm);
 
     int iter = -1;
     while (true) {
-        get_preconditioner()->apply(r.get(), z.get());
-        r->compute_dot(z.get(), rho.get());
+        get_preconditioner()->apply(r, z);
+        r->compute_dot(z, rho);
 
         ++iter;
-        this->template log<log::Logger::iteration_complete>(this, iter, r.get(),
+        this->template log<log::Logger::iteration_complete>(this, iter, r,
                                                             dense_x);
         if (stop_criterion->update()
                 .num_iterations(iter)
-                .residual(r.get())
+                .residual(r)
+                .residual_norm(residual_norm)
                 .solution(dense_x)
                 .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
             break;
         }
 
-        exec->run(cg::make_step_1(p.get(), z.get(), rho.get(), prev_rho.get(),
-                                  &stop_status));
+        exec->run(cg::make_step_1(p, z, rho, prev_rho, &stop_status));
         // tmp = rho / prev_rho
         // p = z + tmp * p
-        system_matrix_->apply(p.get(), q.get());
-        p->compute_dot(q.get(), beta.get());
-        exec->run(cg::make_step_2(dense_x, r.get(), p.get(), q.get(),
-                                  beta.get(), rho.get(), &stop_status));
+        system_matrix_->apply(p, q);
+        p->compute_dot(q, beta);
+        exec->run(cg::make_step_2(dense_x, r, p, q, beta, rho, residual_norm,
+                                  &stop_status));
         // tmp = rho / beta
         // x = x + tmp * p
         // r = r - tmp * q
+        // residual_norm = norm2(r)
         swap(prev_rho, rho);
     }
 }
@@ -68,6 +68,7 @@ namespace cg {
                 const matrix::Dense<_type> *p, const matrix::Dense<_type> *q, \
                 const matrix::Dense<_type> *beta,                             \
                 const matrix::Dense<_type> *rho,                              \
+                matrix::Dense<_type> *residual_norm,                          \
                 const Array<stopping_status> *stop_status)
 
 
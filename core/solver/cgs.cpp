@@ -72,81 +72,81 @@ void Cgs<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     auto exec = this->get_executor();
     size_type num_vectors = dense_b->get_size()[1];
 
-    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
-    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
-
-    auto r = Vector::create_with_config_of(dense_b);
-    auto r_tld = Vector::create_with_config_of(dense_b);
-    auto p = Vector::create_with_config_of(dense_b);
-    auto q = Vector::create_with_config_of(dense_b);
-    auto u = Vector::create_with_config_of(dense_b);
-    auto u_hat = Vector::create_with_config_of(dense_b);
-    auto v_hat = Vector::create_with_config_of(dense_b);
-    auto t = Vector::create_with_config_of(dense_b);
-
-    auto alpha = Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
-    auto beta = Vector::create_with_config_of(alpha.get());
-    auto gamma = Vector::create_with_config_of(alpha.get());
-    auto rho_prev = Vector::create_with_config_of(alpha.get());
-    auto rho = Vector::create_with_config_of(alpha.get());
+    auto &workspace = this->get_workspace();
+
+    auto one_op = workspace.get_constant(exec, 0, one<ValueType>());
+    auto neg_one_op = workspace.get_constant(exec, 1, -one<ValueType>());
+
+    const auto vector_size = dense_b->get_size();
+    const auto scalar_size = dim<2>{1, num_vectors};
+    auto r = workspace.get_vector<ValueType>(exec, 0, vector_size);
+    auto r_tld = workspace.get_vector<ValueType>(exec, 1, vector_size);
+    auto p = workspace.get_vector<ValueType>(exec, 2, vector_size);
+    auto q = workspace.get_vector<ValueType>(exec, 3, vector_size);
+    auto u = workspace.get_vector<ValueType>(exec, 4, vector_size);
+    auto u_hat = workspace.get_vector<ValueType>(exec, 5, vector_size);
+    auto v_hat = workspace.get_vector<ValueType>(exec, 6, vector_size);
+    auto t = workspace.get_vector<ValueType>(exec, 7, vector_size);
+
+    auto alpha = workspace.get_vector<ValueType>(exec, 8, scalar_size);
+    auto beta = workspace.get_vector<ValueType>(exec, 9, scalar_size);
+    auto gamma = workspace.get_vector<ValueType>(exec, 10, scalar_size);
+    auto rho_prev = workspace.get_vector<ValueType>(exec, 11, scalar_size);
+    auto rho = workspace.get_vector<ValueType>(exec, 12, scalar_size);
 
     bool one_changed{};
-    Array<stopping_status> stop_status(alpha->get_executor(),
-                                       dense_b->get_size()[1]);
+    auto &stop_status =
+        workspace.get_array<stopping_status>(exec, 0, num_vectors);
 
     // TODO: replace this with automatic merged kernel generator
-    exec->run(cgs::make_initialize(
-        dense_b, r.get(), r_tld.get(), p.get(), q.get(), u.get(), u_hat.get(),
-        v_hat.get(), t.get(), alpha.get(), beta.get(), gamma.get(),
-        rho_prev.get(), rho.get(), &stop_status));
+    exec->run(cgs::make_initialize(dense_b, r, r_tld, p, q, u, u_hat, v_hat, t,
+                                   alpha, beta, gamma, rho_prev, rho,
+                                   &stop_status));
     // r = dense_b
     // r_tld = r
     // rho = 0.0
     // rho_prev = 1.0
     // p = q = u = u_hat = v_hat = t = 0
 
-    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(), r.get());
+    system_matrix_->apply(neg_one_op, dense_x, one_op, r);
     auto stop_criterion = stop_criterion_factory_->generate(
         system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
-        x, r.get());
-    r_tld->copy_from(r.get());
+        x, r);
+    r_tld->copy_from(r);
 
     int iter = 0;
     while (true) {
-        r->compute_dot(r_tld.get(), rho.get());
-        exec->run(cgs::make_step_1(r.get(), u.get(), p.get(), q.get(),
-                                   beta.get(), rho.get(), rho_prev.get(),
+        r->compute_dot(r_tld, rho);
+        exec->run(cgs::make_step_1(r, u, p, q, beta, rho, rho_prev,
                                    &stop_status));
         // beta = rho / rho_prev
         // u = r + beta * q;
         // p = u + beta * ( q + beta * p );
-        get_preconditioner()->apply(p.get(), t.get());
-        system_matrix_->apply(t.get(), v_hat.get());
-        r_tld->compute_dot(v_hat.get(), gamma.get());
-        exec->run(cgs::make_step_2(u.get(), v_hat.get(), q.get(), t.get(),
-                                   alpha.get(), rho.get(), gamma.get(),
+        get_preconditioner()->apply(p, t);
+        system_matrix_->apply(t, v_hat);
+        r_tld->compute_dot(v_hat, gamma);
+        exec->run(cgs::make_step_2(u, v_hat, q, t, alpha, rho, gamma,
                                    &stop_status));
 
         ++iter;
-        this->template log<log::Logger::iteration_complete>(this, iter, r.get(),
+        this->template log<log::Logger::iteration_complete>(this, iter, r,
                                                             dense_x);
 
         // alpha = rho / gamma
         // q = u - alpha * v_hat
         // t = u + q
-        get_preconditioner()->apply(t.get(), u_hat.get());
-        system_matrix_->apply(u_hat.get(), t.get());
-        exec->run(cgs::make_step_3(t.get(), u_hat.get(), r.get(), dense_x,
-                                   alpha.get(), &stop_status));
+        get_preconditioner()->apply(t, u_hat);
+        system_matrix_->apply(u_hat, t);
+        exec->run(cgs::make_step_3(t, u_hat, r, dense_x, alpha, &stop_status));
         // r = r -alpha * t
         // x = x + alpha * u_hat
 
         ++iter;
-        this->template log<log::Logger::iteration_complete>(this, iter, r.get(),
+        this->template log<log::Logger::iteration_complete>(this, iter, r,
                                                             dense_x);
         if (stop_criterion->update()
                 .num_iterations(iter)
-                .residual(r.get())
+                .residual(r)
                 .solution(dense_x)
                 .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
             break;
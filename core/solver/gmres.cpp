@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/identity.hpp>
 
 
+#include "core/preconditioner/jacobi_utils.hpp"
 #include "core/solver/gmres_kernels.hpp"
 
 
@@ -58,6 +59,9 @@ GKO_REGISTER_OPERATION(initialize_1, gmres::initialize_1);
 GKO_REGISTER_OPERATION(initialize_2, gmres::initialize_2);
 GKO_REGISTER_OPERATION(step_1, gmres::step_1);
 GKO_REGISTER_OPERATION(step_2, gmres::step_2);
+GKO_REGISTER_OPERATION(initialize_2_compressed, gmres::initialize_2_compressed);
+GKO_REGISTER_OPERATION(step_1_compressed, gmres::step_1_compressed);
+GKO_REGISTER_OPERATION(step_2_compressed, gmres::step_2_compressed);
 
 
 }  // namespace gmres
@@ -89,6 +93,19 @@ void apply_preconditioner(
 }
 
 
+template <typename ValueType>
+size_type get_compressed_storage_size(precision_reduction storage_prec,
+                                      size_type num_elems)
+{
+    size_type storage_size{};
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, storage_prec,
+        storage_size = ceildiv(num_elems * sizeof(resolved_precision),
+                               sizeof(ValueType)));
+    return storage_size;
+}
+
+
 }  // namespace
 
 
@@ -102,77 +119,106 @@ void Gmres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     constexpr uint8 RelativeStoppingId{1};
 
     auto exec = this->get_executor();
+    auto &workspace = this->get_workspace();
 
-    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
-    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+    auto one_op = workspace.get_constant(exec, 0, one<ValueType>());
+    auto neg_one_op = workspace.get_constant(exec, 1, -one<ValueType>());
 
     auto dense_b = as<const Vector>(b);
     auto dense_x = as<Vector>(x);
-    auto residual = Vector::create_with_config_of(dense_b);
-    auto krylov_bases = Vector::create(
-        exec, dim<2>{system_matrix_->get_size()[1],
-                     (krylov_dim_ + 1) * dense_b->get_size()[1]});
-    auto next_krylov_basis = Vector::create_with_config_of(dense_b);
-    std::shared_ptr<matrix::Dense<ValueType>> preconditioned_vector =
-        Vector::create_with_config_of(dense_b);
-    auto hessenberg = Vector::create(
-        exec, dim<2>{krylov_dim_ + 1, krylov_dim_ * dense_b->get_size()[1]});
+    const auto vector_size = dense_b->get_size();
+    const auto num_rhs = vector_size[1];
+    const auto storage_prec = parameters_.storage_precision;
+    const bool compressed_bases =
+        storage_prec != precision_reduction(0, 0) &&
+        storage_prec != precision_reduction::autodetect();
+    const dim<2> bases_size{system_matrix_->get_size()[1],
+                            (krylov_dim_ + 1) * num_rhs};
+    auto residual = workspace.get_vector<ValueType>(exec, 0, vector_size);
+    // a compressed basis is stored in an array of reduced precision values,
+    // the regular one in a Dense matrix
+    auto krylov_bases = workspace.get_vector<ValueType>(
+        exec, 1, compressed_bases ? dim<2>{} : bases_size);
+    auto &compressed_krylov_bases = workspace.get_array<ValueType>(
+        exec, 2,
+        compressed_bases ? get_compressed_storage_size<ValueType>(
+                               storage_prec, bases_size[0] * bases_size[1])
+                         : 0);
+    auto next_krylov_basis =
+        workspace.get_vector<ValueType>(exec, 2, vector_size);
+    std::shared_ptr<matrix::Dense<ValueType>> preconditioned_vector{
+        workspace.get_vector<ValueType>(exec, 3, vector_size),
+        null_deleter<matrix::Dense<ValueType>>{}};
+    auto hessenberg = workspace.get_vector<ValueType>(
+        exec, 4, dim<2>{krylov_dim_ + 1, krylov_dim_ * num_rhs});
     auto givens_sin =
-        Vector::create(exec, dim<2>{krylov_dim_, dense_b->get_size()[1]});
+        workspace.get_vector<ValueType>(exec, 5, dim<2>{krylov_dim_, num_rhs});
     auto givens_cos =
-        Vector::create(exec, dim<2>{krylov_dim_, dense_b->get_size()[1]});
-    auto residual_norm_collection =
-        Vector::create(exec, dim<2>{krylov_dim_ + 1, dense_b->get_size()[1]});
+        workspace.get_vector<ValueType>(exec, 6, dim<2>{krylov_dim_, num_rhs});
+    auto residual_norm_collection = workspace.get_vector<ValueType>(
+        exec, 7, dim<2>{krylov_dim_ + 1, num_rhs});
     auto residual_norm =
-        Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
-    auto b_norm = Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
-    Array<size_type> final_iter_nums(this->get_executor(),
-                                     dense_b->get_size()[1]);
-    auto y = Vector::create(exec, dim<2>{krylov_dim_, dense_b->get_size()[1]});
+        workspace.get_vector<ValueType>(exec, 8, dim<2>{1, num_rhs});
+    auto b_norm = workspace.get_vector<ValueType>(exec, 9, dim<2>{1, num_rhs});
+    auto &final_iter_nums = workspace.get_array<size_type>(exec, 0, num_rhs);
+    auto y =
+        workspace.get_vector<ValueType>(exec, 10, dim<2>{krylov_dim_, num_rhs});
+    // scratch space for the projections of classical Gram-Schmidt, so the
+    // Arnoldi steps do not allocate
+    auto projection = workspace.get_vector<ValueType>(
+        exec, 13, dim<2>{krylov_dim_ + 1, num_rhs});
+    // scratch space of the reductions in the Arnoldi steps, its size is
+    // chosen by the kernels
+    auto &reduction_workspace = workspace.get_scratch_array<ValueType>(exec, 3);
 
     bool one_changed{};
-    Array<stopping_status> stop_status(this->get_executor(),
-                                       dense_b->get_size()[1]);
+    auto &stop_status = workspace.get_array<stopping_status>(exec, 1, num_rhs);
 
     // Initialization
-    exec->run(gmres::make_initialize_1(dense_b, b_norm.get(), residual.get(),
-                                       givens_sin.get(), givens_cos.get(),
-                                       &stop_status, krylov_dim_));
+    exec->run(gmres::make_initialize_1(dense_b, b_norm, residual, givens_sin,
+                                       givens_cos, &stop_status, krylov_dim_));
     // b_norm = norm(b)
     // residual = dense_b
     // givens_sin = givens_cos = 0
-    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(),
-                          residual.get());
+    system_matrix_->apply(neg_one_op, dense_x, one_op, residual);
     // residual = residual - Ax
 
-    exec->run(gmres::make_initialize_2(
-        residual.get(), residual_norm.get(), residual_norm_collection.get(),
-        krylov_bases.get(), &final_iter_nums, krylov_dim_));
+    if (compressed_bases) {
+        exec->run(gmres::make_initialize_2_compressed(
+            residual, residual_norm, residual_norm_collection,
+            next_krylov_basis, &compressed_krylov_bases, storage_prec,
+            &final_iter_nums, krylov_dim_));
+    } else {
+        exec->run(gmres::make_initialize_2(
+            residual, residual_norm, residual_norm_collection, krylov_bases,
+            &final_iter_nums, krylov_dim_));
+    }
     // residual_norm = norm(residual)
     // residual_norm_collection = {residual_norm, 0, ..., 0}
     // krylov_bases(:, 1) = residual / residual_norm
     // final_iter_nums = {0, ..., 0}
+    // (compressed: next_krylov_basis = krylov_bases(:, 1))
 
     auto stop_criterion = stop_criterion_factory_->generate(
         system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
-        x, residual.get());
+        x, residual);
 
     int total_iter = -1;
     size_type restart_iter = 0;
 
     auto before_preconditioner =
-        matrix::Dense<ValueType>::create_with_config_of(dense_x);
+        workspace.get_vector<ValueType>(exec, 11, vector_size);
     auto after_preconditioner =
-        matrix::Dense<ValueType>::create_with_config_of(dense_x);
+        workspace.get_vector<ValueType>(exec, 12, vector_size);
 
     while (true) {
         ++total_iter;
         this->template log<log::Logger::iteration_complete>(
-            this, total_iter, residual.get(), dense_x, residual_norm.get());
+            this, total_iter, residual, dense_x, residual_norm);
         if (stop_criterion->update()
                 .num_iterations(total_iter)
-                .residual(residual.get())
-                .residual_norm(residual_norm.get())
+                .residual(residual)
+                .residual_norm(residual_norm)
                 .solution(dense_x)
                 .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
             break;
@@ -180,27 +226,38 @@ void Gmres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
 
         if (restart_iter == krylov_dim_) {
             // Restart
-            exec->run(gmres::make_step_2(residual_norm_collection.get(),
-                                         krylov_bases.get(), hessenberg.get(),
-                                         y.get(), before_preconditioner.get(),
-                                         &final_iter_nums));
+            if (compressed_bases) {
+                exec->run(gmres::make_step_2_compressed(
+                    residual_norm_collection, &compressed_krylov_bases,
+                    storage_prec, hessenberg, y, before_preconditioner,
+                    &final_iter_nums, krylov_dim_));
+            } else {
+                exec->run(gmres::make_step_2(
+                    residual_norm_collection, krylov_bases, hessenberg, y,
+                    before_preconditioner, &final_iter_nums));
+            }
             // Solve upper triangular.
             // y = hessenberg \ residual_norm_collection
 
-            get_preconditioner()->apply(before_preconditioner.get(),
-                                        after_preconditioner.get());
-            dense_x->add_scaled(one_op.get(), after_preconditioner.get());
+            get_preconditioner()->apply(before_preconditioner,
+                                        after_preconditioner);
+            dense_x->add_scaled(one_op, after_preconditioner);
             // Solve x
             // x = x + get_preconditioner() * krylov_bases * y
             residual->copy_from(dense_b);
             // residual = dense_b
-            system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(),
-                                  residual.get());
+            system_matrix_->apply(neg_one_op, dense_x, one_op, residual);
             // residual = residual - Ax
-            exec->run(gmres::make_initialize_2(
-                residual.get(), residual_norm.get(),
-                residual_norm_collection.get(), krylov_bases.get(),
-                &final_iter_nums, krylov_dim_));
+            if (compressed_bases) {
+                exec->run(gmres::make_initialize_2_compressed(
+                    residual, residual_norm, residual_norm_collection,
+                    next_krylov_basis, &compressed_krylov_bases, storage_prec,
+                    &final_iter_nums, krylov_dim_));
+            } else {
+                exec->run(gmres::make_initialize_2(
+                    residual, residual_norm, residual_norm_collection,
+                    krylov_bases, &final_iter_nums, krylov_dim_));
+            }
             // residual_norm = norm(residual)
             // residual_norm_collection = {residual_norm, 0, ..., 0}
             // krylov_bases(:, 1) = residual / residual_norm
@@ -208,8 +265,15 @@ void Gmres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
             restart_iter = 0;
         }
 
-        apply_preconditioner(get_preconditioner().get(), krylov_bases.get(),
-                             preconditioned_vector, restart_iter);
+        if (compressed_bases) {
+            // next_krylov_basis holds krylov_bases(:, restart_iter) as it was
+            // loaded from the compressed storage
+            get_preconditioner()->apply(next_krylov_basis,
+                                        preconditioned_vector.get());
+        } else {
+            apply_preconditioner(get_preconditioner().get(), krylov_bases,
+                                 preconditioned_vector, restart_iter);
+        }
         // preconditioned_vector = get_preconditioner() *
         //                         krylov_bases(:, restart_iter)
 
@@ -220,15 +284,23 @@ void Gmres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
                  dense_b->get_size()[1] * (restart_iter + 1)});
 
         // Start of arnoldi
-        system_matrix_->apply(preconditioned_vector.get(),
-                              next_krylov_basis.get());
+        system_matrix_->apply(preconditioned_vector.get(), next_krylov_basis);
         // next_krylov_basis = A * preconditioned_vector
 
-        exec->run(gmres::make_step_1(
-            next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
-            residual_norm.get(), residual_norm_collection.get(),
-            krylov_bases.get(), hessenberg_iter.get(), b_norm.get(),
-            restart_iter, &final_iter_nums, &stop_status));
+        if (compressed_bases) {
+            exec->run(gmres::make_step_1_compressed(
+                next_krylov_basis, givens_sin, givens_cos, residual_norm,
+                residual_norm_collection, &compressed_krylov_bases,
+                storage_prec, hessenberg_iter.get(), projection,
+                &reduction_workspace, b_norm, restart_iter, krylov_dim_,
+                &final_iter_nums, &stop_status, parameters_.ortho_method));
+        } else {
+            exec->run(gmres::make_step_1(
+                next_krylov_basis, givens_sin, givens_cos, residual_norm,
+                residual_norm_collection, krylov_bases, hessenberg_iter.get(),
+                projection, &reduction_workspace, b_norm, restart_iter,
+                &final_iter_nums, &stop_status, parameters_.ortho_method));
+        }
         // for i in 0:restart_iter
         //     hessenberg(restart_iter, i) = next_krylov_basis' *
         //     krylov_bases(:, i) next_krylov_basis  -= hessenberg(restart_iter,
@@ -257,23 +329,29 @@ void Gmres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     }
 
     // Solve x
-    auto krylov_bases_small = krylov_bases->create_submatrix(
-        span{0, system_matrix_->get_size()[0]},
-        span{0, dense_b->get_size()[1] * (restart_iter + 1)});
     auto hessenberg_small = hessenberg->create_submatrix(
         span{0, restart_iter},
         span{0, dense_b->get_size()[1] * (restart_iter)});
 
-    exec->run(gmres::make_step_2(
-        residual_norm_collection.get(), krylov_bases_small.get(),
-        hessenberg_small.get(), y.get(), before_preconditioner.get(),
-        &final_iter_nums));
+    if (compressed_bases) {
+        exec->run(gmres::make_step_2_compressed(
+            residual_norm_collection, &compressed_krylov_bases, storage_prec,
+            hessenberg_small.get(), y, before_preconditioner, &final_iter_nums,
+            krylov_dim_));
+    } else {
+        auto krylov_bases_small = krylov_bases->create_submatrix(
+            span{0, system_matrix_->get_size()[0]},
+            span{0, dense_b->get_size()[1] * (restart_iter + 1)});
+        exec->run(gmres::make_step_2(residual_norm_collection,
+                                     krylov_bases_small.get(),
+                                     hessenberg_small.get(), y,
+                                     before_preconditioner, &final_iter_nums));
+    }
     // Solve upper triangular.
     // y = hessenberg \ residual_norm_collection
 
-    get_preconditioner()->apply(before_preconditioner.get(),
-                                after_preconditioner.get());
-    dense_x->add_scaled(one_op.get(), after_preconditioner.get());
+    get_preconditioner()->apply(before_preconditioner, after_preconditioner);
+    dense_x->add_scaled(one_op, after_preconditioner);
     // Solve x
     // x = x + get_preconditioner() * krylov_bases * y
 }
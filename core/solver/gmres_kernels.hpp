@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/stop/stopping_status.hpp>
 
 namespace gko {
@@ -72,9 +73,12 @@ namespace gmres {
                 matrix::Dense<_type> *residual_norm_collection,     \
                 matrix::Dense<_type> *krylov_bases,                 \
                 matrix::Dense<_type> *hessenberg_iter,              \
+                matrix::Dense<_type> *projection,                   \
+                Array<_type> *reduction_workspace,                  \
                 const matrix::Dense<_type> *b_norm, size_type iter, \
                 Array<size_type> *final_iter_nums,                  \
-                const Array<stopping_status> *stop_status)
+                const Array<stopping_status> *stop_status,          \
+                solver::gmres::ortho_method ortho)
 
 
 #define GKO_DECLARE_GMRES_STEP_2_KERNEL(_type)                        \
@@ -87,15 +91,59 @@ namespace gmres {
                 const Array<size_type> *final_iter_nums)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                  \
-    template <typename ValueType>                     \
-    GKO_DECLARE_GMRES_INITIALIZE_1_KERNEL(ValueType); \
-    template <typename ValueType>                     \
-    GKO_DECLARE_GMRES_INITIALIZE_2_KERNEL(ValueType); \
-    template <typename ValueType>                     \
-    GKO_DECLARE_GMRES_STEP_1_KERNEL(ValueType);       \
-    template <typename ValueType>                     \
-    GKO_DECLARE_GMRES_STEP_2_KERNEL(ValueType)
+#define GKO_DECLARE_GMRES_INITIALIZE_2_COMPRESSED_KERNEL(_type)       \
+    void initialize_2_compressed(                                     \
+        std::shared_ptr<const DefaultExecutor> exec,                  \
+        const matrix::Dense<_type> *residual,                         \
+        matrix::Dense<_type> *residual_norm,                          \
+        matrix::Dense<_type> *residual_norm_collection,               \
+        matrix::Dense<_type> *next_krylov_basis,                      \
+        Array<_type> *krylov_bases, precision_reduction storage_prec, \
+        Array<size_type> *final_iter_nums, size_type krylov_dim)
+
+
+#define GKO_DECLARE_GMRES_STEP_1_COMPRESSED_KERNEL(_type)                   \
+    void step_1_compressed(                                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        matrix::Dense<_type> *next_krylov_basis,                            \
+        matrix::Dense<_type> *givens_sin, matrix::Dense<_type> *givens_cos, \
+        matrix::Dense<_type> *residual_norm,                                \
+        matrix::Dense<_type> *residual_norm_collection,                     \
+        Array<_type> *krylov_bases, precision_reduction storage_prec,       \
+        matrix::Dense<_type> *hessenberg_iter,                              \
+        matrix::Dense<_type> *projection,                                   \
+        Array<_type> *reduction_workspace,                                  \
+        const matrix::Dense<_type> *b_norm, size_type iter,                 \
+        size_type krylov_dim, Array<size_type> *final_iter_nums,            \
+        const Array<stopping_status> *stop_status,                          \
+        solver::gmres::ortho_method ortho)
+
+
+#define GKO_DECLARE_GMRES_STEP_2_COMPRESSED_KERNEL(_type)                   \
+    void step_2_compressed(                                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const matrix::Dense<_type> *residual_norm_collection,               \
+        const Array<_type> *krylov_bases, precision_reduction storage_prec, \
+        const matrix::Dense<_type> *hessenberg, matrix::Dense<_type> *y,    \
+        matrix::Dense<_type> *before_preconditioner,                        \
+        const Array<size_type> *final_iter_nums, size_type krylov_dim)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                             \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_INITIALIZE_1_KERNEL(ValueType);            \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_INITIALIZE_2_KERNEL(ValueType);            \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_STEP_1_KERNEL(ValueType);                  \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_STEP_2_KERNEL(ValueType);                  \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_INITIALIZE_2_COMPRESSED_KERNEL(ValueType); \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_STEP_1_COMPRESSED_KERNEL(ValueType);       \
+    template <typename ValueType>                                \
+    GKO_DECLARE_GMRES_STEP_2_COMPRESSED_KERNEL(ValueType)
 
 
 }  // namespace gmres
@@ -57,44 +57,48 @@ void Ir<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     constexpr uint8 relative_stopping_id{1};
 
     auto exec = this->get_executor();
-    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
-    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+    auto &workspace = this->get_workspace();
+
+    auto one_op = workspace.get_constant(exec, 0, one<ValueType>());
+    auto neg_one_op = workspace.get_constant(exec, 1, -one<ValueType>());
+    auto relaxation_op =
+        workspace.get_constant(exec, 2, parameters_.relaxation_factor);
 
     auto dense_b = as<const Vector>(b);
     auto dense_x = as<Vector>(x);
-    auto residual = Vector::create_with_config_of(dense_b);
+    auto residual =
+        workspace.get_vector<ValueType>(exec, 0, dense_b->get_size());
 
     bool one_changed{};
-    Array<stopping_status> stop_status(exec, dense_b->get_size()[1]);
+    auto &stop_status = workspace.get_array<stopping_status>(
+        exec, 0, dense_b->get_size()[1]);
     exec->run(ir::make_initialize(&stop_status));
 
     residual->copy_from(dense_b);
-    system_matrix_->apply(lend(neg_one_op), dense_x, lend(one_op),
-                          lend(residual));
+    system_matrix_->apply(neg_one_op, dense_x, one_op, residual);
 
     auto stop_criterion = stop_criterion_factory_->generate(
         system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
-        x, lend(residual));
+        x, residual);
 
     int iter = -1;
     while (true) {
         ++iter;
-        this->template log<log::Logger::iteration_complete>(
-            this, iter, lend(residual), dense_x);
+        this->template log<log::Logger::iteration_complete>(this, iter,
+                                                            residual, dense_x);
 
         if (stop_criterion->update()
                 .num_iterations(iter)
-                .residual(lend(residual))
+                .residual(residual)
                 .solution(dense_x)
                 .check(relative_stopping_id, true, &stop_status,
                        &one_changed)) {
             break;
         }
 
-        solver_->apply(lend(one_op), lend(residual), lend(one_op), dense_x);
+        solver_->apply(relaxation_op, residual, one_op, dense_x);
         residual->copy_from(dense_b);
-        system_matrix_->apply(lend(neg_one_op), dense_x, lend(one_op),
-                              lend(residual));
+        system_matrix_->apply(neg_one_op, dense_x, one_op, residual);
     }
 }
 
@@ -105,10 +109,13 @@ void Ir<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
 {
     auto dense_x = as<matrix::Dense<ValueType>>(x);
 
-    auto x_clone = dense_x->clone();
-    this->apply(b, x_clone.get());
+    // the id is not used by the non-advanced apply
+    auto x_copy = this->get_workspace().get_vector<ValueType>(
+        this->get_executor(), 1, dense_x->get_size());
+    x_copy->copy_from(dense_x);
+    this->apply(b, x_copy);
     dense_x->scale(beta);
-    dense_x->add_scaled(alpha, x_clone.get());
+    dense_x->add_scaled(alpha, x_copy);
 }
 
 
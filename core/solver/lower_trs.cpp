@@ -56,6 +56,8 @@ GKO_REGISTER_OPERATION(init_struct, lower_trs::init_struct);
 GKO_REGISTER_OPERATION(should_perform_transpose,
                        lower_trs::should_perform_transpose);
 GKO_REGISTER_OPERATION(solve, lower_trs::solve);
+GKO_REGISTER_OPERATION(solve_conj_transposed,
+                       lower_trs::solve_conj_transposed);
 
 
 }  // namespace lower_trs
@@ -124,6 +126,28 @@ void LowerTrs<ValueType, IndexType>::apply_impl(const LinOp *alpha,
 }
 
 
+template <typename ValueType, typename IndexType>
+void LowerTrs<ValueType, IndexType>::apply_conj_transposed(const LinOp *b,
+                                                           LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    this->template log<log::Logger::linop_apply_started>(this, b, x);
+    GKO_ASSERT_CONFORMANT(this, b);
+    GKO_ASSERT_EQUAL_ROWS(this, x);
+    GKO_ASSERT_EQUAL_COLS(b, x);
+    const auto exec = this->get_executor();
+
+    {
+        auto b_clone = make_temporary_clone(exec, b);
+        auto x_clone = make_temporary_clone(exec, x);
+        exec->run(lower_trs::make_solve_conj_transposed(
+            gko::lend(system_matrix_), gko::lend(this->solve_struct_),
+            as<const Vector>(b_clone.get()), as<Vector>(x_clone.get())));
+    }
+    this->template log<log::Logger::linop_apply_completed>(this, b, x);
+}
+
+
 #define GKO_DECLARE_LOWER_TRS(_vtype, _itype) class LowerTrs<_vtype, _itype>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LOWER_TRS);
 
@@ -73,12 +73,22 @@ namespace lower_trs {
                const matrix::Dense<_vtype> *b, matrix::Dense<_vtype> *x)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                          \
-    GKO_DECLARE_LOWER_TRS_SHOULD_PERFORM_TRANSPOSE_KERNEL();  \
-    GKO_DECLARE_LOWER_TRS_INIT_STRUCT_KERNEL();               \
-    template <typename ValueType, typename IndexType>         \
-    GKO_DECLARE_LOWER_TRS_SOLVE_KERNEL(ValueType, IndexType); \
-    template <typename ValueType, typename IndexType>         \
+#define GKO_DECLARE_LOWER_TRS_SOLVE_CONJ_TRANSPOSED_KERNEL(_vtype, _itype)  \
+    void solve_conj_transposed(std::shared_ptr<const DefaultExecutor> exec, \
+                               const matrix::Csr<_vtype, _itype> *matrix,   \
+                               const solver::SolveStruct *solve_struct,     \
+                               const matrix::Dense<_vtype> *b,              \
+                               matrix::Dense<_vtype> *x)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                          \
+    GKO_DECLARE_LOWER_TRS_SHOULD_PERFORM_TRANSPOSE_KERNEL();                  \
+    GKO_DECLARE_LOWER_TRS_INIT_STRUCT_KERNEL();                               \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_LOWER_TRS_SOLVE_KERNEL(ValueType, IndexType);                 \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_LOWER_TRS_SOLVE_CONJ_TRANSPOSED_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                         \
     GKO_DECLARE_LOWER_TRS_GENERATE_KERNEL(ValueType, IndexType)
 
 
@@ -0,0 +1,268 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/multigrid.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+#include "core/solver/multigrid_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace multigrid {
+
+
+GKO_REGISTER_OPERATION(initialize, multigrid::initialize);
+GKO_REGISTER_OPERATION(fill_zero, multigrid::fill_zero);
+
+
+}  // namespace multigrid
+
+
+namespace {
+
+
+template <typename ValueType>
+std::shared_ptr<const LinOpFactory> build_damped_jacobi(
+    std::shared_ptr<const Executor> exec, size_type iterations)
+{
+    return Ir<ValueType>::build()
+        .with_solver(preconditioner::Jacobi<ValueType, int32>::build()
+                         .with_max_block_size(1u)
+                         .on(exec))
+        .with_relaxation_factor(static_cast<ValueType>(0.9))
+        .with_criteria(
+            stop::Iteration::build().with_max_iters(iterations).on(exec))
+        .on(exec);
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void Multigrid<ValueType>::generate()
+{
+    const auto exec = this->get_executor();
+    auto mg_level_factory = parameters_.mg_level;
+    if (!mg_level_factory) {
+        mg_level_factory =
+            gko::multigrid::Pgm<ValueType, int32>::build().on(exec);
+    }
+    auto pre_smoother_factory = parameters_.pre_smoother;
+    if (!pre_smoother_factory) {
+        pre_smoother_factory = build_damped_jacobi<ValueType>(exec, 1u);
+    }
+    auto coarsest_solver_factory = parameters_.coarsest_solver;
+    if (!coarsest_solver_factory) {
+        coarsest_solver_factory = build_damped_jacobi<ValueType>(exec, 4u);
+    }
+
+    auto fine_op = system_matrix_;
+    while (mg_level_list_.size() + 1 < parameters_.max_levels &&
+           fine_op->get_size()[0] > parameters_.min_coarse_rows) {
+        std::shared_ptr<const LinOp> mg_level =
+            mg_level_factory->generate(fine_op);
+        auto coarse_op =
+            as<gko::multigrid::MultigridLevel>(mg_level.get())->get_coarse_op();
+        // stop if the coarsening does not make progress anymore
+        if (coarse_op->get_size()[0] >= fine_op->get_size()[0]) {
+            break;
+        }
+        mg_level_list_.emplace_back(std::move(mg_level));
+        pre_smoother_list_.emplace_back(
+            pre_smoother_factory->generate(fine_op));
+        if (parameters_.post_smoother) {
+            post_smoother_list_.emplace_back(
+                parameters_.post_smoother->generate(fine_op));
+        } else {
+            post_smoother_list_.emplace_back(pre_smoother_list_.back());
+        }
+        fine_op = std::move(coarse_op);
+    }
+    coarsest_solver_ = coarsest_solver_factory->generate(fine_op);
+}
+
+
+template <typename ValueType>
+void Multigrid<ValueType>::run_cycle(size_type level,
+                                     const matrix::Dense<ValueType> *b,
+                                     matrix::Dense<ValueType> *x) const
+{
+    if (level == mg_level_list_.size()) {
+        coarsest_solver_->apply(b, x);
+        return;
+    }
+    auto mg_level =
+        as<gko::multigrid::MultigridLevel>(mg_level_list_[level].get());
+    auto r = cache_.r[level].get();
+    auto coarse_b = cache_.b[level].get();
+    auto coarse_x = cache_.x[level].get();
+
+    pre_smoother_list_[level]->apply(b, x);
+    r->copy_from(b);
+    mg_level->get_fine_op()->apply(lend(cache_.neg_one), x, lend(cache_.one),
+                                   r);
+    mg_level->get_restrict_op()->apply(r, coarse_b);
+    this->get_executor()->run(multigrid::make_fill_zero(coarse_x));
+    // the W cycle visits the next coarser level twice, unless it is the
+    // coarsest one, where a second visit would not change the result
+    const auto num_visits = parameters_.cycle == multigrid_cycle::w &&
+                                    level + 1 < mg_level_list_.size()
+                                ? 2
+                                : 1;
+    for (int visit = 0; visit < num_visits; ++visit) {
+        this->run_cycle(level + 1, coarse_b, coarse_x);
+    }
+    mg_level->get_prolong_op()->apply(lend(cache_.one), coarse_x,
+                                      lend(cache_.one), x);
+    post_smoother_list_[level]->apply(b, x);
+}
+
+
+template <typename ValueType>
+void Multigrid<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    constexpr uint8 relative_stopping_id{1};
+
+    auto exec = this->get_executor();
+    auto dense_b = as<const Vector>(b);
+    auto dense_x = as<Vector>(x);
+
+    const auto num_rhs = dense_b->get_size()[1];
+    if (cache_.one == nullptr || cache_.r.size() != mg_level_list_.size() ||
+        (!cache_.r.empty() && cache_.r[0]->get_size()[1] != num_rhs)) {
+        cache_.one = initialize<Vector>({one<ValueType>()}, exec);
+        cache_.neg_one = initialize<Vector>({-one<ValueType>()}, exec);
+        cache_.r.clear();
+        cache_.b.clear();
+        cache_.x.clear();
+        for (const auto &mg_level : mg_level_list_) {
+            const auto fine_size = mg_level->get_size()[0];
+            const auto coarse_size =
+                as<gko::multigrid::MultigridLevel>(mg_level.get())
+                    ->get_coarse_op()
+                    ->get_size()[0];
+            cache_.r.emplace_back(
+                Vector::create(exec, dim<2>{fine_size, num_rhs}));
+            cache_.b.emplace_back(
+                Vector::create(exec, dim<2>{coarse_size, num_rhs}));
+            cache_.x.emplace_back(
+                Vector::create(exec, dim<2>{coarse_size, num_rhs}));
+        }
+    }
+
+    if (stop_criterion_factory_ == nullptr) {
+        // used as a preconditioner: one cycle without an initial guess
+        exec->run(multigrid::make_fill_zero(dense_x));
+        this->run_cycle(0, dense_b, dense_x);
+        return;
+    }
+
+    if (cache_.residual == nullptr ||
+        cache_.residual->get_size() != dense_b->get_size()) {
+        cache_.residual = Vector::create(exec, dense_b->get_size());
+        cache_.stop_status = Array<stopping_status>(exec, num_rhs);
+    }
+    auto residual = cache_.residual.get();
+    auto &stop_status = cache_.stop_status;
+    bool one_changed{};
+    exec->run(multigrid::make_initialize(&stop_status));
+
+    residual->copy_from(dense_b);
+    system_matrix_->apply(lend(cache_.neg_one), dense_x, lend(cache_.one),
+                          residual);
+
+    auto stop_criterion = stop_criterion_factory_->generate(
+        system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
+        x, residual);
+
+    int iter = -1;
+    while (true) {
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(this, iter,
+                                                            residual, dense_x);
+
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual(residual)
+                .solution(dense_x)
+                .check(relative_stopping_id, true, &stop_status,
+                       &one_changed)) {
+            break;
+        }
+
+        this->run_cycle(0, dense_b, dense_x);
+        residual->copy_from(dense_b);
+        system_matrix_->apply(lend(cache_.neg_one), dense_x, lend(cache_.one),
+                              residual);
+    }
+}
+
+
+template <typename ValueType>
+void Multigrid<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                      const LinOp *beta, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    auto dense_x = as<Vector>(x);
+
+    if (cache_.x_copy == nullptr ||
+        cache_.x_copy->get_size() != dense_x->get_size()) {
+        cache_.x_copy =
+            Vector::create(this->get_executor(), dense_x->get_size());
+    }
+    auto x_copy = cache_.x_copy.get();
+    x_copy->copy_from(dense_x);
+    this->apply(b, x_copy);
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_copy);
+}
+
+
+#define GKO_DECLARE_MULTIGRID(_type) class Multigrid<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MULTIGRID);
+
+
+}  // namespace solver
+}  // namespace gko
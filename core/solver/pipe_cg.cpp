@@ -0,0 +1,180 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/pipe_cg.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+
+
+namespace pipe_cg {
+
+
+GKO_REGISTER_OPERATION(initialize, pipe_cg::initialize);
+GKO_REGISTER_OPERATION(step_1, pipe_cg::step_1);
+GKO_REGISTER_OPERATION(step_2, pipe_cg::step_2);
+
+
+}  // namespace pipe_cg
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using std::swap;
+    using Vector = matrix::Dense<ValueType>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    auto &workspace = this->get_workspace();
+
+    auto one_op = workspace.get_constant(exec, 0, one<ValueType>());
+    auto neg_one_op = workspace.get_constant(exec, 1, -one<ValueType>());
+
+    auto dense_b = as<const Vector>(b);
+    auto dense_x = as<Vector>(x);
+    const auto vector_size = dense_b->get_size();
+    const auto scalar_size = dim<2>{1, vector_size[1]};
+    auto r = workspace.get_vector<ValueType>(exec, 0, vector_size);
+    auto u = workspace.get_vector<ValueType>(exec, 1, vector_size);
+    auto w = workspace.get_vector<ValueType>(exec, 2, vector_size);
+    auto m = workspace.get_vector<ValueType>(exec, 3, vector_size);
+    auto n = workspace.get_vector<ValueType>(exec, 4, vector_size);
+    auto p = workspace.get_vector<ValueType>(exec, 5, vector_size);
+    auto q = workspace.get_vector<ValueType>(exec, 6, vector_size);
+    auto s = workspace.get_vector<ValueType>(exec, 7, vector_size);
+    auto z = workspace.get_vector<ValueType>(exec, 8, vector_size);
+
+    auto gamma = workspace.get_vector<ValueType>(exec, 9, scalar_size);
+    auto prev_gamma = workspace.get_vector<ValueType>(exec, 10, scalar_size);
+    auto delta = workspace.get_vector<ValueType>(exec, 11, scalar_size);
+    auto alpha = workspace.get_vector<ValueType>(exec, 12, scalar_size);
+    auto beta = workspace.get_vector<ValueType>(exec, 13, scalar_size);
+    auto residual_norm =
+        workspace.get_vector<ValueType>(exec, 14, scalar_size);
+
+    bool one_changed{};
+    auto &stop_status =
+        workspace.get_array<stopping_status>(exec, 0, vector_size[1]);
+    // scratch space of the three fused reductions of step_1, its size is
+    // chosen by the kernel
+    auto &reduction_buffer = workspace.get_scratch_array<ValueType>(exec, 1);
+
+    exec->run(pipe_cg::make_initialize(dense_b, r, p, q, s, z, prev_gamma,
+                                       alpha, &stop_status));
+    // r = dense_b
+    // p = q = s = z = 0
+    // prev_gamma = 0
+    // alpha = 1
+
+    system_matrix_->apply(neg_one_op, dense_x, one_op, r);
+    get_preconditioner()->apply(r, u);
+    system_matrix_->apply(u, w);
+    auto stop_criterion = stop_criterion_factory_->generate(
+        system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
+        x, r);
+
+    int iter = -1;
+    while (true) {
+        exec->run(pipe_cg::make_step_1(r, u, w, gamma, delta, residual_norm,
+                                       &reduction_buffer));
+        // gamma = dot(r, u)
+        // delta = dot(w, u)
+        // residual_norm = norm2(r)
+        // all computed in a single reduction, which does not have to be
+        // completed before the following preconditioner and matrix
+        // applications are started
+        get_preconditioner()->apply(w, m);
+        system_matrix_->apply(m, n);
+
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(this, iter, r,
+                                                            dense_x);
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .residual_norm(residual_norm)
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        exec->run(pipe_cg::make_step_2(dense_x, r, u, w, p, q, s, z, m, n,
+                                       gamma, prev_gamma, delta, alpha, beta,
+                                       &stop_status));
+        // beta = gamma / prev_gamma (0 in the first iteration)
+        // alpha = gamma / (delta - beta * gamma / alpha)
+        // z = n + beta * z
+        // q = m + beta * q
+        // s = w + beta * s
+        // p = u + beta * p
+        // x = x + alpha * p
+        // r = r - alpha * s
+        // u = u - alpha * q
+        // w = w - alpha * z
+        swap(prev_gamma, gamma);
+    }
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                   const LinOp *beta, LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_PIPE_CG(_type) class PipeCg<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -0,0 +1,266 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/base/binary_io.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+class BinaryIo : public ::testing::Test {
+protected:
+    using Dense = gko::matrix::Dense<double>;
+    using Coo = gko::matrix::Coo<double, gko::int32>;
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+
+    BinaryIo()
+        : exec(gko::ReferenceExecutor::create()),
+          // clang-format off
+          dense(gko::initialize<Dense>(
+              {{1.0, 0.0, 3.0},
+               {0.0, 5.0, 0.0},
+               {2.0, 0.0, 4.0}}, exec)),
+          // clang-format on
+          filename("binary_io_test.bin")
+    {}
+
+    ~BinaryIo() { std::remove(filename.c_str()); }
+
+    template <typename MatrixType>
+    void write_file(const MatrixType *matrix)
+    {
+        std::ofstream os(filename, std::ios::binary);
+        gko::write_binary(os, matrix);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Dense> dense;
+    std::string filename;
+};
+
+
+TEST_F(BinaryIo, WritesAndReadsDense)
+{
+    std::stringstream ss;
+
+    gko::write_binary(ss, dense.get());
+    auto result = gko::read_binary<Dense>(ss, exec);
+
+    GKO_ASSERT_MTX_NEAR(result, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, WritesDenseWithoutPadding)
+{
+    auto strided = Dense::create(exec, gko::dim<2>{3, 3}, 4);
+    strided->copy_from(dense.get());
+    std::stringstream ss;
+
+    gko::write_binary(ss, strided.get());
+    auto result = gko::read_binary<Dense>(ss, exec);
+
+    ASSERT_EQ(result->get_stride(), 3);
+    GKO_ASSERT_MTX_NEAR(result, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, WritesAndReadsCoo)
+{
+    auto coo = Coo::create(exec);
+    dense->convert_to(coo.get());
+    std::stringstream ss;
+
+    gko::write_binary(ss, coo.get());
+    auto result = gko::read_binary<Coo>(ss, exec);
+
+    ASSERT_EQ(result->get_num_stored_elements(), 5);
+    GKO_ASSERT_MTX_NEAR(result, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, WritesAndReadsCsr)
+{
+    auto csr = Csr::create(exec);
+    dense->convert_to(csr.get());
+    std::stringstream ss;
+
+    gko::write_binary(ss, csr.get());
+    auto result = gko::read_binary<Csr>(ss, exec);
+
+    ASSERT_EQ(result->get_num_stored_elements(), 5);
+    GKO_ASSERT_MTX_NEAR(result, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, WritesAndReadsEmptyCsr)
+{
+    auto csr = Csr::create(exec, gko::dim<2>{2, 3});
+    std::stringstream ss;
+
+    gko::write_binary(ss, csr.get());
+    auto result = gko::read_binary<Csr>(ss, exec);
+
+    ASSERT_EQ(result->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(result->get_num_stored_elements(), 0);
+}
+
+
+TEST_F(BinaryIo, AlignsArrays)
+{
+    auto csr = Csr::create(exec);
+    dense->convert_to(csr.get());
+    std::stringstream ss;
+
+    gko::write_binary(ss, csr.get());
+
+    // header, 4 row pointers, 5 column indexes and 5 values
+    ASSERT_EQ(ss.str().size(), 64 + 64 + 64 + 5 * sizeof(double));
+}
+
+
+TEST_F(BinaryIo, ReadsCsrFromFile)
+{
+    auto csr = Csr::create(exec);
+    dense->convert_to(csr.get());
+    write_file(csr.get());
+
+    auto result = gko::read_binary<Csr>(filename, exec);
+
+    GKO_ASSERT_MTX_NEAR(result, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, ModifyingMatrixReadFromFileKeepsFile)
+{
+    write_file(dense.get());
+    auto result = gko::read_binary<Dense>(filename, exec);
+
+    result->at(0, 0) = 7.0;
+    auto reread = gko::read_binary<Dense>(filename, exec);
+
+    ASSERT_EQ(result->at(0, 0), 7.0);
+    GKO_ASSERT_MTX_NEAR(reread, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, MatrixReadFromFileOutlivesReader)
+{
+    write_file(dense.get());
+    auto result = gko::read_binary<Dense>(filename, exec);
+
+    std::remove(filename.c_str());
+
+    GKO_ASSERT_MTX_NEAR(result, dense, 0.0);
+}
+
+
+TEST_F(BinaryIo, FailsWhenReadingMissingFile)
+{
+    ASSERT_THROW(gko::read_binary<Dense>(filename, exec), gko::StreamError);
+}
+
+
+TEST_F(BinaryIo, FailsWhenReadingMatrixMarket)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix array real general\n"
+        "2 1\n"
+        "1.0\n"
+        "0.0\n"
+        "%% padding the stream to the size of the binary header\n");
+
+    ASSERT_THROW(gko::read_binary<Dense>(iss, exec), gko::StreamError);
+}
+
+
+TEST_F(BinaryIo, FailsWhenReadingTruncatedData)
+{
+    std::stringstream ss;
+    gko::write_binary(ss, dense.get());
+    auto data = ss.str();
+    std::istringstream iss(data.substr(0, data.size() - 1));
+
+    ASSERT_THROW(gko::read_binary<Dense>(iss, exec), gko::StreamError);
+}
+
+
+TEST_F(BinaryIo, FailsWhenReadingDifferentFormat)
+{
+    std::stringstream ss;
+    gko::write_binary(ss, dense.get());
+
+    ASSERT_THROW(gko::read_binary<Csr>(ss, exec), gko::StreamError);
+}
+
+
+TEST_F(BinaryIo, FailsWhenReadingDifferentValueType)
+{
+    std::stringstream ss;
+    gko::write_binary(ss, dense.get());
+
+    ASSERT_THROW(gko::read_binary<gko::matrix::Dense<float>>(ss, exec),
+                 gko::StreamError);
+}
+
+
+TEST_F(BinaryIo, FailsWhenReadingDifferentIndexType)
+{
+    auto csr = Csr::create(exec);
+    dense->convert_to(csr.get());
+    std::stringstream ss;
+    gko::write_binary(ss, csr.get());
+
+    ASSERT_THROW((gko::read_binary<gko::matrix::Csr<double, gko::int64>>(
+                     ss, exec)),
+                 gko::StreamError);
+}
+
+
+}  // namespace
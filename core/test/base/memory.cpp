@@ -0,0 +1,389 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/record.hpp>
+
+
+namespace {
+
+
+bool is_aligned(const void *ptr, gko::size_type alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+
+class CountingAllocator : public gko::CpuAllocator {
+public:
+    void *allocate(const gko::Executor *exec,
+                   gko::size_type num_bytes) override
+    {
+        ++num_allocations;
+        return gko::CpuAllocator::allocate(exec, num_bytes);
+    }
+
+    void deallocate(const gko::Executor *exec, void *ptr) noexcept override
+    {
+        if (ptr != nullptr) {
+            ++num_deallocations;
+        }
+        gko::CpuAllocator::deallocate(exec, ptr);
+    }
+
+    int num_allocations = 0;
+    int num_deallocations = 0;
+};
+
+
+TEST(AlignedCpuAllocator, AlignsToCacheLines)
+{
+    gko::AlignedCpuAllocator alloc;
+
+    auto ptr1 = alloc.allocate(nullptr, 1);
+    auto ptr2 = alloc.allocate(nullptr, 100);
+
+    ASSERT_EQ(alloc.get_alignment(), 64);
+    ASSERT_TRUE(is_aligned(ptr1, 64));
+    ASSERT_TRUE(is_aligned(ptr2, 64));
+    alloc.deallocate(nullptr, ptr1);
+    alloc.deallocate(nullptr, ptr2);
+}
+
+
+TEST(AlignedCpuAllocator, AlignsToHugePages)
+{
+    gko::AlignedCpuAllocator alloc(
+        gko::AlignedCpuAllocator::huge_page_alignment);
+
+    auto ptr = alloc.allocate(nullptr, 1 << 21);
+
+    ASSERT_TRUE(is_aligned(ptr, 1 << 21));
+    alloc.deallocate(nullptr, ptr);
+}
+
+
+TEST(AlignedCpuAllocator, AlignsSmallBlocksOnlyToCacheLines)
+{
+    gko::AlignedCpuAllocator alloc(
+        gko::AlignedCpuAllocator::huge_page_alignment);
+
+    auto ptr = alloc.allocate(nullptr, 10);
+
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_TRUE(is_aligned(ptr, 64));
+    alloc.deallocate(nullptr, ptr);
+}
+
+
+TEST(AlignedCpuAllocator, DeallocateAcceptsNullptr)
+{
+    gko::AlignedCpuAllocator alloc;
+
+    ASSERT_NO_THROW(alloc.deallocate(nullptr, nullptr));
+}
+
+
+TEST(AlignedCpuAllocator, FailsWhenOverallocating)
+{
+    gko::AlignedCpuAllocator alloc;
+
+    ASSERT_EQ(alloc.allocate(nullptr, static_cast<gko::size_type>(-1)),
+              nullptr);
+}
+
+
+TEST(AlignedCpuAllocator, ThrowsOnInvalidAlignment)
+{
+    ASSERT_THROW(gko::AlignedCpuAllocator(48), gko::NotSupported);
+}
+
+
+TEST(PooledCpuAllocator, ReusesDeallocatedBlocks)
+{
+    gko::PooledCpuAllocator alloc;
+
+    auto ptr1 = alloc.allocate(nullptr, 100);
+    alloc.deallocate(nullptr, ptr1);
+    auto ptr2 = alloc.allocate(nullptr, 100);
+
+    ASSERT_EQ(ptr1, ptr2);
+    ASSERT_EQ(alloc.get_num_misses(), 1);
+    ASSERT_EQ(alloc.get_num_hits(), 1);
+    alloc.deallocate(nullptr, ptr2);
+}
+
+
+TEST(PooledCpuAllocator, ReusesBlocksOfSameSizeClass)
+{
+    gko::PooledCpuAllocator alloc;
+
+    auto ptr1 = alloc.allocate(nullptr, 100);
+    alloc.deallocate(nullptr, ptr1);
+    auto ptr2 = alloc.allocate(nullptr, 128);
+    auto ptr3 = alloc.allocate(nullptr, 100);
+
+    ASSERT_EQ(ptr1, ptr2);
+    ASSERT_NE(ptr2, ptr3);
+    ASSERT_EQ(alloc.get_num_misses(), 2);
+    ASSERT_EQ(alloc.get_num_hits(), 1);
+    alloc.deallocate(nullptr, ptr2);
+    alloc.deallocate(nullptr, ptr3);
+}
+
+
+TEST(PooledCpuAllocator, DoesNotReuseBlocksOfOtherSizeClasses)
+{
+    gko::PooledCpuAllocator alloc;
+
+    auto ptr1 = alloc.allocate(nullptr, 100);
+    alloc.deallocate(nullptr, ptr1);
+    auto ptr2 = alloc.allocate(nullptr, 1000);
+
+    ASSERT_EQ(alloc.get_num_misses(), 2);
+    ASSERT_EQ(alloc.get_num_hits(), 0);
+    ASSERT_EQ(alloc.get_cached_bytes(), 128);
+    alloc.deallocate(nullptr, ptr2);
+}
+
+
+TEST(PooledCpuAllocator, ReturnsAlignedBlocks)
+{
+    gko::PooledCpuAllocator alloc;
+
+    auto ptr = alloc.allocate(nullptr, 3);
+
+    ASSERT_TRUE(is_aligned(ptr, 64));
+    alloc.deallocate(nullptr, ptr);
+}
+
+
+TEST(PooledCpuAllocator, LimitsCachedBytes)
+{
+    auto upstream = std::make_shared<CountingAllocator>();
+    gko::PooledCpuAllocator alloc(upstream, 256);
+
+    auto ptr1 = alloc.allocate(nullptr, 256);
+    auto ptr2 = alloc.allocate(nullptr, 256);
+    alloc.deallocate(nullptr, ptr1);
+    alloc.deallocate(nullptr, ptr2);
+
+    ASSERT_EQ(alloc.get_cached_bytes(), 256);
+    ASSERT_EQ(upstream->num_deallocations, 1);
+}
+
+
+TEST(PooledCpuAllocator, DoesNotPoolLargeBlocks)
+{
+    auto upstream = std::make_shared<CountingAllocator>();
+    gko::PooledCpuAllocator alloc(upstream, 1 << 20, 64, 1024);
+
+    auto ptr = alloc.allocate(nullptr, 1025);
+    alloc.deallocate(nullptr, ptr);
+
+    ASSERT_EQ(alloc.get_cached_bytes(), 0);
+    ASSERT_EQ(upstream->num_deallocations, 1);
+}
+
+
+TEST(PooledCpuAllocator, ReleasesCachedBlocks)
+{
+    auto upstream = std::make_shared<CountingAllocator>();
+    gko::PooledCpuAllocator alloc(upstream);
+    auto ptr1 = alloc.allocate(nullptr, 100);
+    auto ptr2 = alloc.allocate(nullptr, 1000);
+    alloc.deallocate(nullptr, ptr1);
+
+    alloc.release();
+
+    ASSERT_EQ(alloc.get_cached_bytes(), 0);
+    ASSERT_EQ(upstream->num_deallocations, 1);
+    alloc.deallocate(nullptr, ptr2);
+    ASSERT_EQ(upstream->num_deallocations, 1);
+}
+
+
+TEST(PooledCpuAllocator, ReturnsAllBlocksOnDestruction)
+{
+    auto upstream = std::make_shared<CountingAllocator>();
+    {
+        gko::PooledCpuAllocator alloc(upstream);
+        alloc.deallocate(nullptr, alloc.allocate(nullptr, 100));
+        alloc.allocate(nullptr, 1000);
+    }
+
+    ASSERT_EQ(upstream->num_allocations, 2);
+    ASSERT_EQ(upstream->num_deallocations, 2);
+}
+
+
+TEST(PooledCpuAllocator, LogsHitsAndMisses)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>();
+    std::shared_ptr<gko::log::Record> logger = gko::log::Record::create(
+        exec,
+        gko::log::Logger::allocation_started_mask |
+            gko::log::Logger::allocation_completed_mask |
+            gko::log::Logger::free_completed_mask,
+        0);
+    alloc->add_logger(logger);
+
+    auto ptr = alloc->allocate(exec.get(), 100);
+    alloc->deallocate(exec.get(), ptr);
+    alloc->deallocate(exec.get(), alloc->allocate(exec.get(), 100));
+    alloc->release();
+
+    auto &data = logger->get();
+    ASSERT_EQ(data.allocation_started.size(), 2);
+    ASSERT_EQ(data.allocation_started[0]->exec, exec.get());
+    ASSERT_EQ(data.allocation_started[0]->num_bytes, 128);
+    ASSERT_EQ(data.allocation_started[1]->exec, exec.get());
+    ASSERT_EQ(data.allocation_started[1]->num_bytes, 0);
+    ASSERT_EQ(data.allocation_completed.size(), 2);
+    for (const auto &completed : data.allocation_completed) {
+        ASSERT_EQ(completed->exec, exec.get());
+        ASSERT_EQ(completed->num_bytes, 128);
+        ASSERT_EQ(completed->location, reinterpret_cast<gko::uintptr>(ptr));
+    }
+    ASSERT_EQ(data.free_completed.size(), 1);
+    ASSERT_EQ(data.free_completed[0]->exec, nullptr);
+    ASSERT_EQ(data.free_completed[0]->location,
+              reinterpret_cast<gko::uintptr>(ptr));
+}
+
+
+TEST(PooledCpuAllocator, LogsUpstreamFreesWithExecutor)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>(
+        std::make_shared<gko::AlignedCpuAllocator>(), 0);
+    std::shared_ptr<gko::log::Record> logger = gko::log::Record::create(
+        exec, gko::log::Logger::free_completed_mask, 0);
+    alloc->add_logger(logger);
+
+    alloc->deallocate(exec.get(), alloc->allocate(exec.get(), 100));
+
+    auto &data = logger->get();
+    ASSERT_EQ(data.free_completed.size(), 1);
+    ASSERT_EQ(data.free_completed[0]->exec, exec.get());
+}
+
+
+TEST(PooledCpuAllocator, IsThreadSafe)
+{
+    gko::PooledCpuAllocator alloc;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&alloc, t] {
+            for (int i = 0; i < 1000; ++i) {
+                alloc.deallocate(nullptr,
+                                 alloc.allocate(nullptr, (i + t) % 7 * 100));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(alloc.get_num_hits() + alloc.get_num_misses(), 4000);
+    ASSERT_LE(alloc.get_num_misses(), 4 * 7);
+}
+
+
+TEST(OmpExecutor, UsesProvidedAllocator)
+{
+    auto alloc = std::make_shared<CountingAllocator>();
+    auto omp = gko::OmpExecutor::create(alloc);
+
+    auto ptr = omp->alloc<int>(10);
+    omp->free(ptr);
+
+    ASSERT_EQ(omp->get_allocator(), alloc);
+    ASSERT_EQ(alloc->num_allocations, 1);
+    ASSERT_EQ(alloc->num_deallocations, 1);
+}
+
+
+TEST(ReferenceExecutor, UsesProvidedAllocator)
+{
+    auto alloc = std::make_shared<CountingAllocator>();
+    auto ref = gko::ReferenceExecutor::create(alloc);
+
+    auto ptr = ref->alloc<int>(10);
+    ref->free(ptr);
+
+    ASSERT_EQ(ref->get_allocator(), alloc);
+    ASSERT_EQ(alloc->num_allocations, 1);
+    ASSERT_EQ(alloc->num_deallocations, 1);
+}
+
+
+TEST(OmpExecutor, ReusesMemoryWithPooledAllocator)
+{
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>();
+    auto omp = gko::OmpExecutor::create(alloc);
+
+    { gko::Array<double> tmp(omp, 100); }
+    { gko::Array<double> tmp(omp, 100); }
+
+    ASSERT_EQ(alloc->get_num_misses(), 1);
+    ASSERT_EQ(alloc->get_num_hits(), 1);
+}
+
+
+TEST(OmpExecutor, FailsWhenOverallocatingWithPooledAllocator)
+{
+    const gko::size_type num_elems = 1ll << 50;  // 4PB of integers
+    auto omp =
+        gko::OmpExecutor::create(std::make_shared<gko::PooledCpuAllocator>());
+
+    ASSERT_THROW(omp->alloc<int>(num_elems), gko::AllocationError);
+}
+
+
+}  // namespace
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 namespace {
@@ -367,6 +368,244 @@ TEST(MatrixData, WritesComplexMatrixToMatrixMarketCoordinate)
 }
 
 
+template <typename ValueType, typename IndexType>
+void assert_csr_eq(const gko::matrix::Csr<ValueType, IndexType> *mtx,
+                   gko::dim<2> size, std::vector<IndexType> row_ptrs,
+                   std::vector<IndexType> col_idxs,
+                   std::vector<ValueType> values)
+{
+    ASSERT_EQ(mtx->get_size(), size);
+    ASSERT_EQ(mtx->get_num_stored_elements(), values.size());
+    for (gko::size_type row = 0; row <= size[0]; ++row) {
+        ASSERT_EQ(mtx->get_const_row_ptrs()[row], row_ptrs[row]);
+    }
+    for (gko::size_type nz = 0; nz < values.size(); ++nz) {
+        ASSERT_EQ(mtx->get_const_col_idxs()[nz], col_idxs[nz]);
+        ASSERT_EQ(mtx->get_const_values()[nz], values[nz]);
+    }
+}
+
+
+TEST(MtxReader, ReadsCsrFromSparseMtx)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% a comment\n"
+        "3 4 6\n"
+        "3 2 6.0\n"
+        "1 4 2.5\n"
+        "\n"
+        "1 1 1.0\n"
+        "3 1 -5e-1\n"
+        "2 3\t3.0\r\n"
+        "3 4 .25\n");
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 3);
+
+    assert_csr_eq<double, gko::int32>(mtx.get(), gko::dim<2>(3, 4),
+                                      {0, 2, 3, 6}, {0, 3, 2, 0, 1, 3},
+                                      {1.0, 2.5, 3.0, -0.5, 6.0, 0.25});
+}
+
+
+TEST(MtxReader, ReadsCsrWithMoreThreadsThanEntries)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 2\n"
+        "2 1 1.0\n"
+        "1 2 2.0\n");
+
+    auto mtx = gko::read_csr<double, gko::int64>(
+        iss, gko::ReferenceExecutor::create(), 16);
+
+    assert_csr_eq<double, gko::int64>(mtx.get(), gko::dim<2>(2, 2), {0, 1, 2},
+                                      {1, 0}, {2.0, 1.0});
+}
+
+
+TEST(MtxReader, ReadsEmptyCsrWithManyThreads)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "3 2 0\n");
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 64);
+
+    assert_csr_eq<double, gko::int32>(mtx.get(), gko::dim<2>(3, 2),
+                                      {0, 0, 0, 0}, {}, {});
+}
+
+
+TEST(MtxReader, ReadsCsrFromSymmetricMtx)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "3 3 4\n"
+        "1 1 1.0\n"
+        "3 1 2.0\n"
+        "2 2 3.0\n"
+        "3 2 4.0\n");
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 2);
+
+    assert_csr_eq<double, gko::int32>(mtx.get(), gko::dim<2>(3, 3),
+                                      {0, 2, 4, 6}, {0, 2, 1, 2, 0, 1},
+                                      {1.0, 2.0, 3.0, 4.0, 2.0, 4.0});
+}
+
+
+TEST(MtxReader, ReadsCsrFromSkewSymmetricMtx)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+        "2 2 1\n"
+        "2 1 2.0\n");
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 2);
+
+    assert_csr_eq<double, gko::int32>(mtx.get(), gko::dim<2>(2, 2), {0, 1, 2},
+                                      {1, 0}, {-2.0, 2.0});
+}
+
+
+TEST(MtxReader, ReadsCsrFromHermitianMtx)
+{
+    using cpx = std::complex<double>;
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 2\n"
+        "1 1 1.0 0.0\n"
+        "2 1 2.0 3.0\n");
+
+    auto mtx = gko::read_csr<cpx, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 2);
+
+    assert_csr_eq<cpx, gko::int32>(mtx.get(), gko::dim<2>(2, 2), {0, 2, 3},
+                                   {0, 1, 0},
+                                   {cpx{1.0, 0.0}, cpx{2.0, -3.0},
+                                    cpx{2.0, 3.0}});
+}
+
+
+TEST(MtxReader, ReadsCsrFromPatternMtx)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate pattern general\n"
+        "2 2 2\n"
+        "2 2\n"
+        "1 1\n");
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 2);
+
+    assert_csr_eq<double, gko::int32>(mtx.get(), gko::dim<2>(2, 2), {0, 1, 2},
+                                      {0, 1}, {1.0, 1.0});
+}
+
+
+TEST(MtxReader, ReadsCsrFromDenseMtx)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n"
+        "5.0\n");
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 2);
+
+    assert_csr_eq<double, gko::int32>(mtx.get(), gko::dim<2>(2, 2), {0, 2, 3},
+                                      {0, 1, 1}, {1.0, 3.0, 5.0});
+}
+
+
+TEST(MtxReader, ParsesNumbersLikeStreamInput)
+{
+    const std::vector<std::string> numbers{
+        "0.1",         "-2",   "+3.5",     "1e-3",     "1.5E+2",
+        "123456.789",  "0.0",  "-0.0",     "1e300",    "2.5e-310",
+        "0.000000001", "1e22", "1.7e-308", "00012.50", "3.14159265358979323846"};
+    std::string content = "%%MatrixMarket matrix coordinate real general\n" +
+                          std::to_string(numbers.size()) + " 1 " +
+                          std::to_string(numbers.size()) + "\n";
+    for (gko::size_type i = 0; i < numbers.size(); ++i) {
+        content += std::to_string(i + 1) + " 1 " + numbers[i] + "\n";
+    }
+    std::istringstream iss(content);
+
+    auto mtx = gko::read_csr<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 4);
+
+    for (gko::size_type i = 0; i < numbers.size(); ++i) {
+        std::istringstream number_stream(numbers[i]);
+        double expected{};
+        number_stream >> expected;
+        ASSERT_EQ(mtx->get_const_values()[i], expected) << numbers[i];
+    }
+}
+
+
+TEST(MtxReader, FailsWhenReadingCsrWithMissingEntries)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 3\n"
+        "1 1 1.0\n"
+        "2 2 1.0\n");
+
+    ASSERT_THROW((gko::read_csr<double, gko::int32>(
+                     iss, gko::ReferenceExecutor::create(), 2)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingCsrWithInvalidEntry)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 2\n"
+        "1 1 1.0\n"
+        "2 2 x\n");
+
+    ASSERT_THROW((gko::read_csr<double, gko::int32>(
+                     iss, gko::ReferenceExecutor::create(), 2)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingCsrWithEntryOutOfBounds)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n"
+        "3 1 1.0\n");
+
+    ASSERT_THROW((gko::read_csr<double, gko::int32>(
+                     iss, gko::ReferenceExecutor::create(), 2)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingComplexCsrToRealCsr)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate complex general\n"
+        "2 2 1\n"
+        "1 1 1.0 2.0\n");
+
+    ASSERT_THROW((gko::read_csr<double, gko::int32>(
+                     iss, gko::ReferenceExecutor::create(), 2)),
+                 gko::StreamError);
+}
+
+
 template <typename ValueType, typename IndexType>
 class DummyLinOp
     : public gko::EnableLinOp<DummyLinOp<ValueType, IndexType>>,
@@ -121,4 +121,81 @@ TEST_F(RowMajorAccessor, CanAssignSubranges)
 }
 
 
+class ReducedRowMajorAccessor : public ::testing::Test {
+protected:
+    using span = gko::span;
+
+    using reduced_range =
+        gko::range<gko::accessor::reduced_row_major<double, float>>;
+
+    // clang-format off
+    float data[9]{
+        1.5f, 2.f, -1.f,
+        3.f, 4.25f, -2.f,
+        5.f, 6.f, -3.f
+    };
+    //clang-format on
+    reduced_range r{data, 3u, 2u, 3u};
+};
+
+
+TEST_F(ReducedRowMajorAccessor, CanAccessData)
+{
+    EXPECT_EQ(static_cast<double>(r(0, 0)), 1.5);
+    EXPECT_EQ(static_cast<double>(r(0, 1)), 2.0);
+    EXPECT_EQ(static_cast<double>(r(1, 0)), 3.0);
+    EXPECT_EQ(static_cast<double>(r(1, 1)), 4.25);
+    EXPECT_EQ(static_cast<double>(r(2, 0)), 5.0);
+    EXPECT_EQ(static_cast<double>(r(2, 1)), 6.0);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, ComputesInArithmeticPrecision)
+{
+    double value = r(1, 1);
+
+    value += 1e-10;
+
+    EXPECT_EQ(value, 4.25 + 1e-10);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, RoundsStoredValues)
+{
+    r(1, 1) = 1.0 + 1e-10;
+
+    EXPECT_EQ(data[4], 1.0f);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, CanCreateSubrange)
+{
+    auto subr = r(span{1, 3}, span{0, 2});
+
+    EXPECT_EQ(static_cast<double>(subr(0, 0)), 3.0);
+    EXPECT_EQ(static_cast<double>(subr(0, 1)), 4.25);
+    EXPECT_EQ(static_cast<double>(subr(1, 0)), 5.0);
+    EXPECT_EQ(static_cast<double>(subr(1, 1)), 6.0);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, CanAssignValues)
+{
+    r(1, 1) = r(0, 0);
+
+    EXPECT_EQ(data[4], 1.5f);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, CanAssignSubranges)
+{
+    r(0, span{0, 2}) = r(1, span{0, 2});
+
+    EXPECT_EQ(data[0], 3.f);
+    EXPECT_EQ(data[1], 4.25f);
+    EXPECT_EQ(data[2], -1.f);
+    EXPECT_EQ(data[3], 3.f);
+}
+
+
 }  // namespace
@@ -0,0 +1,324 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/compact_record.hpp>
+
+
+#include <cmath>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+namespace {
+
+
+using CompactRecord = gko::log::CompactRecord;
+
+
+template <typename T>
+gko::uintptr id(const T *ptr)
+{
+    return reinterpret_cast<gko::uintptr>(ptr);
+}
+
+
+TEST(CompactRecord, IsEmptyAfterCreation)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+
+    ASSERT_EQ(logger->get_capacity(), 1024);
+    ASSERT_EQ(logger->get_num_events(), 0);
+    ASSERT_EQ(logger->get_num_logged_events(), 0);
+    ASSERT_TRUE(logger->get_events().empty());
+}
+
+
+TEST(CompactRecord, CatchesAllocationCompleted)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+    int dummy = 1;
+    auto ptr = id(&dummy);
+
+    logger->on<gko::log::Logger::allocation_completed>(exec.get(), 42, ptr);
+
+    ASSERT_EQ(logger->get_num_events(), 1);
+    auto data = logger->get_event(0);
+    ASSERT_EQ(data.event, gko::log::Logger::allocation_completed_mask);
+    ASSERT_EQ(data.name, nullptr);
+    ASSERT_EQ(data.object, id(exec.get()));
+    ASSERT_EQ(data.input, ptr);
+    ASSERT_EQ(data.output, 0);
+    ASSERT_EQ(data.size, 42);
+    ASSERT_TRUE(std::isnan(data.residual_norm));
+}
+
+
+TEST(CompactRecord, CatchesCopyStarted)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+    int dummy_from = 1;
+    int dummy_to = 1;
+
+    logger->on<gko::log::Logger::copy_started>(
+        exec.get(), exec.get(), id(&dummy_from), id(&dummy_to), 42);
+
+    auto data = logger->get_event(0);
+    ASSERT_EQ(data.event, gko::log::Logger::copy_started_mask);
+    ASSERT_EQ(data.object, id(exec.get()));
+    ASSERT_EQ(data.input, id(&dummy_from));
+    ASSERT_EQ(data.output, id(&dummy_to));
+    ASSERT_EQ(data.size, 42);
+}
+
+
+TEST(CompactRecord, CatchesOperationLaunched)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+    gko::Operation op;
+
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &op);
+
+    auto data = logger->get_event(0);
+    ASSERT_EQ(data.event, gko::log::Logger::operation_launched_mask);
+    ASSERT_EQ(data.name, op.get_name());
+    ASSERT_EQ(data.object, id(exec.get()));
+    ASSERT_EQ(data.input, id(&op));
+}
+
+
+TEST(CompactRecord, CatchesLinOpApplyStartedWithoutCopies)
+{
+    using Dense = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+    auto A = gko::initialize<Dense>({1.1}, exec);
+    auto b = gko::initialize<Dense>({-2.2}, exec);
+    auto x = gko::initialize<Dense>({3.3}, exec);
+
+    logger->on<gko::log::Logger::linop_apply_started>(A.get(), b.get(),
+                                                      x.get());
+
+    auto data = logger->get_event(0);
+    ASSERT_EQ(data.event, gko::log::Logger::linop_apply_started_mask);
+    ASSERT_EQ(data.object, id(A.get()));
+    ASSERT_EQ(data.input, id(b.get()));
+    ASSERT_EQ(data.output, id(x.get()));
+}
+
+
+TEST(CompactRecord, CatchesCriterionCheckCompleted)
+{
+    using Dense = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(
+        exec, gko::log::Logger::criterion_check_completed_mask, 1024, true);
+    auto criterion =
+        gko::stop::Iteration::build().with_max_iters(3u).on(exec)->generate(
+            nullptr, nullptr, nullptr);
+    constexpr gko::uint8 RelativeStoppingId{42};
+    gko::Array<gko::stopping_status> stop_status(exec, 1);
+    auto residual = gko::initialize<Dense>({1.0, 2.0}, exec);
+    auto residual_norm = Dense::create(exec, gko::dim<2>{1, 2});
+    residual_norm->at(0, 0) = -3.5;
+    residual_norm->at(0, 1) = 4.0;
+
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        criterion.get(), 7, residual.get(), residual_norm.get(), nullptr,
+        RelativeStoppingId, true, &stop_status, true, true);
+
+    auto data = logger->get_event(0);
+    ASSERT_EQ(data.event, gko::log::Logger::criterion_check_completed_mask);
+    ASSERT_EQ(data.object, id(criterion.get()));
+    ASSERT_EQ(data.input, id(residual.get()));
+    ASSERT_EQ(data.output, 0);
+    ASSERT_EQ(data.size, 7);
+    ASSERT_EQ(data.residual_norm, 3.5);
+}
+
+
+TEST(CompactRecord, CatchesCriterionCheckCompletedWithFloatNorm)
+{
+    using Dense = gko::matrix::Dense<float>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(
+        exec, gko::log::Logger::criterion_check_completed_mask, 1024, true);
+    gko::Array<gko::stopping_status> stop_status(exec, 1);
+    auto residual = gko::initialize<Dense>({-4.5}, exec);
+    auto residual_norm = gko::initialize<Dense>({4.5}, exec);
+
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        nullptr, 3, residual.get(), residual_norm.get(), nullptr, 0, true,
+        &stop_status, true, true);
+
+    ASSERT_EQ(logger->get_event(0).residual_norm, 4.5);
+}
+
+
+TEST(CompactRecord, DoesNotCaptureNormsByDefault)
+{
+    using Dense = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+    gko::Array<gko::stopping_status> stop_status(exec, 1);
+    auto residual = gko::initialize<Dense>({-4.5}, exec);
+    auto residual_norm = gko::initialize<Dense>({4.5}, exec);
+
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        nullptr, 3, residual.get(), residual_norm.get(), nullptr, 0, true,
+        &stop_status, true, true);
+
+    ASSERT_FALSE(logger->captures_norms());
+    ASSERT_TRUE(std::isnan(logger->get_event(0).residual_norm));
+}
+
+
+TEST(CompactRecord, CapturesNormOnlyOnCriterionCheckCompleted)
+{
+    using Dense = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(
+        exec, gko::log::Logger::all_events_mask, 1024, true);
+    gko::Array<gko::stopping_status> stop_status(exec, 1);
+    auto residual = gko::initialize<Dense>({-4.5}, exec);
+    auto solution = gko::initialize<Dense>({-2.5}, exec);
+    auto residual_norm = gko::initialize<Dense>({4.5}, exec);
+
+    logger->on<gko::log::Logger::criterion_check_started>(
+        nullptr, 3, residual.get(), residual_norm.get(), solution.get(), 0,
+        true);
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        nullptr, 3, residual.get(), residual_norm.get(), solution.get(), 0,
+        true, &stop_status, true, true);
+    logger->on<gko::log::Logger::iteration_complete>(
+        residual.get(), 3, residual.get(), solution.get(),
+        residual_norm.get());
+
+    ASSERT_TRUE(logger->captures_norms());
+    ASSERT_EQ(logger->get_num_events(), 3);
+    ASSERT_TRUE(std::isnan(logger->get_event(0).residual_norm));
+    ASSERT_EQ(logger->get_event(1).residual_norm, 4.5);
+    auto data = logger->get_event(2);
+    ASSERT_EQ(data.event, gko::log::Logger::iteration_complete_mask);
+    ASSERT_EQ(data.input, id(residual.get()));
+    ASSERT_EQ(data.output, id(solution.get()));
+    ASSERT_EQ(data.size, 3);
+    ASSERT_TRUE(std::isnan(data.residual_norm));
+}
+
+
+TEST(CompactRecord, IgnoresDisabledEvents)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger =
+        CompactRecord::create(exec, gko::log::Logger::free_started_mask);
+
+    logger->on<gko::log::Logger::allocation_started>(exec.get(), 42);
+    logger->on<gko::log::Logger::free_started>(exec.get(), 0);
+
+    ASSERT_EQ(logger->get_num_events(), 1);
+    ASSERT_EQ(logger->get_event(0).event,
+              gko::log::Logger::free_started_mask);
+}
+
+
+TEST(CompactRecord, OverwritesOldestEvents)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(
+        exec, gko::log::Logger::allocation_started_mask, 3);
+
+    for (gko::size_type i = 0; i < 5; ++i) {
+        logger->on<gko::log::Logger::allocation_started>(exec.get(), i);
+    }
+
+    ASSERT_EQ(logger->get_num_logged_events(), 5);
+    ASSERT_EQ(logger->get_num_events(), 3);
+    auto events = logger->get_events();
+    ASSERT_EQ(events.size(), 3);
+    ASSERT_EQ(events[0].size, 2);
+    ASSERT_EQ(events[1].size, 3);
+    ASSERT_EQ(events[2].size, 4);
+    ASSERT_LE(events[0].timestamp, events[1].timestamp);
+    ASSERT_LE(events[1].timestamp, events[2].timestamp);
+}
+
+
+TEST(CompactRecord, CountsEventsWithoutCapacity)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(
+        exec, gko::log::Logger::allocation_started_mask, 0);
+
+    logger->on<gko::log::Logger::allocation_started>(exec.get(), 42);
+
+    ASSERT_EQ(logger->get_num_logged_events(), 1);
+    ASSERT_EQ(logger->get_num_events(), 0);
+}
+
+
+TEST(CompactRecord, ThrowsOnOutOfBoundsAccess)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+
+    logger->on<gko::log::Logger::allocation_started>(exec.get(), 42);
+
+    ASSERT_THROW(logger->get_event(1), gko::OutOfBoundsError);
+}
+
+
+TEST(CompactRecord, CanBeCleared)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = CompactRecord::create(exec);
+    logger->on<gko::log::Logger::allocation_started>(exec.get(), 42);
+
+    logger->clear();
+
+    ASSERT_EQ(logger->get_num_events(), 0);
+    ASSERT_EQ(logger->get_num_logged_events(), 0);
+}
+
+
+}  // namespace
@@ -0,0 +1,246 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/profiler_hook.hpp>
+
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace {
+
+
+class NamedOperation : public gko::Operation {
+public:
+    explicit NamedOperation(const char *name) : name_{name} {}
+
+    const char *get_name() const noexcept override { return name_; }
+
+private:
+    const char *name_;
+};
+
+
+class ProfilerHook : public ::testing::Test {
+protected:
+    using Dense = gko::matrix::Dense<>;
+    using summary_entry = gko::log::ProfilerHook::summary_entry;
+
+    ProfilerHook()
+        : exec(gko::ReferenceExecutor::create()),
+          logger(gko::log::ProfilerHook::create(exec)),
+          outer("outer"),
+          inner("inner")
+    {}
+
+    static summary_entry find(const std::vector<summary_entry> &summary,
+                              const std::string &name)
+    {
+        auto it = std::find_if(
+            summary.begin(), summary.end(),
+            [&](const summary_entry &entry) { return entry.name == name; });
+        if (it == summary.end()) {
+            ADD_FAILURE() << "missing entry " << name;
+            return summary_entry{};
+        }
+        return *it;
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> exec;
+    std::shared_ptr<gko::log::ProfilerHook> logger;
+    NamedOperation outer;
+    NamedOperation inner;
+};
+
+
+TEST_F(ProfilerHook, IsEmptyAfterCreation)
+{
+    ASSERT_TRUE(logger->get_summary().empty());
+}
+
+
+TEST_F(ProfilerHook, AggregatesOperations)
+{
+    for (int i = 0; i < 3; ++i) {
+        logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+        logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+    }
+
+    auto summary = logger->get_summary();
+    ASSERT_EQ(summary.size(), 1);
+    ASSERT_EQ(summary[0].name, "outer");
+    ASSERT_EQ(summary[0].count, 3);
+    ASSERT_GE(summary[0].inclusive_time, 0);
+    ASSERT_EQ(summary[0].exclusive_time, summary[0].inclusive_time);
+    ASSERT_EQ(summary[0].bytes, 0);
+}
+
+
+TEST_F(ProfilerHook, TracksNestedRanges)
+{
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &inner);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &inner);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+
+    auto summary = logger->get_summary();
+    auto outer_entry = find(summary, "outer");
+    auto inner_entry = find(summary, "inner");
+    ASSERT_EQ(summary.size(), 2);
+    ASSERT_EQ(summary[0].name, "outer");
+    ASSERT_GE(outer_entry.inclusive_time, inner_entry.inclusive_time);
+    ASSERT_EQ(outer_entry.exclusive_time,
+              outer_entry.inclusive_time - inner_entry.inclusive_time);
+}
+
+
+TEST_F(ProfilerHook, AttributesBytesToActiveRanges)
+{
+    logger->on<gko::log::Logger::allocation_completed>(exec.get(), 1, 0);
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+    logger->on<gko::log::Logger::allocation_completed>(exec.get(), 8, 0);
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &inner);
+    logger->on<gko::log::Logger::copy_completed>(exec.get(), exec.get(), 0, 0,
+                                                 16);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &inner);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+
+    auto summary = logger->get_summary();
+    ASSERT_EQ(find(summary, "outer").bytes, 24);
+    ASSERT_EQ(find(summary, "inner").bytes, 16);
+}
+
+
+TEST_F(ProfilerHook, ClosesUnfinishedNestedRanges)
+{
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &inner);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &inner);
+
+    auto summary = logger->get_summary();
+    ASSERT_EQ(summary.size(), 2);
+    ASSERT_EQ(find(summary, "outer").count, 1);
+    ASSERT_EQ(find(summary, "inner").count, 1);
+}
+
+
+TEST_F(ProfilerHook, ProfilesLinOpApply)
+{
+    auto A = gko::share(gko::initialize<Dense>({{1.0, 2.0}, {3.0, 4.0}}, exec));
+    auto b = gko::initialize<Dense>({1.0, 1.0}, exec);
+    auto x = gko::initialize<Dense>({0.0, 0.0}, exec);
+    exec->add_logger(logger);
+    A->add_logger(logger);
+
+    A->apply(b.get(), x.get());
+
+    exec->remove_logger(logger.get());
+    auto summary = logger->get_summary();
+    auto apply = find(summary, "apply(gko::matrix::Dense<double>)");
+    ASSERT_EQ(apply.count, 1);
+    ASSERT_TRUE(std::any_of(summary.begin(), summary.end(),
+                            [](const summary_entry &entry) {
+                                return entry.name.find("simple_apply") !=
+                                       std::string::npos;
+                            }));
+}
+
+
+TEST_F(ProfilerHook, PrintsSummary)
+{
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+    std::stringstream ss;
+
+    logger->print_summary(ss);
+
+    auto str = ss.str();
+    ASSERT_NE(str.find("calls"), std::string::npos);
+    ASSERT_NE(str.find("outer"), std::string::npos);
+}
+
+
+TEST_F(ProfilerHook, WritesChromeTrace)
+{
+    auto trace_logger = gko::log::ProfilerHook::create(
+        exec, gko::log::Logger::all_events_mask, true);
+    NamedOperation quoted("\"quoted\"");
+    trace_logger->on<gko::log::Logger::operation_launched>(exec.get(),
+                                                           &quoted);
+    trace_logger->on<gko::log::Logger::operation_completed>(exec.get(),
+                                                            &quoted);
+    std::stringstream ss;
+
+    trace_logger->write_chrome_trace(ss);
+
+    auto str = ss.str();
+    ASSERT_EQ(str.find("{\"traceEvents\":["), 0);
+    ASSERT_NE(str.find("\"name\":\"\\\"quoted\\\"\""), std::string::npos);
+    ASSERT_NE(str.find("\"ph\":\"X\""), std::string::npos);
+}
+
+
+TEST_F(ProfilerHook, DoesNotRecordTraceByDefault)
+{
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+    std::stringstream ss;
+
+    logger->write_chrome_trace(ss);
+
+    ASSERT_EQ(ss.str().find("outer"), std::string::npos);
+}
+
+
+TEST_F(ProfilerHook, CanBeCleared)
+{
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &outer);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &outer);
+
+    logger->clear();
+
+    ASSERT_TRUE(logger->get_summary().empty());
+}
+
+
+}  // namespace
@@ -0,0 +1,125 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/multigrid/pgm.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace {
+
+
+class Pgm : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using MgLevel = gko::multigrid::Pgm<value_type, index_type>;
+
+    Pgm()
+        : exec(gko::ReferenceExecutor::create()),
+          pgm_factory(MgLevel::build().on(exec)),
+          mtx(gko::initialize<Mtx>({{2.0, -1.0, 0.0, 0.0},
+                                    {-1.0, 2.0, -1.0, 0.0},
+                                    {0.0, -1.0, 2.0, -1.0},
+                                    {0.0, 0.0, -1.0, 2.0}},
+                                   exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<MgLevel::Factory> pgm_factory;
+    std::shared_ptr<Mtx> mtx;
+};
+
+
+TEST_F(Pgm, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(pgm_factory->get_executor(), exec);
+}
+
+
+TEST_F(Pgm, DefaultParameters)
+{
+    ASSERT_EQ(pgm_factory->get_parameters().max_iterations, 15u);
+    ASSERT_EQ(pgm_factory->get_parameters().max_unassigned_ratio, 0.05);
+    ASSERT_EQ(pgm_factory->get_parameters().smoothed_prolongation, false);
+}
+
+
+TEST_F(Pgm, SetEverything)
+{
+    auto factory = MgLevel::build()
+                       .with_max_iterations(3u)
+                       .with_max_unassigned_ratio(0.1)
+                       .with_smoothed_prolongation(true)
+                       .with_prolongation_smoothing_weight(0.5)
+                       .on(exec);
+
+    ASSERT_EQ(factory->get_parameters().max_iterations, 3u);
+    ASSERT_EQ(factory->get_parameters().max_unassigned_ratio, 0.1);
+    ASSERT_EQ(factory->get_parameters().smoothed_prolongation, true);
+    ASSERT_EQ(factory->get_parameters().prolongation_smoothing_weight, 0.5);
+}
+
+
+TEST_F(Pgm, GeneratesLevelWithCorrectSizes)
+{
+    auto level_op = pgm_factory->generate(mtx);
+    auto level = static_cast<MgLevel *>(level_op.get());
+
+    auto coarse_size = level->get_coarse_op()->get_size()[0];
+    ASSERT_EQ(level->get_size(), gko::dim<2>(4, 4));
+    ASSERT_EQ(level->get_fine_op(), mtx);
+    ASSERT_LT(coarse_size, 4u);
+    ASSERT_EQ(level->get_prolong_op()->get_size(), gko::dim<2>(4, coarse_size));
+    ASSERT_EQ(level->get_restrict_op()->get_size(),
+              gko::dim<2>(coarse_size, 4));
+}
+
+
+TEST_F(Pgm, ThrowsOnRectangularMatrix)
+{
+    auto rectangular = Mtx::create(exec, gko::dim<2>{4, 3});
+
+    ASSERT_THROW(pgm_factory->generate(std::move(rectangular)),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
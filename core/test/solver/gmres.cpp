@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <gtest/gtest.h>
 
 
+#include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/combined.hpp>
@@ -201,6 +202,76 @@ TEST_F(Gmres, CanSetKrylovDim)
 }
 
 
+TEST_F(Gmres, UsesModifiedGramSchmidtByDefault)
+{
+    auto gmres_solver = static_cast<Solver *>(solver.get());
+
+    ASSERT_EQ(gmres_solver->get_parameters().ortho_method,
+              gko::solver::gmres::ortho_method::mgs);
+}
+
+
+TEST_F(Gmres, CanSetOrthoMethod)
+{
+    auto gmres_factory =
+        Solver::build()
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(4u).on(exec))
+            .on(exec);
+    auto solver = gmres_factory->generate(mtx);
+
+    ASSERT_EQ(solver->get_parameters().ortho_method,
+              gko::solver::gmres::ortho_method::cgs2);
+}
+
+
+TEST_F(Gmres, KeepsFullStoragePrecisionByDefault)
+{
+    auto gmres_solver = static_cast<Solver *>(solver.get());
+
+    ASSERT_EQ(gmres_solver->get_parameters().storage_precision,
+              gko::precision_reduction(0, 0));
+}
+
+
+TEST_F(Gmres, CanSetStoragePrecision)
+{
+    auto gmres_factory =
+        Solver::build()
+            .with_storage_precision(gko::precision_reduction(0, 2))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(4u).on(exec))
+            .on(exec);
+    auto solver = gmres_factory->generate(mtx);
+
+    ASSERT_EQ(solver->get_parameters().storage_precision,
+              gko::precision_reduction(0, 2));
+}
+
+
+TEST_F(Gmres, ThrowsOnReducedStoragePrecisionOnGpuExecutors)
+{
+    auto omp = gko::OmpExecutor::create();
+    auto cuda = gko::CudaExecutor::create(0, omp);
+    auto hip = gko::HipExecutor::create(0, omp);
+    auto criterion =
+        gko::share(gko::stop::Iteration::build().with_max_iters(4u).on(exec));
+
+    ASSERT_THROW(Solver::build()
+                     .with_storage_precision(gko::precision_reduction(0, 1))
+                     .with_criteria(criterion)
+                     .on(cuda)
+                     ->generate(mtx),
+                 gko::NotSupported);
+    ASSERT_THROW(Solver::build()
+                     .with_storage_precision(gko::precision_reduction(0, 1))
+                     .with_criteria(criterion)
+                     .on(hip)
+                     ->generate(mtx),
+                 gko::NotSupported);
+}
+
 TEST_F(Gmres, CanSetPreconditionerInFactory)
 {
     std::shared_ptr<Solver> gmres_precond =
@@ -146,6 +146,25 @@ TEST_F(Ir, CanBeCleared)
 }
 
 
+TEST_F(Ir, DefaultRelaxationFactorIsOne)
+{
+    ASSERT_EQ(ir_factory->get_parameters().relaxation_factor, 1.0);
+}
+
+
+TEST_F(Ir, CanSetRelaxationFactor)
+{
+    auto factory = Solver::build()
+                       .with_criteria(gko::stop::Iteration::build()
+                                          .with_max_iters(3u)
+                                          .on(exec))
+                       .with_relaxation_factor(0.9)
+                       .on(exec);
+
+    ASSERT_EQ(factory->get_parameters().relaxation_factor, 0.9);
+}
+
+
 TEST_F(Ir, CanSetInnerSolverInFactory)
 {
     auto ir_factory =
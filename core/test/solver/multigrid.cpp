@@ -0,0 +1,221 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/multigrid.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+namespace {
+
+
+class Multigrid : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using Mtx = gko::matrix::Csr<value_type, gko::int32>;
+    using Solver = gko::solver::Multigrid<value_type>;
+
+    Multigrid()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>({{2.0, -1.0, 0.0, 0.0, 0.0, 0.0},
+                                    {-1.0, 2.0, -1.0, 0.0, 0.0, 0.0},
+                                    {0.0, -1.0, 2.0, -1.0, 0.0, 0.0},
+                                    {0.0, 0.0, -1.0, 2.0, -1.0, 0.0},
+                                    {0.0, 0.0, 0.0, -1.0, 2.0, -1.0},
+                                    {0.0, 0.0, 0.0, 0.0, -1.0, 2.0}},
+                                   exec)),
+          mg_factory(Solver::build()
+                         .with_min_coarse_rows(1u)
+                         .with_criteria(gko::stop::Iteration::build()
+                                            .with_max_iters(3u)
+                                            .on(exec))
+                         .on(exec)),
+          solver(mg_factory->generate(mtx))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<Solver::Factory> mg_factory;
+    std::unique_ptr<gko::LinOp> solver;
+};
+
+
+TEST_F(Multigrid, MultigridFactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(mg_factory->get_executor(), exec);
+}
+
+
+TEST_F(Multigrid, DefaultParameters)
+{
+    auto factory = Solver::build().on(exec);
+
+    ASSERT_EQ(factory->get_parameters().mg_level, nullptr);
+    ASSERT_EQ(factory->get_parameters().max_levels, 10u);
+    ASSERT_EQ(factory->get_parameters().min_coarse_rows, 64u);
+    ASSERT_EQ(factory->get_parameters().cycle, gko::solver::multigrid_cycle::v);
+}
+
+
+TEST_F(Multigrid, MultigridFactoryCreatesCorrectSolver)
+{
+    auto mg_solver = static_cast<Solver *>(solver.get());
+
+    ASSERT_EQ(solver->get_size(), gko::dim<2>(6, 6));
+    ASSERT_EQ(mg_solver->get_system_matrix(), mtx);
+    ASSERT_GT(mg_solver->get_mg_level_list().size(), 0u);
+    ASSERT_EQ(mg_solver->get_pre_smoother_list().size(),
+              mg_solver->get_mg_level_list().size());
+    ASSERT_EQ(mg_solver->get_post_smoother_list().size(),
+              mg_solver->get_mg_level_list().size());
+    ASSERT_NE(mg_solver->get_coarsest_solver(), nullptr);
+}
+
+
+TEST_F(Multigrid, UsesPgmAsDefaultLevel)
+{
+    auto mg_solver = static_cast<Solver *>(solver.get());
+
+    using MgLevel = gko::multigrid::Pgm<value_type, gko::int32>;
+    auto level = mg_solver->get_mg_level_list()[0];
+    ASSERT_NE(dynamic_cast<const MgLevel *>(level.get()), nullptr);
+    ASSERT_EQ(level->get_size(), gko::dim<2>(6, 6));
+}
+
+
+TEST_F(Multigrid, StopsCoarseningAtMinCoarseRows)
+{
+    auto small_solver = Solver::build().on(exec)->generate(mtx);
+    auto mg_solver = static_cast<Solver *>(small_solver.get());
+
+    ASSERT_EQ(mg_solver->get_mg_level_list().size(), 0u);
+    ASSERT_EQ(mg_solver->get_coarsest_solver()->get_size(),
+              gko::dim<2>(6, 6));
+}
+
+
+TEST_F(Multigrid, StopsCoarseningAtMaxLevels)
+{
+    auto two_level_solver = Solver::build()
+                                .with_min_coarse_rows(1u)
+                                .with_max_levels(2u)
+                                .on(exec)
+                                ->generate(mtx);
+    auto mg_solver = static_cast<Solver *>(two_level_solver.get());
+
+    ASSERT_EQ(mg_solver->get_mg_level_list().size(), 1u);
+}
+
+
+TEST_F(Multigrid, ReusesPreSmootherAsPostSmoother)
+{
+    auto mg_solver = static_cast<Solver *>(solver.get());
+
+    ASSERT_EQ(mg_solver->get_pre_smoother_list()[0],
+              mg_solver->get_post_smoother_list()[0]);
+}
+
+
+TEST_F(Multigrid, CanSetSmoothersAndCoarsestSolver)
+{
+    using Ir = gko::solver::Ir<value_type>;
+    auto smoother_factory =
+        gko::share(Ir::build()
+                       .with_criteria(gko::stop::Iteration::build()
+                                          .with_max_iters(2u)
+                                          .on(exec))
+                       .on(exec));
+    auto coarsest_factory = gko::share(
+        Ir::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(5u).on(exec))
+            .on(exec));
+
+    auto mg = Solver::build()
+                  .with_min_coarse_rows(1u)
+                  .with_pre_smoother(smoother_factory)
+                  .with_post_smoother(smoother_factory)
+                  .with_coarsest_solver(coarsest_factory)
+                  .with_cycle(gko::solver::multigrid_cycle::w)
+                  .on(exec)
+                  ->generate(mtx);
+    auto mg_solver = static_cast<Solver *>(mg.get());
+
+    ASSERT_EQ(mg_solver->get_parameters().cycle,
+              gko::solver::multigrid_cycle::w);
+    ASSERT_NE(mg_solver->get_pre_smoother_list()[0],
+              mg_solver->get_post_smoother_list()[0]);
+    ASSERT_NE(dynamic_cast<const Ir *>(
+                  mg_solver->get_post_smoother_list()[0].get()),
+              nullptr);
+    ASSERT_NE(dynamic_cast<const Ir *>(
+                  mg_solver->get_coarsest_solver().get()),
+              nullptr);
+}
+
+
+TEST_F(Multigrid, CanBeCloned)
+{
+    auto clone = solver->clone();
+
+    ASSERT_EQ(clone->get_size(), gko::dim<2>(6, 6));
+    auto clone_solver = static_cast<Solver *>(clone.get());
+    ASSERT_EQ(clone_solver->get_system_matrix(), mtx);
+    ASSERT_EQ(clone_solver->get_mg_level_list().size(),
+              static_cast<Solver *>(solver.get())->get_mg_level_list().size());
+}
+
+
+TEST_F(Multigrid, CanBeCleared)
+{
+    solver->clear();
+
+    ASSERT_EQ(solver->get_size(), gko::dim<2>(0, 0));
+    auto mg_solver = static_cast<Solver *>(solver.get());
+    ASSERT_EQ(mg_solver->get_system_matrix(), nullptr);
+    ASSERT_EQ(mg_solver->get_mg_level_list().size(), 0u);
+    ASSERT_EQ(mg_solver->get_coarsest_solver(), nullptr);
+}
+
+
+}  // namespace
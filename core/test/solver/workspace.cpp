@@ -0,0 +1,216 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/workspace.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/memory.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+
+namespace {
+
+
+class Workspace : public ::testing::Test {
+protected:
+    using Mtx = gko::matrix::Dense<>;
+
+    Workspace()
+        : exec(gko::ReferenceExecutor::create()),
+          other_exec(gko::ReferenceExecutor::create())
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<const gko::Executor> other_exec;
+    gko::solver::detail::workspace workspace;
+};
+
+
+TEST_F(Workspace, CreatesVector)
+{
+    auto vector = workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    ASSERT_EQ(vector->get_size(), gko::dim<2>(3, 2));
+    ASSERT_EQ(vector->get_executor(), exec);
+}
+
+
+TEST_F(Workspace, ReusesVectorOfSameSize)
+{
+    auto vector1 = workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+    auto vector2 = workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    ASSERT_EQ(vector1, vector2);
+}
+
+
+TEST_F(Workspace, SeparatesVectorsById)
+{
+    auto vector1 = workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+    auto vector2 = workspace.get_vector<double>(exec, 1, gko::dim<2>{3, 2});
+
+    ASSERT_NE(vector1, vector2);
+}
+
+
+TEST_F(Workspace, RecreatesVectorOfDifferentSize)
+{
+    workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    auto vector = workspace.get_vector<double>(exec, 0, gko::dim<2>{4, 1});
+
+    ASSERT_EQ(vector->get_size(), gko::dim<2>(4, 1));
+}
+
+
+TEST_F(Workspace, RecreatesVectorOfDifferentType)
+{
+    workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    auto vector = workspace.get_vector<float>(exec, 0, gko::dim<2>{3, 2});
+
+    ASSERT_EQ(vector->get_size(), gko::dim<2>(3, 2));
+}
+
+
+TEST_F(Workspace, RecreatesVectorOnDifferentExecutor)
+{
+    workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    auto vector =
+        workspace.get_vector<double>(other_exec, 0, gko::dim<2>{3, 2});
+
+    ASSERT_EQ(vector->get_executor(), other_exec);
+}
+
+
+TEST_F(Workspace, CreatesConstant)
+{
+    auto constant = workspace.get_constant(exec, 0, 2.0);
+
+    ASSERT_EQ(constant->get_size(), gko::dim<2>(1, 1));
+    ASSERT_EQ(constant->at(0, 0), 2.0);
+}
+
+
+TEST_F(Workspace, ReusesConstant)
+{
+    auto constant1 = workspace.get_constant(exec, 0, 2.0);
+    auto constant2 = workspace.get_constant(exec, 0, 2.0);
+
+    ASSERT_EQ(constant1, constant2);
+}
+
+
+TEST_F(Workspace, CreatesArray)
+{
+    auto &array = workspace.get_array<gko::stopping_status>(exec, 0, 5);
+
+    ASSERT_EQ(array.get_num_elems(), 5);
+    ASSERT_EQ(array.get_executor(), exec);
+}
+
+
+TEST_F(Workspace, ReusesArrayOfSameSize)
+{
+    auto data = workspace.get_array<gko::int32>(exec, 0, 5).get_data();
+
+    auto &array = workspace.get_array<gko::int32>(exec, 0, 5);
+
+    ASSERT_EQ(array.get_data(), data);
+}
+
+
+TEST_F(Workspace, ResizesArray)
+{
+    workspace.get_array<gko::int32>(exec, 0, 5);
+
+    auto &array = workspace.get_array<gko::int32>(exec, 0, 7);
+
+    ASSERT_EQ(array.get_num_elems(), 7);
+}
+
+
+TEST_F(Workspace, RecreatesArrayOfDifferentType)
+{
+    workspace.get_array<gko::int32>(exec, 0, 5);
+
+    auto &array = workspace.get_array<gko::int64>(exec, 0, 5);
+
+    ASSERT_EQ(array.get_num_elems(), 5);
+}
+
+
+TEST_F(Workspace, KeepsSizeOfScratchArray)
+{
+    workspace.get_scratch_array<gko::int32>(exec, 0).resize_and_reset(5);
+    auto data = workspace.get_scratch_array<gko::int32>(exec, 0).get_data();
+
+    auto &array = workspace.get_scratch_array<gko::int32>(exec, 0);
+
+    ASSERT_EQ(array.get_num_elems(), 5);
+    ASSERT_EQ(array.get_data(), data);
+}
+
+TEST_F(Workspace, ClearFreesAllObjects)
+{
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>();
+    auto pooled_exec = gko::ReferenceExecutor::create(alloc);
+    workspace.get_vector<double>(pooled_exec, 0, gko::dim<2>{3, 2});
+    workspace.get_constant(pooled_exec, 0, 1.0);
+    workspace.get_array<gko::int32>(pooled_exec, 0, 5);
+
+    workspace.clear();
+
+    ASSERT_EQ(alloc->get_cached_bytes(), 3 * 64);
+}
+
+
+TEST_F(Workspace, CopyIsEmpty)
+{
+    auto vector = workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    gko::solver::detail::workspace copy(workspace);
+    auto copied_vector = copy.get_vector<double>(exec, 0, gko::dim<2>{3, 2});
+
+    ASSERT_NE(vector, copied_vector);
+    ASSERT_EQ(workspace.get_vector<double>(exec, 0, gko::dim<2>{3, 2}),
+              vector);
+}
+
+
+}  // namespace
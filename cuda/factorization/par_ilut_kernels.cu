@@ -0,0 +1,111 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/par_ilut_kernels.hpp"
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace cuda {
+/**
+ * @brief The parallel ILUT factorization namespace.
+ *
+ * @ingroup factor
+ */
+namespace par_ilut_factorization {
+
+
+template <typename ValueType, typename IndexType>
+void add_candidates(std::shared_ptr<const CudaExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType> *lu,
+                    const matrix::Csr<ValueType, IndexType> *a,
+                    const matrix::Csr<ValueType, IndexType> *l,
+                    const matrix::Csr<ValueType, IndexType> *u,
+                    Array<IndexType> &l_new_row_ptrs,
+                    Array<IndexType> &l_new_col_idxs,
+                    Array<ValueType> &l_new_vals,
+                    Array<IndexType> &u_new_row_ptrs,
+                    Array<IndexType> &u_new_col_idxs,
+                    Array<ValueType> &u_new_vals) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_ADD_CANDIDATES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_l_u_factors(std::shared_ptr<const CudaExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType> *a,
+                         matrix::Csr<ValueType, IndexType> *l,
+                         matrix::Csr<ValueType, IndexType> *u,
+                         matrix::Csr<ValueType, IndexType> *u_csc)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_COMPUTE_L_U_FACTORS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void threshold_select(std::shared_ptr<const CudaExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *m,
+                      IndexType rank, Array<ValueType> &tmp,
+                      remove_complex<ValueType> &threshold)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_THRESHOLD_SELECT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void threshold_filter(std::shared_ptr<const CudaExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *a,
+                      const matrix::Csr<ValueType, IndexType> *m,
+                      remove_complex<ValueType> threshold,
+                      remove_complex<ValueType> drop_tolerance,
+                      Array<IndexType> &new_row_ptrs,
+                      Array<IndexType> &new_col_idxs,
+                      Array<ValueType> &new_vals) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_KERNEL);
+
+
+}  // namespace par_ilut_factorization
+}  // namespace cuda
+}  // namespace kernels
+}  // namespace gko
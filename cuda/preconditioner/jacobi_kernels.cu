@@ -215,6 +215,63 @@ inline size_type agglomerate_supervariables(
 }
 
 
+constexpr int scalar_block_size = 512;
+
+
+template <typename ValueType>
+__global__ __launch_bounds__(scalar_block_size) void invert_diagonal_kernel(
+    size_type size, ValueType *__restrict__ diag)
+{
+    const auto tidx =
+        static_cast<size_type>(blockDim.x) * blockIdx.x + threadIdx.x;
+    // singular 1x1 blocks are left as they are, like in generate
+    if (tidx < size && diag[tidx] != zero<ValueType>()) {
+        diag[tidx] = one<ValueType>() / diag[tidx];
+    }
+}
+
+
+template <typename ValueType>
+__global__ __launch_bounds__(scalar_block_size) void scalar_apply_kernel(
+    size_type num_rows, size_type num_cols,
+    const ValueType *__restrict__ inverse_diag,
+    const ValueType *__restrict__ alpha, const ValueType *__restrict__ b,
+    size_type b_stride, const ValueType *__restrict__ beta,
+    ValueType *__restrict__ x, size_type x_stride)
+{
+    const auto tidx =
+        static_cast<size_type>(blockDim.x) * blockIdx.x + threadIdx.x;
+    const auto row = tidx / num_cols;
+    const auto col = tidx % num_cols;
+    if (row < num_rows) {
+        const auto result =
+            alpha[0] * inverse_diag[row] * b[row * b_stride + col];
+        x[row * x_stride + col] =
+            beta[0] == zero<ValueType>()
+                ? result
+                : beta[0] * x[row * x_stride + col] + result;
+    }
+}
+
+
+template <typename ValueType>
+__global__
+    __launch_bounds__(scalar_block_size) void simple_scalar_apply_kernel(
+        size_type num_rows, size_type num_cols,
+        const ValueType *__restrict__ inverse_diag,
+        const ValueType *__restrict__ b, size_type b_stride,
+        ValueType *__restrict__ x, size_type x_stride)
+{
+    const auto tidx =
+        static_cast<size_type>(blockDim.x) * blockIdx.x + threadIdx.x;
+    const auto row = tidx / num_cols;
+    const auto col = tidx % num_cols;
+    if (row < num_rows) {
+        x[row * x_stride + col] = inverse_diag[row] * b[row * b_stride + col];
+    }
+}
+
+
 }  // namespace
 
 
@@ -261,6 +318,63 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_JACOBI_CONVERT_TO_DENSE_KERNEL);
 
 
+template <typename ValueType>
+void invert_diagonal(std::shared_ptr<const CudaExecutor> exec,
+                     Array<ValueType> &diag)
+{
+    const auto size = diag.get_num_elems();
+    const auto grid_dim = ceildiv(size, scalar_block_size);
+
+    invert_diagonal_kernel<<<grid_dim, scalar_block_size>>>(
+        size, as_cuda_type(diag.get_data()));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_JACOBI_INVERT_DIAGONAL_KERNEL);
+
+
+template <typename ValueType>
+void scalar_apply(std::shared_ptr<const CudaExecutor> exec,
+                  const Array<ValueType> &inverse_diag,
+                  const matrix::Dense<ValueType> *alpha,
+                  const matrix::Dense<ValueType> *b,
+                  const matrix::Dense<ValueType> *beta,
+                  matrix::Dense<ValueType> *x)
+{
+    const auto num_rows = x->get_size()[0];
+    const auto num_cols = x->get_size()[1];
+    const auto grid_dim = ceildiv(num_rows * num_cols, scalar_block_size);
+
+    scalar_apply_kernel<<<grid_dim, scalar_block_size>>>(
+        num_rows, num_cols, as_cuda_type(inverse_diag.get_const_data()),
+        as_cuda_type(alpha->get_const_values()),
+        as_cuda_type(b->get_const_values()), b->get_stride(),
+        as_cuda_type(beta->get_const_values()), as_cuda_type(x->get_values()),
+        x->get_stride());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_JACOBI_SCALAR_APPLY_KERNEL);
+
+
+template <typename ValueType>
+void simple_scalar_apply(std::shared_ptr<const CudaExecutor> exec,
+                         const Array<ValueType> &inverse_diag,
+                         const matrix::Dense<ValueType> *b,
+                         matrix::Dense<ValueType> *x)
+{
+    const auto num_rows = x->get_size()[0];
+    const auto num_cols = x->get_size()[1];
+    const auto grid_dim = ceildiv(num_rows * num_cols, scalar_block_size);
+
+    simple_scalar_apply_kernel<<<grid_dim, scalar_block_size>>>(
+        num_rows, num_cols, as_cuda_type(inverse_diag.get_const_data()),
+        as_cuda_type(b->get_const_values()), b->get_stride(),
+        as_cuda_type(x->get_values()), x->get_stride());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_JACOBI_SIMPLE_SCALAR_APPLY_KERNEL);
+
+
 }  // namespace jacobi
 }  // namespace cuda
 }  // namespace kernels
@@ -33,12 +33,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/solver/cg_kernels.hpp"
 
 
+#include <algorithm>
+
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
 
 
 #include "cuda/base/math.hpp"
 #include "cuda/base/types.hpp"
+#include "cuda/components/atomic.cuh"
+#include "cuda/components/cooperative_groups.cuh"
+#include "cuda/components/reduction.cuh"
+#include "cuda/components/uninitialized_array.hpp"
+#include "cuda/components/zero_array.hpp"
 
 
 namespace gko {
@@ -55,6 +63,10 @@ namespace cg {
 constexpr int default_block_size = 512;
 
 
+// number of rows each thread handles in the kernels computing reductions
+constexpr int rows_per_thread = 4;
+
+
 #include "common/solver/cg_kernels.hpp.inc"
 
 
@@ -110,20 +122,33 @@ void step_2(std::shared_ptr<const CudaExecutor> exec,
             const matrix::Dense<ValueType> *q,
             const matrix::Dense<ValueType> *beta,
             const matrix::Dense<ValueType> *rho,
+            matrix::Dense<ValueType> *residual_norm,
             const Array<stopping_status> *stop_status)
 {
+    const auto num_rows = r->get_size()[0];
+    const auto num_cols = r->get_size()[1];
+    if (num_cols == 0) {
+        return;
+    }
+    zero_array(num_cols, residual_norm->get_values());
     const dim3 block_size(default_block_size, 1, 1);
     const dim3 grid_size(
-        ceildiv(p->get_size()[0] * p->get_stride(), block_size.x), 1, 1);
+        std::max<size_type>(
+            ceildiv(num_rows, block_size.x * rows_per_thread), 1),
+        num_cols, 1);
 
     step_2_kernel<<<grid_size, block_size, 0, 0>>>(
-        p->get_size()[0], p->get_size()[1], p->get_stride(), x->get_stride(),
+        num_rows, r->get_stride(), x->get_stride(),
         as_cuda_type(x->get_values()), as_cuda_type(r->get_values()),
         as_cuda_type(p->get_const_values()),
         as_cuda_type(q->get_const_values()),
         as_cuda_type(beta->get_const_values()),
         as_cuda_type(rho->get_const_values()),
-        as_cuda_type(stop_status->get_const_data()));
+        as_cuda_type(stop_status->get_const_data()),
+        as_cuda_type(residual_norm->get_values()));
+    compute_sqrt_kernel<<<ceildiv(num_cols, default_block_size),
+                          default_block_size, 0, 0>>>(
+        num_cols, as_cuda_type(residual_norm->get_values()));
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
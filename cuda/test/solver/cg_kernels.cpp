@@ -192,7 +192,7 @@ TEST_F(Cg, CudaCgInitializeIsEquivalentToRef)
     GKO_ASSERT_MTX_NEAR(d_p, p, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_q, q, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_prev_rho, prev_rho, 1e-14);
-    GKO_ASSERT_MTX_NEAR(d_rho, rho, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_rho, rho, 1e-13);
     GKO_ASSERT_ARRAY_EQ(d_stop_status, stop_status);
 }
 
@@ -214,17 +214,21 @@ TEST_F(Cg, CudaCgStep1IsEquivalentToRef)
 TEST_F(Cg, CudaCgStep2IsEquivalentToRef)
 {
     initialize_data();
-    gko::kernels::reference::cg::step_2(ref, x.get(), r.get(), p.get(), q.get(),
-                                        beta.get(), rho.get(),
-                                        stop_status.get());
-    gko::kernels::cuda::cg::step_2(cuda, d_x.get(), d_r.get(), d_p.get(),
-                                   d_q.get(), d_beta.get(), d_rho.get(),
-                                   d_stop_status.get());
+    auto residual_norm = Mtx::create(ref, rho->get_size());
+    auto d_residual_norm = Mtx::create(cuda, rho->get_size());
+
+    gko::kernels::reference::cg::step_2(
+        ref, x.get(), r.get(), p.get(), q.get(), beta.get(), rho.get(),
+        residual_norm.get(), stop_status.get());
+    gko::kernels::cuda::cg::step_2(
+        cuda, d_x.get(), d_r.get(), d_p.get(), d_q.get(), d_beta.get(),
+        d_rho.get(), d_residual_norm.get(), d_stop_status.get());
 
     GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_r, r, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_p, p, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_q, q, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
 }
 
 
@@ -93,6 +93,9 @@ protected:
         hessenberg = gen_mtx(gko::solver::default_krylov_dim + 1,
                              gko::solver::default_krylov_dim * n);
         hessenberg_iter = gen_mtx(gko::solver::default_krylov_dim + 1, n);
+        projection = gen_mtx(gko::solver::default_krylov_dim + 1, n);
+        reduction_workspace = std::unique_ptr<gko::Array<Mtx::value_type>>(
+            new gko::Array<Mtx::value_type>(ref));
         residual = gen_mtx(m, n);
         residual_norm = gen_mtx(1, n);
         residual_norm_collection =
@@ -127,6 +130,10 @@ protected:
         d_hessenberg->copy_from(hessenberg.get());
         d_hessenberg_iter = Mtx::create(cuda);
         d_hessenberg_iter->copy_from(hessenberg_iter.get());
+        d_projection = Mtx::create(cuda);
+        d_projection->copy_from(projection.get());
+        d_reduction_workspace = std::unique_ptr<gko::Array<Mtx::value_type>>(
+            new gko::Array<Mtx::value_type>(cuda));
         d_residual = Mtx::create(cuda);
         d_residual->copy_from(residual.get());
         d_residual_norm = Mtx::create(cuda);
@@ -159,6 +166,8 @@ protected:
     std::unique_ptr<Mtx> next_krylov_basis;
     std::unique_ptr<Mtx> hessenberg;
     std::unique_ptr<Mtx> hessenberg_iter;
+    std::unique_ptr<Mtx> projection;
+    std::unique_ptr<gko::Array<Mtx::value_type>> reduction_workspace;
     std::unique_ptr<Mtx> residual;
     std::unique_ptr<Mtx> residual_norm;
     std::unique_ptr<Mtx> residual_norm_collection;
@@ -176,6 +185,8 @@ protected:
     std::unique_ptr<Mtx> d_next_krylov_basis;
     std::unique_ptr<Mtx> d_hessenberg;
     std::unique_ptr<Mtx> d_hessenberg_iter;
+    std::unique_ptr<Mtx> d_projection;
+    std::unique_ptr<gko::Array<Mtx::value_type>> d_reduction_workspace;
     std::unique_ptr<Mtx> d_residual;
     std::unique_ptr<Mtx> d_residual_norm;
     std::unique_ptr<Mtx> d_residual_norm_collection;
@@ -231,17 +242,19 @@ TEST_F(Gmres, CudaGmresStep1IsEquivalentToRef)
 {
     initialize_data();
     int iter = 5;
+    const auto ortho = gko::solver::gmres::ortho_method::mgs;
 
     gko::kernels::reference::gmres::step_1(
         ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
         residual_norm.get(), residual_norm_collection.get(), krylov_bases.get(),
-        hessenberg_iter.get(), b_norm.get(), iter, final_iter_nums.get(),
-        stop_status.get());
+        hessenberg_iter.get(), projection.get(), reduction_workspace.get(),
+        b_norm.get(), iter, final_iter_nums.get(), stop_status.get(), ortho);
     gko::kernels::cuda::gmres::step_1(
         cuda, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
         d_residual_norm.get(), d_residual_norm_collection.get(),
-        d_krylov_bases.get(), d_hessenberg_iter.get(), d_b_norm.get(), iter,
-        d_final_iter_nums.get(), d_stop_status.get());
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
 
     GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-14);
@@ -255,6 +268,66 @@ TEST_F(Gmres, CudaGmresStep1IsEquivalentToRef)
 }
 
 
+TEST_F(Gmres, CudaGmresStep1WithCgsIsEquivalentToRef)
+{
+    initialize_data();
+    int iter = 5;
+    const auto ortho = gko::solver::gmres::ortho_method::cgs;
+
+    gko::kernels::reference::gmres::step_1(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(), krylov_bases.get(),
+        hessenberg_iter.get(), projection.get(), reduction_workspace.get(),
+        b_norm.get(), iter, final_iter_nums.get(), stop_status.get(), ortho);
+    gko::kernels::cuda::gmres::step_1(
+        cuda, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
+
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-13);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_krylov_bases, krylov_bases, 1e-13);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
+TEST_F(Gmres, CudaGmresStep1WithCgs2IsEquivalentToRef)
+{
+    initialize_data();
+    int iter = 5;
+    const auto ortho = gko::solver::gmres::ortho_method::cgs2;
+
+    gko::kernels::reference::gmres::step_1(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(), krylov_bases.get(),
+        hessenberg_iter.get(), projection.get(), reduction_workspace.get(),
+        b_norm.get(), iter, final_iter_nums.get(), stop_status.get(), ortho);
+    gko::kernels::cuda::gmres::step_1(
+        cuda, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
+
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-13);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_krylov_bases, krylov_bases, 1e-13);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
 TEST_F(Gmres, CudaGmresStep2IsEquivalentToRef)
 {
     initialize_data();
@@ -646,6 +646,16 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const HipExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType> *a,
+                    const matrix::Csr<ValueType, IndexType> *b,
+                    matrix::Csr<ValueType, IndexType> *c) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+
+
 template <typename IndexType>
 void convert_row_ptrs_to_idxs(std::shared_ptr<const HipExecutor> exec,
                               const IndexType *ptrs, size_type num_rows,
@@ -1141,6 +1151,35 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_IS_SORTED_BY_COLUMN_INDEX);
 
 
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const HipExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *orig,
+                      Array<ValueType> &diag)
+{
+    const auto diag_size = diag.get_num_elems();
+    const auto grid_dim = ceildiv(diag_size, default_block_size);
+
+    hipLaunchKernelGGL(kernel::extract_diagonal, dim3(grid_dim),
+                       dim3(default_block_size), 0, 0, diag_size,
+                       as_hip_type(orig->get_const_row_ptrs()),
+                       as_hip_type(orig->get_const_col_idxs()),
+                       as_hip_type(orig->get_const_values()),
+                       as_hip_type(diag.get_data()));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
+
+
+template <typename ValueType, typename IndexType>
+void scatter_values(std::shared_ptr<const HipExecutor> exec,
+                    const Array<ValueType> &values,
+                    const Array<IndexType> &positions,
+                    matrix::Csr<ValueType, IndexType> *mtx) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SCATTER_VALUES_KERNEL);
+
+
 }  // namespace csr
 }  // namespace hip
 }  // namespace kernels
@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/solver/bicgstab_kernels.hpp"
 
 
+#include <algorithm>
+
+
 #include <hip/hip_runtime.h>
 
 
@@ -42,6 +45,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "hip/base/math.hip.hpp"
 #include "hip/base/types.hip.hpp"
+#include "hip/components/atomic.hip.hpp"
+#include "hip/components/cooperative_groups.hip.hpp"
+#include "hip/components/reduction.hip.hpp"
+#include "hip/components/uninitialized_array.hip.hpp"
+#include "hip/components/zero_array.hip.hpp"
 
 
 namespace gko {
@@ -58,6 +66,10 @@ namespace bicgstab {
 constexpr int default_block_size = 512;
 
 
+// number of rows each thread handles in the kernels computing reductions
+constexpr int rows_per_thread = 4;
+
+
 #include "common/solver/bicgstab_kernels.hpp.inc"
 
 
@@ -129,20 +141,33 @@ void step_2(std::shared_ptr<const HipExecutor> exec,
             const matrix::Dense<ValueType> *rho,
             matrix::Dense<ValueType> *alpha,
             const matrix::Dense<ValueType> *beta,
+            matrix::Dense<ValueType> *s_norm,
             const Array<stopping_status> *stop_status)
 {
+    const auto num_rows = r->get_size()[0];
+    const auto num_cols = r->get_size()[1];
+    if (num_cols == 0) {
+        return;
+    }
+    zero_array(num_cols, s_norm->get_values());
     const dim3 block_size(default_block_size, 1, 1);
     const dim3 grid_size(
-        ceildiv(r->get_size()[0] * r->get_stride(), block_size.x), 1, 1);
+        std::max<size_type>(
+            ceildiv(num_rows, block_size.x * rows_per_thread), 1),
+        num_cols, 1);
 
     hipLaunchKernelGGL(
-        step_2_kernel, dim3(grid_size), dim3(block_size), 0, 0,
-        r->get_size()[0], r->get_size()[1], r->get_stride(),
-        as_hip_type(r->get_const_values()), as_hip_type(s->get_values()),
-        as_hip_type(v->get_const_values()),
+        step_2_kernel, dim3(grid_size), dim3(block_size), 0, 0, num_rows,
+        r->get_stride(), as_hip_type(r->get_const_values()),
+        as_hip_type(s->get_values()), as_hip_type(v->get_const_values()),
         as_hip_type(rho->get_const_values()), as_hip_type(alpha->get_values()),
         as_hip_type(beta->get_const_values()),
-        as_hip_type(stop_status->get_const_data()));
+        as_hip_type(stop_status->get_const_data()),
+        as_hip_type(s_norm->get_values()));
+    hipLaunchKernelGGL(compute_sqrt_kernel,
+                       dim3(ceildiv(num_cols, default_block_size)),
+                       dim3(default_block_size), 0, 0, num_cols,
+                       as_hip_type(s_norm->get_values()));
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_2_KERNEL);
@@ -155,23 +180,40 @@ void step_3(
     const matrix::Dense<ValueType> *t, const matrix::Dense<ValueType> *y,
     const matrix::Dense<ValueType> *z, const matrix::Dense<ValueType> *alpha,
     const matrix::Dense<ValueType> *beta, const matrix::Dense<ValueType> *gamma,
-    matrix::Dense<ValueType> *omega, const Array<stopping_status> *stop_status)
+    matrix::Dense<ValueType> *omega, const matrix::Dense<ValueType> *rr,
+    matrix::Dense<ValueType> *rho, matrix::Dense<ValueType> *residual_norm,
+    const Array<stopping_status> *stop_status)
 {
+    const auto num_rows = r->get_size()[0];
+    const auto num_cols = r->get_size()[1];
+    if (num_cols == 0) {
+        return;
+    }
+    zero_array(num_cols, rho->get_values());
+    zero_array(num_cols, residual_norm->get_values());
     const dim3 block_size(default_block_size, 1, 1);
     const dim3 grid_size(
-        ceildiv(r->get_size()[0] * r->get_stride(), block_size.x), 1, 1);
+        std::max<size_type>(
+            ceildiv(num_rows, block_size.x * rows_per_thread), 1),
+        num_cols, 1);
 
     hipLaunchKernelGGL(
-        step_3_kernel, dim3(grid_size), dim3(block_size), 0, 0,
-        r->get_size()[0], r->get_size()[1], r->get_stride(), x->get_stride(),
-        as_hip_type(x->get_values()), as_hip_type(r->get_values()),
-        as_hip_type(s->get_const_values()), as_hip_type(t->get_const_values()),
-        as_hip_type(y->get_const_values()), as_hip_type(z->get_const_values()),
+        step_3_kernel, dim3(grid_size), dim3(block_size), 0, 0, num_rows,
+        r->get_stride(), x->get_stride(), as_hip_type(x->get_values()),
+        as_hip_type(r->get_values()), as_hip_type(s->get_const_values()),
+        as_hip_type(t->get_const_values()), as_hip_type(y->get_const_values()),
+        as_hip_type(z->get_const_values()),
         as_hip_type(alpha->get_const_values()),
         as_hip_type(beta->get_const_values()),
         as_hip_type(gamma->get_const_values()),
-        as_hip_type(omega->get_values()),
-        as_hip_type(stop_status->get_const_data()));
+        as_hip_type(omega->get_values()), as_hip_type(rr->get_const_values()),
+        as_hip_type(stop_status->get_const_data()),
+        as_hip_type(rho->get_values()),
+        as_hip_type(residual_norm->get_values()));
+    hipLaunchKernelGGL(compute_sqrt_kernel,
+                       dim3(ceildiv(num_cols, default_block_size)),
+                       dim3(default_block_size), 0, 0, num_cols,
+                       as_hip_type(residual_norm->get_values()));
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_KERNEL);
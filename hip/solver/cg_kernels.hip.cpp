@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/solver/cg_kernels.hpp"
 
 
+#include <algorithm>
+
+
 #include <hip/hip_runtime.h>
 
 
@@ -42,6 +45,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "hip/base/math.hip.hpp"
 #include "hip/base/types.hip.hpp"
+#include "hip/components/atomic.hip.hpp"
+#include "hip/components/cooperative_groups.hip.hpp"
+#include "hip/components/reduction.hip.hpp"
+#include "hip/components/uninitialized_array.hip.hpp"
+#include "hip/components/zero_array.hip.hpp"
 
 
 namespace gko {
@@ -58,6 +66,10 @@ namespace cg {
 constexpr int default_block_size = 512;
 
 
+// number of rows each thread handles in the kernels computing reductions
+constexpr int rows_per_thread = 4;
+
+
 #include "common/solver/cg_kernels.hpp.inc"
 
 
@@ -115,20 +127,34 @@ void step_2(std::shared_ptr<const HipExecutor> exec,
             const matrix::Dense<ValueType> *q,
             const matrix::Dense<ValueType> *beta,
             const matrix::Dense<ValueType> *rho,
+            matrix::Dense<ValueType> *residual_norm,
             const Array<stopping_status> *stop_status)
 {
+    const auto num_rows = r->get_size()[0];
+    const auto num_cols = r->get_size()[1];
+    if (num_cols == 0) {
+        return;
+    }
+    zero_array(num_cols, residual_norm->get_values());
     const dim3 block_size(default_block_size, 1, 1);
     const dim3 grid_size(
-        ceildiv(p->get_size()[0] * p->get_stride(), block_size.x), 1, 1);
+        std::max<size_type>(
+            ceildiv(num_rows, block_size.x * rows_per_thread), 1),
+        num_cols, 1);
 
     hipLaunchKernelGGL(
-        step_2_kernel, dim3(grid_size), dim3(block_size), 0, 0,
-        p->get_size()[0], p->get_size()[1], p->get_stride(), x->get_stride(),
-        as_hip_type(x->get_values()), as_hip_type(r->get_values()),
-        as_hip_type(p->get_const_values()), as_hip_type(q->get_const_values()),
+        step_2_kernel, dim3(grid_size), dim3(block_size), 0, 0, num_rows,
+        r->get_stride(), x->get_stride(), as_hip_type(x->get_values()),
+        as_hip_type(r->get_values()), as_hip_type(p->get_const_values()),
+        as_hip_type(q->get_const_values()),
         as_hip_type(beta->get_const_values()),
         as_hip_type(rho->get_const_values()),
-        as_hip_type(stop_status->get_const_data()));
+        as_hip_type(stop_status->get_const_data()),
+        as_hip_type(residual_norm->get_values()));
+    hipLaunchKernelGGL(compute_sqrt_kernel,
+                       dim3(ceildiv(num_cols, default_block_size)),
+                       dim3(default_block_size), 0, 0, num_cols,
+                       as_hip_type(residual_norm->get_values()));
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
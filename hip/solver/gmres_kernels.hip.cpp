@@ -146,43 +146,106 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_INITIALIZE_2_KERNEL);
 
 
 template <typename ValueType>
-void finish_arnoldi(std::shared_ptr<const HipExecutor> exec,
-                    matrix::Dense<ValueType> *next_krylov_basis,
-                    matrix::Dense<ValueType> *krylov_bases,
-                    matrix::Dense<ValueType> *hessenberg_iter, size_type iter,
-                    const stopping_status *stop_status)
+void orthogonalize_cgs(std::shared_ptr<const HipExecutor> exec,
+                       matrix::Dense<ValueType> *next_krylov_basis,
+                       const matrix::Dense<ValueType> *krylov_bases,
+                       matrix::Dense<ValueType> *projection, size_type iter,
+                       const stopping_status *stop_status)
 {
     const auto stride_next_krylov = next_krylov_basis->get_stride();
     const auto stride_krylov = krylov_bases->get_stride();
-    const auto stride_hessenberg = hessenberg_iter->get_stride();
+    const auto stride_projection = projection->get_stride();
     const auto dim_size = next_krylov_basis->get_size();
-    auto hipblas_handle = exec->get_hipblas_handle();
     const dim3 grid_size(ceildiv(dim_size[1], default_dot_dim),
                          exec->get_num_multiprocessor() * 2);
     const dim3 block_size(default_dot_dim, default_dot_dim);
+    // all projections are computed before next_krylov_basis is modified
     for (size_type k = 0; k < iter + 1; ++k) {
         zero_array(dim_size[1],
-                   hessenberg_iter->get_values() + k * stride_hessenberg);
+                   projection->get_values() + k * stride_projection);
         hipLaunchKernelGGL(
             multidot_kernel, dim3(grid_size), dim3(block_size), 0, 0, k,
             dim_size[0], dim_size[1],
             as_hip_type(next_krylov_basis->get_const_values()),
             stride_next_krylov, as_hip_type(krylov_bases->get_const_values()),
-            stride_krylov, as_hip_type(hessenberg_iter->get_values()),
-            stride_hessenberg, as_hip_type(stop_status));
+            stride_krylov, as_hip_type(projection->get_values()),
+            stride_projection, as_hip_type(stop_status));
+    }
+    for (size_type k = 0; k < iter + 1; ++k) {
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(update_next_krylov_kernel<default_block_size>),
             dim3(ceildiv(dim_size[0] * stride_next_krylov, default_block_size)),
             dim3(default_block_size), 0, 0, k, dim_size[0], dim_size[1],
             as_hip_type(next_krylov_basis->get_values()), stride_next_krylov,
             as_hip_type(krylov_bases->get_const_values()), stride_krylov,
-            as_hip_type(hessenberg_iter->get_const_values()), stride_hessenberg,
+            as_hip_type(projection->get_const_values()), stride_projection,
             as_hip_type(stop_status));
     }
-    // for i in 1:iter
-    //     hessenberg(iter, i) = next_krylov_basis' * krylov_bases(:, i)
-    //     next_krylov_basis  -= hessenberg(iter, i) * krylov_bases(:, i)
-    // end
+    // projection         = krylov_bases(:, 1:iter)' * next_krylov_basis
+    // next_krylov_basis -= krylov_bases(:, 1:iter) * projection
+}
+
+
+template <typename ValueType>
+void finish_arnoldi(std::shared_ptr<const HipExecutor> exec,
+                    matrix::Dense<ValueType> *next_krylov_basis,
+                    matrix::Dense<ValueType> *krylov_bases,
+                    matrix::Dense<ValueType> *hessenberg_iter,
+                    matrix::Dense<ValueType> *projection, size_type iter,
+                    const stopping_status *stop_status,
+                    solver::gmres::ortho_method ortho)
+{
+    const auto stride_next_krylov = next_krylov_basis->get_stride();
+    const auto stride_krylov = krylov_bases->get_stride();
+    const auto stride_hessenberg = hessenberg_iter->get_stride();
+    const auto dim_size = next_krylov_basis->get_size();
+    auto hipblas_handle = exec->get_hipblas_handle();
+    const dim3 grid_size(ceildiv(dim_size[1], default_dot_dim),
+                         exec->get_num_multiprocessor() * 2);
+    const dim3 block_size(default_dot_dim, default_dot_dim);
+    if (ortho == solver::gmres::ortho_method::mgs) {
+        for (size_type k = 0; k < iter + 1; ++k) {
+            zero_array(dim_size[1],
+                       hessenberg_iter->get_values() + k * stride_hessenberg);
+            hipLaunchKernelGGL(
+                multidot_kernel, dim3(grid_size), dim3(block_size), 0, 0, k,
+                dim_size[0], dim_size[1],
+                as_hip_type(next_krylov_basis->get_const_values()),
+                stride_next_krylov,
+                as_hip_type(krylov_bases->get_const_values()), stride_krylov,
+                as_hip_type(hessenberg_iter->get_values()), stride_hessenberg,
+                as_hip_type(stop_status));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(update_next_krylov_kernel<default_block_size>),
+                dim3(ceildiv(dim_size[0] * stride_next_krylov,
+                             default_block_size)),
+                dim3(default_block_size), 0, 0, k, dim_size[0], dim_size[1],
+                as_hip_type(next_krylov_basis->get_values()),
+                stride_next_krylov,
+                as_hip_type(krylov_bases->get_const_values()), stride_krylov,
+                as_hip_type(hessenberg_iter->get_const_values()),
+                stride_hessenberg, as_hip_type(stop_status));
+        }
+        // for i in 1:iter
+        //     hessenberg(iter, i) = next_krylov_basis' * krylov_bases(:, i)
+        //     next_krylov_basis  -= hessenberg(iter, i) * krylov_bases(:, i)
+        // end
+    } else {
+        orthogonalize_cgs(exec, next_krylov_basis, krylov_bases,
+                          hessenberg_iter, iter, stop_status);
+        if (ortho == solver::gmres::ortho_method::cgs2) {
+            orthogonalize_cgs(exec, next_krylov_basis, krylov_bases,
+                              projection, iter, stop_status);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(add_projection_kernel<default_block_size>),
+                dim3(ceildiv((iter + 1) * dim_size[1], default_block_size)),
+                dim3(default_block_size), 0, 0, iter, dim_size[1],
+                as_hip_type(projection->get_const_values()),
+                projection->get_stride(),
+                as_hip_type(hessenberg_iter->get_values()), stride_hessenberg,
+                as_hip_type(stop_status));
+        }
+    }
 
 
     hipLaunchKernelGGL(
@@ -247,9 +310,12 @@ void step_1(std::shared_ptr<const HipExecutor> exec,
             matrix::Dense<ValueType> *residual_norm_collection,
             matrix::Dense<ValueType> *krylov_bases,
             matrix::Dense<ValueType> *hessenberg_iter,
+            matrix::Dense<ValueType> *projection,
+            Array<ValueType> *reduction_workspace,
             const matrix::Dense<ValueType> *b_norm, size_type iter,
             Array<size_type> *final_iter_nums,
-            const Array<stopping_status> *stop_status)
+            const Array<stopping_status> *stop_status,
+            solver::gmres::ortho_method ortho)
 {
     hipLaunchKernelGGL(
         increase_final_iteration_numbers_kernel,
@@ -259,8 +325,8 @@ void step_1(std::shared_ptr<const HipExecutor> exec,
         as_hip_type(final_iter_nums->get_data()),
         as_hip_type(stop_status->get_const_data()),
         final_iter_nums->get_num_elems());
-    finish_arnoldi(exec, next_krylov_basis, krylov_bases, hessenberg_iter, iter,
-                   stop_status->get_const_data());
+    finish_arnoldi(exec, next_krylov_basis, krylov_bases, hessenberg_iter,
+                   projection, iter, stop_status->get_const_data(), ortho);
     givens_rotation(exec, givens_sin, givens_cos, hessenberg_iter,
                     residual_norm, residual_norm_collection, b_norm, iter,
                     stop_status);
@@ -343,6 +409,55 @@ void step_2(std::shared_ptr<const HipExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void initialize_2_compressed(
+    std::shared_ptr<const HipExecutor> exec,
+    const matrix::Dense<ValueType> *residual,
+    matrix::Dense<ValueType> *residual_norm,
+    matrix::Dense<ValueType> *residual_norm_collection,
+    matrix::Dense<ValueType> *next_krylov_basis,
+    Array<ValueType> *krylov_bases, precision_reduction storage_prec,
+    Array<size_type> *final_iter_nums,
+    size_type krylov_dim) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_GMRES_INITIALIZE_2_COMPRESSED_KERNEL);
+
+
+template <typename ValueType>
+void step_1_compressed(std::shared_ptr<const HipExecutor> exec,
+                       matrix::Dense<ValueType> *next_krylov_basis,
+                       matrix::Dense<ValueType> *givens_sin,
+                       matrix::Dense<ValueType> *givens_cos,
+                       matrix::Dense<ValueType> *residual_norm,
+                       matrix::Dense<ValueType> *residual_norm_collection,
+                       Array<ValueType> *krylov_bases,
+                       precision_reduction storage_prec,
+                       matrix::Dense<ValueType> *hessenberg_iter,
+                       matrix::Dense<ValueType> *projection,
+                       Array<ValueType> *reduction_workspace,
+                       const matrix::Dense<ValueType> *b_norm, size_type iter,
+                       size_type krylov_dim, Array<size_type> *final_iter_nums,
+                       const Array<stopping_status> *stop_status,
+                       solver::gmres::ortho_method ortho) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_STEP_1_COMPRESSED_KERNEL);
+
+
+template <typename ValueType>
+void step_2_compressed(std::shared_ptr<const HipExecutor> exec,
+                       const matrix::Dense<ValueType> *residual_norm_collection,
+                       const Array<ValueType> *krylov_bases,
+                       precision_reduction storage_prec,
+                       const matrix::Dense<ValueType> *hessenberg,
+                       matrix::Dense<ValueType> *y,
+                       matrix::Dense<ValueType> *before_preconditioner,
+                       const Array<size_type> *final_iter_nums,
+                       size_type krylov_dim) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_STEP_2_COMPRESSED_KERNEL);
+
+
 }  // namespace gmres
 }  // namespace hip
 }  // namespace kernels
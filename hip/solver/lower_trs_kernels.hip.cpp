@@ -105,6 +105,17 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_LOWER_TRS_SOLVE_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void solve_conj_transposed(std::shared_ptr<const HipExecutor> exec,
+                           const matrix::Csr<ValueType, IndexType> *matrix,
+                           const solver::SolveStruct *solve_struct,
+                           const matrix::Dense<ValueType> *b,
+                           matrix::Dense<ValueType> *x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_LOWER_TRS_SOLVE_CONJ_TRANSPOSED_KERNEL);
+
+
 }  // namespace lower_trs
 }  // namespace hip
 }  // namespace kernels
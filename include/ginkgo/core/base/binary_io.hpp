@@ -0,0 +1,129 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_BASE_BINARY_IO_HPP_
+#define GKO_CORE_BASE_BINARY_IO_HPP_
+
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace gko {
+
+
+/**
+ * The version of the binary matrix format written by gko::write_binary.
+ *
+ * The binary format consists of a 64 byte header followed by the raw arrays of
+ * the matrix, each of them starting at a 64 byte aligned offset. The header
+ * stores a magic string, the format version, the storage format (matrix::Dense,
+ * matrix::Coo or matrix::Csr), tags for the value and index type, the matrix
+ * size and the number of stored elements. All data is stored in the native
+ * byte order of the machine writing the file.
+ *
+ * | storage format | arrays (in this order)                     |
+ * |----------------|--------------------------------------------|
+ * | Dense          | values (row-major, without padding)        |
+ * | Coo            | row_idxs, col_idxs, values                 |
+ * | Csr            | row_ptrs, col_idxs, values                 |
+ */
+constexpr uint32 binary_format_version = 1;
+
+
+/**
+ * Reads a matrix stored in the binary format from an input stream.
+ *
+ * The data is copied from the stream into a buffer on the host, and the arrays
+ * of the matrix are created directly on this buffer.
+ *
+ * @tparam MatrixType  the matrix type, one of matrix::Dense, matrix::Coo and
+ *                     matrix::Csr. Its value and index type have to match the
+ *                     ones stored in the stream.
+ *
+ * @param is  input stream from which to read the data
+ * @param exec  executor on which the matrix is created
+ *
+ * @return the matrix read from the stream
+ */
+template <typename MatrixType>
+std::unique_ptr<MatrixType> read_binary(std::istream &is,
+                                        std::shared_ptr<const Executor> exec);
+
+
+/**
+ * Reads a matrix stored in the binary format from a file.
+ *
+ * Where supported, the file is memory-mapped and the arrays of the matrix are
+ * created on the mapped memory without parsing or copying the data if `exec`
+ * is a host executor. The mapping is private, modifications to the matrix are
+ * not written back to the file. It is released once all arrays created on it
+ * have been destroyed. For other executors, the arrays are copied from the
+ * mapped file to `exec`.
+ *
+ * @tparam MatrixType  the matrix type, one of matrix::Dense, matrix::Coo and
+ *                     matrix::Csr. Its value and index type have to match the
+ *                     ones stored in the file.
+ *
+ * @param filename  name of the file from which to read the data
+ * @param exec  executor on which the matrix is created
+ *
+ * @return the matrix read from the file
+ */
+template <typename MatrixType>
+std::unique_ptr<MatrixType> read_binary(const std::string &filename,
+                                        std::shared_ptr<const Executor> exec);
+
+
+/**
+ * Writes a matrix to a stream in the binary format.
+ *
+ * @tparam MatrixType  the matrix type, one of matrix::Dense, matrix::Coo and
+ *                     matrix::Csr
+ *
+ * @param os  output stream where the data is to be written
+ * @param matrix  the matrix to write
+ */
+template <typename MatrixType>
+void write_binary(std::ostream &os, const MatrixType *matrix);
+
+
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_BINARY_IO_HPP_
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <type_traits>
 
 
+#include <ginkgo/core/base/memory.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/log/logger.hpp>
 #include <ginkgo/core/synthesizer/containers.hpp>
@@ -771,10 +772,15 @@ class OmpExecutor : public detail::ExecutorBase<OmpExecutor>,
 public:
     /**
      * Creates a new OmpExecutor.
+     *
+     * @param alloc  the allocator used for all memory allocated by the
+     *               executor, e.g. a PooledCpuAllocator to reuse memory across
+     *               repeated solver applications
      */
-    static std::shared_ptr<OmpExecutor> create()
+    static std::shared_ptr<OmpExecutor> create(
+        std::shared_ptr<Allocator> alloc = std::make_shared<CpuAllocator>())
     {
-        return std::shared_ptr<OmpExecutor>(new OmpExecutor());
+        return std::shared_ptr<OmpExecutor>(new OmpExecutor(std::move(alloc)));
     }
 
     std::shared_ptr<Executor> get_master() noexcept override;
@@ -783,14 +789,30 @@ public:
 
     void synchronize() const override;
 
+    /**
+     * Returns the allocator used by this executor.
+     *
+     * @return the allocator used by this executor
+     */
+    std::shared_ptr<Allocator> get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
 protected:
-    OmpExecutor() = default;
+    OmpExecutor(
+        std::shared_ptr<Allocator> alloc = std::make_shared<CpuAllocator>())
+        : alloc_{std::move(alloc)}
+    {}
 
     void *raw_alloc(size_type size) const override;
 
     void raw_free(void *ptr) const noexcept override;
 
     GKO_ENABLE_FOR_ALL_EXECUTORS(GKO_OVERRIDE_RAW_COPY_TO);
+
+private:
+    std::shared_ptr<Allocator> alloc_;
 };
 
 
@@ -810,9 +832,17 @@ using DefaultExecutor = OmpExecutor;
  */
 class ReferenceExecutor : public OmpExecutor {
 public:
-    static std::shared_ptr<ReferenceExecutor> create()
+    /**
+     * Creates a new ReferenceExecutor.
+     *
+     * @param alloc  the allocator used for all memory allocated by the
+     *               executor
+     */
+    static std::shared_ptr<ReferenceExecutor> create(
+        std::shared_ptr<Allocator> alloc = std::make_shared<CpuAllocator>())
     {
-        return std::shared_ptr<ReferenceExecutor>(new ReferenceExecutor());
+        return std::shared_ptr<ReferenceExecutor>(
+            new ReferenceExecutor(std::move(alloc)));
     }
 
     void run(const Operation &op) const override
@@ -824,7 +854,10 @@ public:
     }
 
 protected:
-    ReferenceExecutor() = default;
+    ReferenceExecutor(
+        std::shared_ptr<Allocator> alloc = std::make_shared<CpuAllocator>())
+        : OmpExecutor{std::move(alloc)}
+    {}
 };
 
 
@@ -0,0 +1,277 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_BASE_MEMORY_HPP_
+#define GKO_CORE_BASE_MEMORY_HPP_
+
+
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+
+
+/**
+ * An Allocator provides raw host memory to a host Executor.
+ *
+ * Executors which allocate memory on the host (OmpExecutor and
+ * ReferenceExecutor) forward all of their raw allocations to an allocator,
+ * which allows applications to customize how memory is obtained, e.g. to reuse
+ * memory across repeated solver applications.
+ *
+ * An allocator returns `nullptr` if the allocation failed, the executor is
+ * responsible for reporting the error.
+ *
+ * @ingroup Executor
+ */
+class Allocator {
+public:
+    virtual ~Allocator() = default;
+
+    /**
+     * Allocates a block of memory.
+     *
+     * @param exec  the executor requesting the block
+     * @param num_bytes  the size of the block
+     *
+     * @return a pointer to the block, or `nullptr` if the allocation failed
+     */
+    virtual void *allocate(const Executor *exec, size_type num_bytes) = 0;
+
+    /**
+     * Deallocates a block previously returned by allocate().
+     *
+     * @param exec  the executor releasing the block
+     * @param ptr  the block to deallocate (may be `nullptr`)
+     */
+    virtual void deallocate(const Executor *exec, void *ptr) noexcept = 0;
+};
+
+
+/**
+ * The default allocator, which uses `std::malloc` and `std::free`.
+ *
+ * @ingroup Executor
+ */
+class CpuAllocator : public Allocator {
+public:
+    void *allocate(const Executor *, size_type num_bytes) override
+    {
+        return std::malloc(num_bytes);
+    }
+
+    void deallocate(const Executor *, void *ptr) noexcept override
+    {
+        std::free(ptr);
+    }
+};
+
+
+/**
+ * An allocator which returns blocks aligned to a fixed boundary.
+ *
+ * The default alignment of 64 bytes matches the cache line size of common
+ * CPUs, which prevents false sharing at the boundaries of arrays and allows
+ * aligned vector loads. Passing `huge_page_alignment` aligns blocks of at
+ * least 2 MiB to huge pages (and advises the kernel to back them with
+ * transparent huge pages on Linux), while smaller blocks are only aligned to
+ * cache lines.
+ *
+ * @ingroup Executor
+ */
+class AlignedCpuAllocator : public Allocator {
+public:
+    /** The alignment to cache lines. */
+    static constexpr size_type cache_line_alignment = 64;
+
+    /** The alignment to (2 MiB) huge pages. */
+    static constexpr size_type huge_page_alignment = size_type{1} << 21;
+
+    /**
+     * Creates an aligned allocator.
+     *
+     * @param alignment  the alignment of all blocks, has to be a power of two.
+     *                   Alignments larger than `cache_line_alignment` are only
+     *                   applied to blocks which are at least as large as the
+     *                   alignment.
+     */
+    explicit AlignedCpuAllocator(size_type alignment = cache_line_alignment);
+
+    void *allocate(const Executor *exec, size_type num_bytes) override;
+
+    void deallocate(const Executor *exec, void *ptr) noexcept override;
+
+    /**
+     * Returns the alignment of the (large enough) blocks returned by this
+     * allocator.
+     *
+     * @return the alignment of the blocks returned by this allocator
+     */
+    size_type get_alignment() const noexcept { return alignment_; }
+
+private:
+    size_type alignment_;
+};
+
+
+/**
+ * An allocator which caches deallocated blocks and reuses them for subsequent
+ * allocations of the same size class.
+ *
+ * Requests are rounded up to the next power of two (at least
+ * `min_block_size` bytes), and each of these size classes keeps a list of free
+ * blocks. This way, the temporary vectors created in every apply of a solver
+ * are served from the pool after the first apply, instead of going through the
+ * system allocator again.
+ *
+ * Memory is obtained from an upstream allocator (by default an
+ * AlignedCpuAllocator with cache line alignment). Blocks larger than
+ * `max_block_size` are not pooled, and free blocks are returned to the
+ * upstream allocator once the pool caches more than `max_cached_bytes`.
+ *
+ * The number of requests served from the pool (hits) and forwarded to the
+ * upstream allocator (misses) can be queried. In addition, every request is
+ * reported to the loggers of the pool via the `allocation_started` and
+ * `allocation_completed` events, with the executor issuing the request. The
+ * `num_bytes` of `allocation_started` is the number of bytes obtained from the
+ * upstream allocator, i.e. the size of the block for a miss and 0 for a hit,
+ * while `allocation_completed` always reports the size and location of the
+ * block. Every block returned to the upstream allocator is reported via the
+ * `free_started` and `free_completed` events. The executor passed to these
+ * events is `nullptr` for blocks released by release() or by the destructor,
+ * since no executor is involved there.
+ *
+ * The allocator is thread-safe.
+ *
+ * @ingroup Executor
+ */
+class PooledCpuAllocator : public Allocator,
+                           public log::EnableLogging<PooledCpuAllocator> {
+public:
+    /** The default smallest size class. */
+    static constexpr size_type default_min_block_size = 64;
+
+    /** The default largest size class. */
+    static constexpr size_type default_max_block_size = size_type{1} << 30;
+
+    /** The default limit on the total size of cached free blocks. */
+    static constexpr size_type default_max_cached_bytes = size_type{1} << 31;
+
+    /**
+     * Creates a pooled allocator.
+     *
+     * @param upstream  the allocator used to obtain new blocks
+     * @param max_cached_bytes  the maximal total size of cached free blocks
+     * @param min_block_size  the smallest size class, has to be a power of two
+     * @param max_block_size  the largest pooled size class, larger requests
+     *                        are forwarded to `upstream` directly
+     */
+    explicit PooledCpuAllocator(
+        std::shared_ptr<Allocator> upstream =
+            std::make_shared<AlignedCpuAllocator>(),
+        size_type max_cached_bytes = default_max_cached_bytes,
+        size_type min_block_size = default_min_block_size,
+        size_type max_block_size = default_max_block_size);
+
+    ~PooledCpuAllocator() override;
+
+    void *allocate(const Executor *exec, size_type num_bytes) override;
+
+    void deallocate(const Executor *exec, void *ptr) noexcept override;
+
+    /**
+     * Returns all cached free blocks to the upstream allocator.
+     *
+     * Blocks which are currently in use are not affected.
+     */
+    void release() noexcept;
+
+    /**
+     * Returns the number of allocations served from the pool.
+     *
+     * @return the number of allocations served from the pool
+     */
+    size_type get_num_hits() const;
+
+    /**
+     * Returns the number of allocations forwarded to the upstream allocator.
+     *
+     * @return the number of allocations forwarded to the upstream allocator
+     */
+    size_type get_num_misses() const;
+
+    /**
+     * Returns the total size of the free blocks cached by the pool.
+     *
+     * @return the total size of the free blocks cached by the pool
+     */
+    size_type get_cached_bytes() const;
+
+    /**
+     * Returns the upstream allocator.
+     *
+     * @return the upstream allocator
+     */
+    std::shared_ptr<Allocator> get_upstream() const { return upstream_; }
+
+private:
+    size_type get_block_size(size_type num_bytes) const noexcept;
+
+    void free_upstream(const Executor *exec, void *ptr) const noexcept;
+
+    std::shared_ptr<Allocator> upstream_;
+    size_type max_cached_bytes_;
+    size_type min_block_size_;
+    size_type max_block_size_;
+    mutable std::mutex mutex_;
+    // maps each block size to the free blocks of this size
+    std::unordered_map<size_type, std::vector<void *>> free_blocks_;
+    // maps each block in use to its block size
+    std::unordered_map<void *, size_type> used_blocks_;
+    size_type cached_bytes_;
+    size_type num_hits_;
+    size_type num_misses_;
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_MEMORY_HPP_
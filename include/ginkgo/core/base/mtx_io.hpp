@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <istream>
+#include <memory>
 
 
 #include <ginkgo/core/base/matrix_data.hpp>
@@ -43,6 +44,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace gko {
 
 
+class Executor;
+
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+}  // namespace matrix
+
+
 /**
  * Reads a matrix stored in matrix market format from an input stream.
  *
@@ -61,6 +74,35 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_raw(std::istream &is);
 
 
+/**
+ * Reads a matrix stored in matrix market format from an input stream directly
+ * into a matrix::Csr.
+ *
+ * For matrices in coordinate layout, the remaining stream is read into memory
+ * and split into byte ranges at line boundaries, which are parsed by
+ * `num_threads` threads using a parser independent of the stream locale.
+ * The row pointers are computed from a histogram of the row indexes, and the
+ * entries are scattered into their rows, so neither a matrix_data structure
+ * nor a global sort is needed. Matrices in array layout are read through
+ * read_raw.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ * @param exec  executor on which the matrix is created
+ * @param num_threads  number of threads used for parsing, 0 uses the number
+ *                     of hardware threads
+ *
+ * @return A matrix::Csr containing the matrix, with the column indexes of each
+ *         row sorted.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr(
+    std::istream &is, std::shared_ptr<const Executor> exec,
+    size_type num_threads = 0);
+
+
 /**
  * Specifies the layout type when writing data in matrix market format.
  */
@@ -186,6 +186,213 @@ public:
 };
 
 
+namespace detail {
+
+
+/**
+ * A reference to a value stored as `StorageType` which is read and written as
+ * `ArithmeticType`.
+ *
+ * Objects of this class are returned by the element access of
+ * reduced_row_major. The value is converted on every load and every store,
+ * so all computations done with it happen in `ArithmeticType`.
+ *
+ * @tparam ArithmeticType  type used for computations
+ * @tparam StorageType  type the value is stored in
+ */
+template <typename ArithmeticType, typename StorageType>
+class reduced_storage_reference {
+public:
+    GKO_ATTRIBUTES constexpr explicit reduced_storage_reference(
+        StorageType *ptr)
+        : ptr_{ptr}
+    {}
+
+    GKO_ATTRIBUTES reduced_storage_reference(
+        const reduced_storage_reference &other) = default;
+
+    /**
+     * Loads the value and converts it to `ArithmeticType`.
+     */
+    GKO_ATTRIBUTES operator ArithmeticType() const
+    {
+        return static_cast<ArithmeticType>(*ptr_);
+    }
+
+    /**
+     * Converts the value to `StorageType` and stores it.
+     */
+    GKO_ATTRIBUTES const reduced_storage_reference &operator=(
+        ArithmeticType value) const
+    {
+        *ptr_ = static_cast<StorageType>(value);
+        return *this;
+    }
+
+    GKO_ATTRIBUTES const reduced_storage_reference &operator=(
+        const reduced_storage_reference &other) const
+    {
+        return *this = static_cast<ArithmeticType>(other);
+    }
+
+private:
+    StorageType *ptr_;
+};
+
+
+}  // namespace detail
+
+
+/**
+ * A reduced_row_major accessor is a row_major accessor for data which is
+ * stored in a different (usually lower) precision than the one used for
+ * computations.
+ *
+ * Elements are converted to `ArithmeticType` when they are loaded, and back to
+ * `StorageType` when they are stored. This allows memory-bound algorithms to
+ * keep their data in a compact format without changing the precision of their
+ * arithmetic.
+ *
+ * You should never try to explicitly create an instance of this accessor.
+ * Instead, supply it as a template parameter to a range, and pass the
+ * constructor parameters for this class to the range (it will forward it to
+ * this class).
+ *
+ * @tparam ArithmeticType  type of values this accessor returns
+ * @tparam StorageType  type of values in the underlying memory (can be
+ *                      const-qualified for read-only access)
+ */
+template <typename ArithmeticType, typename StorageType>
+class reduced_row_major {
+public:
+    friend class range<reduced_row_major>;
+
+    /**
+     * Type of values returned by the accessor.
+     */
+    using arithmetic_type = ArithmeticType;
+
+    /**
+     * Type of values in the underlying memory.
+     */
+    using storage_type = StorageType;
+
+    /**
+     * Type of underlying data storage.
+     */
+    using data_type = storage_type *;
+
+    /**
+     * Type of the references returned by the element access.
+     */
+    using reference =
+        detail::reduced_storage_reference<arithmetic_type, storage_type>;
+
+    /**
+     * Number of dimensions of the accessor.
+     */
+    static constexpr size_type dimensionality = 2;
+
+protected:
+    /**
+     * Creates a reduced_row_major accessor.
+     *
+     * @param data  pointer to the block of memory containing the data
+     * @param num_row  number of rows of the accessor
+     * @param num_cols  number of columns of the accessor
+     * @param stride  distance (in elements) between starting positions of
+     *                consecutive rows (i.e. `data + i * stride` points to the
+     *                `i`-th row)
+     */
+    GKO_ATTRIBUTES constexpr explicit reduced_row_major(data_type data,
+                                                        size_type num_rows,
+                                                        size_type num_cols,
+                                                        size_type stride)
+        : data{data}, lengths{num_rows, num_cols}, stride{stride}
+    {}
+
+public:
+    /**
+     * Returns a reference to the data element at position (row, col)
+     *
+     * @param row  row index
+     * @param col  column index
+     *
+     * @return reference to the data element at (row, col), which converts
+     *         from and to `arithmetic_type`
+     */
+    GKO_ATTRIBUTES constexpr reference operator()(size_type row,
+                                                  size_type col) const
+    {
+        return GKO_ASSERT(row < lengths[0]), GKO_ASSERT(col < lengths[1]),
+               reference{data + row * stride + col};
+    }
+
+    /**
+     * Returns the sub-range spanning the range (rows, cols)
+     *
+     * @param rows  row span
+     * @param cols  column span
+     *
+     * @return sub-range spanning the range (rows, cols)
+     */
+    GKO_ATTRIBUTES constexpr range<reduced_row_major> operator()(
+        const span &rows, const span &cols) const
+    {
+        return GKO_ASSERT(rows.is_valid()), GKO_ASSERT(cols.is_valid()),
+               GKO_ASSERT(rows <= span{lengths[0]}),
+               GKO_ASSERT(cols <= span{lengths[1]}),
+               range<reduced_row_major>(data + rows.begin * stride + cols.begin,
+                                        rows.end - rows.begin,
+                                        cols.end - cols.begin, stride);
+    }
+
+    /**
+     * Returns the length in dimension `dimension`.
+     *
+     * @param dimension  a dimension index
+     *
+     * @return length in dimension `dimension`
+     */
+    GKO_ATTRIBUTES constexpr size_type length(size_type dimension) const
+    {
+        return dimension < 2 ? lengths[dimension] : 1;
+    }
+
+    /**
+     * Copies data from another accessor
+     *
+     * @tparam OtherAccessor  type of the other accessor
+     *
+     * @param other  other accessor
+     */
+    template <typename OtherAccessor>
+    GKO_ATTRIBUTES void copy_from(const OtherAccessor &other) const
+    {
+        for (size_type i = 0; i < lengths[0]; ++i) {
+            for (size_type j = 0; j < lengths[1]; ++j) {
+                (*this)(i, j) = static_cast<arithmetic_type>(other(i, j));
+            }
+        }
+    }
+
+    /**
+     * Reference to the underlying data.
+     */
+    const data_type data;
+
+    /**
+     * An array of dimension sizes.
+     */
+    const std::array<const size_type, dimensionality> lengths;
+
+    /**
+     * Distance between consecutive rows.
+     */
+    const size_type stride;
+};
+
+
 }  // namespace accessor
 }  // namespace gko
 
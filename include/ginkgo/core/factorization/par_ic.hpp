@@ -0,0 +1,213 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_FACTORIZATION_PAR_IC_HPP_
+#define GKO_CORE_FACTORIZATION_PAR_IC_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace factorization {
+
+
+/**
+ * ParIC is an incomplete Cholesky factorization which is computed in
+ * parallel.
+ *
+ * $L$ is a lower triangular matrix, which approximates a given symmetric
+ * (hermitian) positive definite matrix $A$ with $A \approx LL^H$. Here, $L$
+ * has the same sparsity pattern as the lower triangle of $A$, which is also
+ * called IC(0).
+ *
+ * The ParIC algorithm generates the incomplete factor iteratively, using a
+ * fixed-point iteration of the form
+ *
+ * $
+ * F(L) =
+ * \begin{cases}
+ *     \frac{1}{l_{jj}}
+ *         \left(a_{ij}-\sum_{k=1}^{j-1}l_{ik}\overline{l_{jk}}\right), \quad
+ *         & i>j \\
+ *     \sqrt{a_{ii}-\sum_{k=1}^{i-1}l_{ik}\overline{l_{ik}}}, \quad & i=j
+ * \end{cases}
+ * $
+ *
+ * Only the lower triangle of $A$ is accessed, and only $L$ is computed, which
+ * halves both the memory and the work compared to ParIlu for symmetric
+ * matrices. As for ParIlu, a single sweep is sufficient for sequential
+ * execution, while about 3 sweeps are needed for fine-grained parallelism.
+ *
+ * The ParIC algorithm in Ginkgo follows the design of E. Chow and A. Patel,
+ * Fine-grained Parallel Incomplete LU Factorization, SIAM Journal on Scientific
+ * Computing, 37, C169-C193 (2015).
+ *
+ * @note By default, the resulting Composition contains both $L$ and $L^H$,
+ *       so it can be used wherever the factors of ParIlu are expected. If
+ *       `both_factors` is set to `false`, it only contains $L$, which is what
+ *       preconditioner::Ic expects.
+ *
+ * @tparam ValueType  Type of the values of all matrices used in this class
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup factor
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class ParIc : public Composition<ValueType> {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+
+    std::shared_ptr<const matrix_type> get_l_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const matrix_type>(
+            this->get_operators()[0]);
+    }
+
+    /**
+     * Returns the conjugate transposed factor $L^H$.
+     *
+     * @note Throws a NotSupported exception if the factorization was
+     *       generated with `both_factors` set to `false`.
+     */
+    std::shared_ptr<const matrix_type> get_lt_factor() const
+    {
+        if (this->get_operators().size() != 2) {
+            GKO_NOT_SUPPORTED(this);
+        }
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const matrix_type>(
+            this->get_operators()[1]);
+    }
+
+    /**
+     * Recomputes the factors for a new system matrix with the same sparsity
+     * pattern as the one they were generated from.
+     *
+     * The sparsity pattern of the factors is reused, only their values are
+     * recomputed. The factors are updated in place, so all objects sharing
+     * them (e.g. triangular solvers generated from them) see the new values.
+     *
+     * @param system_matrix  the matrix with the updated values
+     */
+    void update_values(const std::shared_ptr<const LinOp> &system_matrix);
+
+    // Remove the possibility of calling `create`, which was enabled by
+    // `Composition`
+    template <typename... Args>
+    static std::unique_ptr<Composition<ValueType>> create(Args &&... args) =
+        delete;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The number of iterations the `compute` kernel will use when doing
+         * the factorization. The default value `0` means `Auto`, so the
+         * implementation decides on the actual value depending on the
+         * ressources that are available.
+         */
+        size_type GKO_FACTORY_PARAMETER(iterations, 0);
+
+        /**
+         * @brief `true` means it is known that the matrix given to this
+         *        factory will be sorted first by row, then by column index,
+         *        `false` means it is unknown or not sorted, so an additional
+         *        sorting step will be performed during the factorization
+         *        (it will not change the matrix given).
+         *        The matrix must be sorted for this factorization to work.
+         */
+        bool GKO_FACTORY_PARAMETER(skip_sorting, false);
+
+        /**
+         * Strategy which will be used by the L (and L^H) matrix. The default
+         * value `nullptr` will result in the strategy `classical`.
+         */
+        std::shared_ptr<typename matrix_type::strategy_type>
+            GKO_FACTORY_PARAMETER(l_strategy, nullptr);
+
+        /**
+         * `true` means the conjugate transposed factor $L^H$ is explicitly
+         * stored as the second operator of the Composition, `false` means
+         * only $L$ is stored.
+         */
+        bool GKO_FACTORY_PARAMETER(both_factors, true);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(ParIc, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit ParIc(const Factory *factory,
+                   std::shared_ptr<const LinOp> system_matrix)
+        : Composition<ValueType>(factory->get_executor()),
+          parameters_{factory->get_parameters()}
+    {
+        if (parameters_.l_strategy == nullptr) {
+            parameters_.l_strategy =
+                std::make_shared<typename matrix_type::classical>();
+        }
+        generate_l(system_matrix)->move_to(this);
+    }
+
+    /**
+     * Generates the incomplete Cholesky factor, which will be returned as a
+     * composition of $L$ (first element of the composition) and, if
+     * `both_factors` is set, $L^H$ (second element). The dynamic type of
+     * both is matrix_type.
+     *
+     * @param system_matrix  the source matrix used to generate the factor.
+     *                       @note: system_matrix must be convertable to a Csr
+     *                              Matrix, otherwise, an exception is thrown.
+     * @return  A Composition, containing the incomplete Cholesky factor(s)
+     *          for the given system_matrix
+     */
+    std::unique_ptr<Composition<ValueType>> generate_l(
+        const std::shared_ptr<const LinOp> &system_matrix) const;
+};
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_CORE_FACTORIZATION_PAR_IC_HPP_
@@ -113,6 +113,18 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a new system matrix with the same sparsity
+     * pattern as the one they were generated from.
+     *
+     * The sparsity pattern of L and U is reused, only their values are
+     * recomputed. The factors are updated in place, so all objects sharing
+     * them (e.g. triangular solvers generated from them) see the new values.
+     *
+     * @param system_matrix  the matrix with the updated values
+     */
+    void update_values(const std::shared_ptr<const LinOp> &system_matrix);
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
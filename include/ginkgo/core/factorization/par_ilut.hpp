@@ -0,0 +1,205 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_FACTORIZATION_PAR_ILUT_HPP_
+#define GKO_CORE_FACTORIZATION_PAR_ILUT_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace factorization {
+
+
+/**
+ * ParILUT is an incomplete threshold-based LU factorization which is computed
+ * in parallel.
+ *
+ * $L$ is a lower unitriangular, while $U$ is an upper triangular matrix, which
+ * approximate a given matrix $A$ with $A \approx LU$. Here, $L$ and $U$ are
+ * not restricted to the sparsity pattern of $A$: the algorithm adaptively
+ * decides which entries to keep, subject to a limit on the fill-in.
+ *
+ * Starting from the lower and upper triangle of $A$, every ParILUT step
+ * consists of the following phases:
+ *
+ * 1. Candidate generation: the non-zero locations of the residual
+ *    $R = A - LU$ (computed via a sparse matrix product) are added to the
+ *    sparsity patterns of $L$ and $U$.
+ * 2. A fixed-point sweep as in ParILU (see ParIlu) updates all entries of the
+ *    enlarged factors.
+ * 3. Thresholding: the smallest entries of $L$ and $U$ are removed until they
+ *    fit into the fill-in limit, and all entries which are small relative to
+ *    the corresponding row of $A$ are dropped.
+ * 4. Another fixed-point sweep on the remaining entries.
+ *
+ * The diagonal entries of $L$ and $U$ are never removed.
+ *
+ * The ParILUT algorithm in Ginkgo follows the design of H. Anzt, E. Chow and
+ * J. Dongarra, ParILUT - A New Parallel Threshold ILU Factorization, SIAM
+ * Journal on Scientific Computing, 40, C503-C519 (2018).
+ *
+ * @tparam ValueType  Type of the values of all matrices used in this class
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup factor
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class ParIlut : public Composition<ValueType> {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using l_matrix_type = matrix::Csr<ValueType, IndexType>;
+    using u_matrix_type = matrix::Csr<ValueType, IndexType>;
+
+    std::shared_ptr<const l_matrix_type> get_l_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const l_matrix_type>(
+            this->get_operators()[0]);
+    }
+
+    std::shared_ptr<const u_matrix_type> get_u_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const u_matrix_type>(
+            this->get_operators()[1]);
+    }
+
+    // Remove the possibility of calling `create`, which was enabled by
+    // `Composition`
+    template <typename... Args>
+    static std::unique_ptr<Composition<ValueType>> create(Args &&... args) =
+        delete;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The number of ParILUT steps (candidate generation, fixed-point
+         * sweep, thresholding and another fixed-point sweep) which will be
+         * used when doing the factorization.
+         */
+        size_type GKO_FACTORY_PARAMETER(iterations, 5);
+
+        /**
+         * The maximum number of non-zeros of $L$ (respectively $U$),
+         * relative to the number of non-zeros in the lower (respectively
+         * upper) triangle of the system matrix, including the diagonal.
+         * A value of `1.0` keeps the factors as sparse as for ILU(0), while
+         * the default of `2.0` allows them to double in size.
+         */
+        double GKO_FACTORY_PARAMETER(fill_in_limit, 2.0);
+
+        /**
+         * Relative drop tolerance: after every step, all off-diagonal entries
+         * of $L$ and $U$ whose magnitude is smaller than `drop_tolerance`
+         * times the 2-norm of the corresponding row of the system matrix are
+         * removed, even if they would fit into the fill-in limit.
+         * The default value `0` disables this criterion.
+         */
+        remove_complex<ValueType> GKO_FACTORY_PARAMETER(drop_tolerance, 0);
+
+        /**
+         * @brief `true` means it is known that the matrix given to this
+         *        factory will be sorted first by row, then by column index,
+         *        `false` means it is unknown or not sorted, so an additional
+         *        sorting step will be performed during the factorization
+         *        (it will not change the matrix given).
+         *        The matrix must be sorted for this factorization to work.
+         */
+        bool GKO_FACTORY_PARAMETER(skip_sorting, false);
+
+        /**
+         * Strategy which will be used by the L matrix. The default value
+         * `nullptr` will result in the strategy `classical`.
+         */
+        std::shared_ptr<typename l_matrix_type::strategy_type>
+            GKO_FACTORY_PARAMETER(l_strategy, nullptr);
+
+        /**
+         * Strategy which will be used by the U matrix. The default value
+         * `nullptr` will result in the strategy `classical`.
+         */
+        std::shared_ptr<typename u_matrix_type::strategy_type>
+            GKO_FACTORY_PARAMETER(u_strategy, nullptr);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(ParIlut, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit ParIlut(const Factory *factory,
+                     std::shared_ptr<const LinOp> system_matrix)
+        : Composition<ValueType>(factory->get_executor()),
+          parameters_{factory->get_parameters()}
+    {
+        if (parameters_.l_strategy == nullptr) {
+            parameters_.l_strategy =
+                std::make_shared<typename l_matrix_type::classical>();
+        }
+        if (parameters_.u_strategy == nullptr) {
+            parameters_.u_strategy =
+                std::make_shared<typename u_matrix_type::classical>();
+        }
+        generate_l_u(system_matrix)->move_to(this);
+    }
+
+    /**
+     * Generates the incomplete LU factors, which will be returned as a
+     * composition of the lower (first element of the composition) and the
+     * upper factor (second element). The dynamic type of L is l_matrix_type,
+     * while the dynamic type of U is u_matrix_type.
+     *
+     * @param system_matrix  the source matrix used to generate the factors.
+     *                       @note: system_matrix must be convertable to a Csr
+     *                              Matrix, otherwise, an exception is thrown.
+     * @return  A Composition, containing the incomplete LU factors for the
+     *          given system_matrix (first element is L, then U)
+     */
+    std::unique_ptr<Composition<ValueType>> generate_l_u(
+        const std::shared_ptr<const LinOp> &system_matrix) const;
+};
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_CORE_FACTORIZATION_PAR_ILUT_HPP_
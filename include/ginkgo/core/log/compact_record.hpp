@@ -0,0 +1,359 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_LOG_COMPACT_RECORD_HPP_
+#define GKO_CORE_LOG_COMPACT_RECORD_HPP_
+
+
+#include <ginkgo/core/log/logger.hpp>
+
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * CompactRecord is a Logger which stores every event as a small record of
+ * plain values in a ring buffer which is allocated once, when the logger is
+ * created.
+ *
+ * Contrary to Record, no object passed to the events is ever copied: objects
+ * are identified by their address, operations by their name, and executor
+ * events by the memory locations and sizes involved. Once the ring buffer is
+ * full, the oldest events are overwritten. This keeps the overhead of the
+ * logger small and bounded, so it can stay attached in production runs.
+ *
+ * Optionally, the residual norm of the first right hand side can be stored
+ * with every criterion_check_completed event. As this requires copying a value
+ * from the device and thus synchronizing with it once per iteration, it is
+ * disabled by default.
+ *
+ * If snapshots of the objects (e.g. of the residual in every iteration) are
+ * needed, Record has to be used instead.
+ *
+ * @note This logger is not thread safe.
+ *
+ * @ingroup log
+ */
+class CompactRecord : public Logger {
+public:
+    /**
+     * A single logged event.
+     */
+    struct event_data {
+        /**
+         * The mask of the event, e.g. Logger::allocation_started_mask
+         */
+        mask_type event;
+
+        /**
+         * The time since the creation of the logger in nanoseconds
+         */
+        int64 timestamp;
+
+        /**
+         * The name of the operation for operation events, `nullptr` otherwise
+         */
+        const char *name;
+
+        /**
+         * The address of the object which caused the event: the (source)
+         * executor for executor, operation and polymorphic object events, the
+         * operator for LinOp events, the factory for LinOpFactory events, the
+         * criterion for criterion events and the solver for iteration events
+         */
+        uintptr object;
+
+        /**
+         * The address of the input: the (source) memory location for
+         * executor events, the input object for polymorphic object and
+         * LinOpFactory events, the right hand side for LinOp events and the
+         * residual for criterion and iteration events
+         */
+        uintptr input;
+
+        /**
+         * The address of the output: the target memory location for copy
+         * events, the output object for polymorphic object and LinOpFactory
+         * events and the solution for LinOp, criterion and iteration events
+         */
+        uintptr output;
+
+        /**
+         * The number of bytes for executor events, the number of iterations
+         * for criterion and iteration events and 0 otherwise
+         */
+        size_type size;
+
+        /**
+         * The residual norm of the first right hand side for
+         * criterion_check_completed events providing a residual norm if the
+         * logger captures norms, NaN otherwise
+         */
+        double residual_norm;
+    };
+
+    /* Executor events */
+    void on_allocation_started(const Executor *exec,
+                               const size_type &num_bytes) const override;
+
+    void on_allocation_completed(const Executor *exec,
+                                 const size_type &num_bytes,
+                                 const uintptr &location) const override;
+
+    void on_free_started(const Executor *exec,
+                         const uintptr &location) const override;
+
+    void on_free_completed(const Executor *exec,
+                           const uintptr &location) const override;
+
+    void on_copy_started(const Executor *from, const Executor *to,
+                         const uintptr &location_from,
+                         const uintptr &location_to,
+                         const size_type &num_bytes) const override;
+
+    void on_copy_completed(const Executor *from, const Executor *to,
+                           const uintptr &location_from,
+                           const uintptr &location_to,
+                           const size_type &num_bytes) const override;
+
+    /* Operation events */
+    void on_operation_launched(const Executor *exec,
+                               const Operation *operation) const override;
+
+    void on_operation_completed(const Executor *exec,
+                                const Operation *operation) const override;
+
+    /* PolymorphicObject events */
+    void on_polymorphic_object_create_started(
+        const Executor *exec, const PolymorphicObject *po) const override;
+
+    void on_polymorphic_object_create_completed(
+        const Executor *exec, const PolymorphicObject *input,
+        const PolymorphicObject *output) const override;
+
+    void on_polymorphic_object_copy_started(
+        const Executor *exec, const PolymorphicObject *from,
+        const PolymorphicObject *to) const override;
+
+    void on_polymorphic_object_copy_completed(
+        const Executor *exec, const PolymorphicObject *from,
+        const PolymorphicObject *to) const override;
+
+    void on_polymorphic_object_deleted(
+        const Executor *exec, const PolymorphicObject *po) const override;
+
+    /* LinOp events */
+    void on_linop_apply_started(const LinOp *A, const LinOp *b,
+                                const LinOp *x) const override;
+
+    void on_linop_apply_completed(const LinOp *A, const LinOp *b,
+                                  const LinOp *x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp *A, const LinOp *alpha,
+                                         const LinOp *b, const LinOp *beta,
+                                         const LinOp *x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp *A, const LinOp *alpha,
+                                           const LinOp *b, const LinOp *beta,
+                                           const LinOp *x) const override;
+
+    /* LinOpFactory events */
+    void on_linop_factory_generate_started(const LinOpFactory *factory,
+                                           const LinOp *input) const override;
+
+    void on_linop_factory_generate_completed(
+        const LinOpFactory *factory, const LinOp *input,
+        const LinOp *output) const override;
+
+    /* Criterion events */
+    void on_criterion_check_started(const stop::Criterion *criterion,
+                                    const size_type &num_iterations,
+                                    const LinOp *residual,
+                                    const LinOp *residual_norm,
+                                    const LinOp *solution,
+                                    const uint8 &stopping_id,
+                                    const bool &set_finalized) const override;
+
+    void on_criterion_check_completed(
+        const stop::Criterion *criterion, const size_type &num_iterations,
+        const LinOp *residual, const LinOp *residual_norm,
+        const LinOp *solution, const uint8 &stopping_id,
+        const bool &set_finalized, const Array<stopping_status> *status,
+        const bool &one_changed, const bool &all_converged) const override;
+
+    /* Internal solver events */
+    void on_iteration_complete(
+        const LinOp *solver, const size_type &num_iterations,
+        const LinOp *residual, const LinOp *solution = nullptr,
+        const LinOp *residual_norm = nullptr) const override;
+
+    /**
+     * Creates a CompactRecord logger. This dynamically allocates the memory,
+     * constructs the object and returns an std::unique_ptr to this object.
+     *
+     * @param exec  the executor
+     * @param enabled_events  the events enabled for this logger. By default all
+     *                        events.
+     * @param capacity  the number of events kept by the logger, the oldest
+     *                  events are overwritten once more events are logged
+     * @param capture_norms  whether the residual norm of the first right hand
+     *                       side is stored with criterion_check_completed
+     *                       events. This requires a device-to-host copy per
+     *                       check.
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<CompactRecord> create(
+        std::shared_ptr<const Executor> exec,
+        const mask_type &enabled_events = Logger::all_events_mask,
+        size_type capacity = 1024, bool capture_norms = false)
+    {
+        return std::unique_ptr<CompactRecord>(
+            new CompactRecord(exec, enabled_events, capacity, capture_norms));
+    }
+
+    /**
+     * Returns the maximal number of events kept by the logger.
+     *
+     * @return the maximal number of events kept by the logger
+     */
+    size_type get_capacity() const noexcept { return events_.size(); }
+
+    /**
+     * Returns whether the logger stores residual norms.
+     *
+     * @return whether the logger stores residual norms
+     */
+    bool captures_norms() const noexcept { return capture_norms_; }
+
+    /**
+     * Returns the number of events currently kept by the logger.
+     *
+     * @return the number of events currently kept by the logger
+     */
+    size_type get_num_events() const noexcept
+    {
+        return std::min(num_logged_, this->get_capacity());
+    }
+
+    /**
+     * Returns the number of events logged since the creation of the logger
+     * (or the last call to clear()), including overwritten ones.
+     *
+     * @return the number of events logged
+     */
+    size_type get_num_logged_events() const noexcept { return num_logged_; }
+
+    /**
+     * Returns an event kept by the logger.
+     *
+     * @param i  the index of the event, 0 being the oldest event that was not
+     *           overwritten yet
+     *
+     * @return the `i`-th oldest event kept by the logger
+     */
+    const event_data &get_event(size_type i) const
+    {
+        GKO_ENSURE_IN_BOUNDS(i, this->get_num_events());
+        return events_[(num_logged_ - this->get_num_events() + i) %
+                       this->get_capacity()];
+    }
+
+    /**
+     * Returns a copy of all events kept by the logger, from the oldest to the
+     * newest one.
+     *
+     * @return the events kept by the logger
+     */
+    std::vector<event_data> get_events() const;
+
+    /**
+     * Discards all events kept by the logger.
+     */
+    void clear() noexcept { num_logged_ = 0; }
+
+protected:
+    /**
+     * Creates a CompactRecord logger.
+     *
+     * @param exec  the executor
+     * @param enabled_events  the events enabled for this logger. By default all
+     *                        events.
+     * @param capacity  the number of events kept by the logger, the oldest
+     *                  events are overwritten once more events are logged
+     * @param capture_norms  whether the residual norm of the first right hand
+     *                       side is stored with criterion_check_completed
+     *                       events. This requires a device-to-host copy per
+     *                       check.
+     */
+    explicit CompactRecord(
+        std::shared_ptr<const gko::Executor> exec,
+        const mask_type &enabled_events = Logger::all_events_mask,
+        size_type capacity = 1024, bool capture_norms = false)
+        : Logger(exec, enabled_events),
+          events_(capacity),
+          capture_norms_{capture_norms},
+          start_{std::chrono::steady_clock::now()}
+    {}
+
+    /**
+     * Stores an event in the ring buffer, overwriting the oldest event if the
+     * buffer is full.
+     */
+    void append(mask_type event, const char *name, uintptr object,
+                uintptr input, uintptr output, size_type size,
+                double residual_norm) const;
+
+private:
+    mutable std::vector<event_data> events_;
+    mutable size_type num_logged_{};
+    bool capture_norms_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_COMPACT_RECORD_HPP_
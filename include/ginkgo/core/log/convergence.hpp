@@ -62,6 +62,11 @@ namespace log {
  * This logger also computes the residual norm from the residual when the
  * residual norm was not available. This can add some slight overhead.
  *
+ * By default, the logger keeps a copy of the final residual. If only the
+ * residual norm is of interest, the logger can be created with
+ * `store_residual = false`, in which case the residual is never copied and the
+ * storage for the residual norm is reused between solves.
+ *
  * @ingroup log
  */
 template <typename ValueType = default_precision>
@@ -81,6 +86,7 @@ public:
      * @param exec  the executor
      * @param enabled_events  the events enabled for this logger. By default all
      *                        events.
+     * @param store_residual  whether a copy of the final residual is kept
      *
      * @return an std::unique_ptr to the the constructed object
      *
@@ -90,10 +96,11 @@ public:
      */
     static std::unique_ptr<Convergence> create(
         std::shared_ptr<const Executor> exec,
-        const mask_type &enabled_events = Logger::all_events_mask)
+        const mask_type &enabled_events = Logger::all_events_mask,
+        bool store_residual = true)
     {
         return std::unique_ptr<Convergence>(
-            new Convergence(exec, enabled_events));
+            new Convergence(exec, enabled_events, store_residual));
     }
 
     /**
@@ -109,7 +116,7 @@ public:
     /**
      * Returns the residual
      *
-     * @return the residual
+     * @return the residual, or `nullptr` if the logger does not store it
      */
     const LinOp *get_residual() const noexcept { return residual_.get(); }
 
@@ -130,14 +137,17 @@ protected:
      * @param exec  the executor
      * @param enabled_events  the events enabled for this logger. By default all
      *                        events.
+     * @param store_residual  whether a copy of the final residual is kept
      */
     explicit Convergence(
         std::shared_ptr<const gko::Executor> exec,
-        const mask_type &enabled_events = Logger::all_events_mask)
-        : Logger(exec, enabled_events)
+        const mask_type &enabled_events = Logger::all_events_mask,
+        bool store_residual = true)
+        : Logger(exec, enabled_events), store_residual_{store_residual}
     {}
 
 private:
+    bool store_residual_;
     mutable size_type num_iterations_{};
     mutable std::unique_ptr<LinOp> residual_{};
     mutable std::unique_ptr<LinOp> residual_norm_{};
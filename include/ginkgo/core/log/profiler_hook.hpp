@@ -0,0 +1,290 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_LOG_PROFILER_HOOK_HPP_
+#define GKO_CORE_LOG_PROFILER_HOOK_HPP_
+
+
+#include <ginkgo/core/log/logger.hpp>
+
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * ProfilerHook is a Logger which measures the time spent in operations, LinOp
+ * applications and LinOp generations, and aggregates the timings by name.
+ *
+ * Operations are identified by Operation::get_name(), applications and
+ * generations by the dynamic type of the LinOp or LinOpFactory, e.g.
+ * `apply(gko::matrix::Csr<double, int>)`. For every name, the logger counts
+ * the number of calls, the total (inclusive) and self (exclusive) wall time,
+ * and the number of bytes allocated or copied while the range was active.
+ * Nested ranges are tracked on a separate stack for each thread.
+ *
+ * The executor is synchronized at the beginning and at the end of each range,
+ * so the timings are accurate for asynchronous executors too, at the cost of
+ * serializing the execution.
+ *
+ * Operation and memory events are emitted by the executor, while LinOp events
+ * are emitted by the LinOp or LinOpFactory itself. To profile a solver, the
+ * logger therefore has to be added to the executor as well as to the objects
+ * of interest.
+ *
+ * Optionally, every range is also recorded and can be exported in the Chrome
+ * trace event format, which can be visualized with `chrome://tracing` or
+ * Perfetto.
+ *
+ * @ingroup log
+ */
+class ProfilerHook : public Logger {
+public:
+    /**
+     * Aggregated timings of all ranges with the same name.
+     */
+    struct summary_entry {
+        /**
+         * The name of the range
+         */
+        std::string name;
+
+        /**
+         * The number of times the range was entered
+         */
+        size_type count;
+
+        /**
+         * The total time spent inside the range, in nanoseconds
+         */
+        int64 inclusive_time;
+
+        /**
+         * The time spent inside the range but outside of nested ranges, in
+         * nanoseconds
+         */
+        int64 exclusive_time;
+
+        /**
+         * The number of bytes allocated or copied inside the range
+         */
+        size_type bytes;
+    };
+
+    /* Executor events */
+    void on_allocation_completed(const Executor *exec,
+                                 const size_type &num_bytes,
+                                 const uintptr &location) const override;
+
+    void on_copy_completed(const Executor *from, const Executor *to,
+                           const uintptr &location_from,
+                           const uintptr &location_to,
+                           const size_type &num_bytes) const override;
+
+    /* Operation events */
+    void on_operation_launched(const Executor *exec,
+                               const Operation *operation) const override;
+
+    void on_operation_completed(const Executor *exec,
+                                const Operation *operation) const override;
+
+    /* LinOp events */
+    void on_linop_apply_started(const LinOp *A, const LinOp *b,
+                                const LinOp *x) const override;
+
+    void on_linop_apply_completed(const LinOp *A, const LinOp *b,
+                                  const LinOp *x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp *A, const LinOp *alpha,
+                                         const LinOp *b, const LinOp *beta,
+                                         const LinOp *x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp *A, const LinOp *alpha,
+                                           const LinOp *b, const LinOp *beta,
+                                           const LinOp *x) const override;
+
+    /* LinOpFactory events */
+    void on_linop_factory_generate_started(const LinOpFactory *factory,
+                                           const LinOp *input) const override;
+
+    void on_linop_factory_generate_completed(
+        const LinOpFactory *factory, const LinOp *input,
+        const LinOp *output) const override;
+
+    /**
+     * Creates a ProfilerHook logger. This dynamically allocates the memory,
+     * constructs the object and returns an std::unique_ptr to this object.
+     *
+     * @param exec  the executor
+     * @param enabled_events  the events enabled for this logger. By default all
+     *                        events.
+     * @param record_trace  whether every range is recorded for the export to
+     *                      a Chrome trace
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<ProfilerHook> create(
+        std::shared_ptr<const Executor> exec,
+        const mask_type &enabled_events = Logger::all_events_mask,
+        bool record_trace = false)
+    {
+        return std::unique_ptr<ProfilerHook>(
+            new ProfilerHook(exec, enabled_events, record_trace));
+    }
+
+    /**
+     * Returns the aggregated timings of all completed ranges, sorted by
+     * decreasing inclusive time.
+     *
+     * @return the aggregated timings
+     */
+    std::vector<summary_entry> get_summary() const;
+
+    /**
+     * Writes the aggregated timings as a table to a stream.
+     *
+     * @param os  the output stream
+     */
+    void print_summary(std::ostream &os) const;
+
+    /**
+     * Writes all recorded ranges to a stream in the Chrome trace event format.
+     * If the logger was created without `record_trace`, the trace is empty.
+     *
+     * @param os  the output stream
+     */
+    void write_chrome_trace(std::ostream &os) const;
+
+    /**
+     * Removes all aggregated timings and recorded ranges. Ranges which are
+     * currently active are not affected.
+     */
+    void clear();
+
+protected:
+    /**
+     * Creates a ProfilerHook logger.
+     *
+     * @param exec  the executor
+     * @param enabled_events  the events enabled for this logger. By default all
+     *                        events.
+     * @param record_trace  whether every range is recorded for the export to
+     *                      a Chrome trace
+     */
+    explicit ProfilerHook(
+        std::shared_ptr<const gko::Executor> exec,
+        const mask_type &enabled_events = Logger::all_events_mask,
+        bool record_trace = false)
+        : Logger(exec, enabled_events),
+          record_trace_{record_trace},
+          start_{std::chrono::steady_clock::now()}
+    {}
+
+private:
+    struct range_frame {
+        const void *id;
+        std::string name;
+        int64 begin;
+        int64 child_time;
+        size_type bytes;
+    };
+
+    struct trace_event {
+        std::string name;
+        size_type thread;
+        int64 begin;
+        int64 duration;
+    };
+
+    struct thread_data {
+        size_type index;
+        std::vector<range_frame> stack;
+    };
+
+    int64 get_time() const;
+
+    /**
+     * Opens a new range on the stack of the calling thread.
+     *
+     * @param id  the object identifying the range
+     * @param name  the name of the range
+     */
+    void begin_range(const void *id, std::string name) const;
+
+    /**
+     * Closes the innermost range with the given identifier on the stack of the
+     * calling thread, together with all ranges nested inside of it.
+     *
+     * @param id  the object identifying the range
+     */
+    void end_range(const void *id) const;
+
+    /**
+     * Returns the demangled name of a type, caching the result.
+     *
+     * @param type  the type
+     *
+     * @return the demangled name of the type
+     */
+    std::string get_type_name(const std::type_info &type) const;
+
+    thread_data &get_thread_data() const;
+
+    bool record_trace_;
+    std::chrono::steady_clock::time_point start_;
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<std::thread::id, thread_data> threads_;
+    mutable std::map<std::string, summary_entry> summary_;
+    mutable std::vector<trace_event> trace_;
+    mutable std::unordered_map<std::type_index, std::string> type_names_;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_PROFILER_HOOK_HPP_
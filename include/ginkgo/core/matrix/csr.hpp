@@ -483,7 +483,14 @@ public:
                 row_ptrs = row_ptrs_host.get_const_data();
             }
             const auto num_rows = mtx_row_ptrs.get_num_elems() - 1;
-            if (row_ptrs[num_rows] > nnz_limit) {
+            // the maximum row length is also used by the OpenMP kernels to
+            // choose their own load distribution, so it is always computed
+            index_type maxnum = 0;
+            for (index_type i = 1; i < num_rows + 1; i++) {
+                maxnum = max(maxnum, row_ptrs[i] - row_ptrs[i - 1]);
+            }
+            max_length_per_row_ = maxnum;
+            if (row_ptrs[num_rows] > nnz_limit || maxnum > row_len_limit) {
                 load_balance actual_strategy(nwarps_, warp_size_,
                                              cuda_strategy_);
                 if (is_mtx_on_host) {
@@ -493,32 +500,7 @@ public:
                 }
                 this->set_name(actual_strategy.get_name());
             } else {
-                index_type maxnum = 0;
-                for (index_type i = 1; i < num_rows + 1; i++) {
-                    maxnum = max(maxnum, row_ptrs[i] - row_ptrs[i - 1]);
-                }
-                if (maxnum > row_len_limit) {
-                    load_balance actual_strategy(nwarps_, warp_size_,
-                                                 cuda_strategy_);
-                    if (is_mtx_on_host) {
-                        actual_strategy.process(mtx_row_ptrs, mtx_srow);
-                    } else {
-                        actual_strategy.process(row_ptrs_host, mtx_srow);
-                    }
-                    this->set_name(actual_strategy.get_name());
-                } else {
-                    classical actual_strategy;
-                    if (is_mtx_on_host) {
-                        actual_strategy.process(mtx_row_ptrs, mtx_srow);
-                        max_length_per_row_ =
-                            actual_strategy.get_max_length_per_row();
-                    } else {
-                        actual_strategy.process(row_ptrs_host, mtx_srow);
-                        max_length_per_row_ =
-                            actual_strategy.get_max_length_per_row();
-                    }
-                    this->set_name(actual_strategy.get_name());
-                }
+                this->set_name("classical");
             }
         }
 
@@ -616,6 +598,77 @@ public:
      */
     bool is_sorted_by_column_index() const;
 
+    /**
+     * Recomputes the values of this matrix as the product `a * b`, keeping its
+     * sparsity pattern.
+     *
+     * This skips the symbolic phase of the sparse matrix-matrix product, so it
+     * can be used to cheaply update a product (e.g. a Galerkin operator) after
+     * the values, but not the sparsity patterns, of its factors changed.
+     *
+     * @param a  the left factor of the product
+     * @param b  the right factor of the product
+     *
+     * @note The column indices of this matrix need to be sorted, and its
+     *       sparsity pattern has to contain the pattern of `a * b`, which is
+     *       the case if it was computed by `a->apply(b, this)` (followed by
+     *       sort_by_column_index() on executors that do not produce sorted
+     *       products). Contributions outside of the pattern are dropped.
+     */
+    void update_product_values(const Csr *a, const Csr *b);
+
+    /**
+     * Overwrites the values of this matrix, keeping its sparsity pattern.
+     *
+     * @param values  the new values, in the storage order of this matrix
+     *                (i.e. the order of get_const_values())
+     */
+    void update_values(const Array<value_type> &values);
+
+    /**
+     * Overwrites the values of this matrix from a permuted value stream,
+     * keeping its sparsity pattern.
+     *
+     * Each `values[i]` is stored at position `positions[i]` of the value
+     * array, entries with a negative position are ignored. Values at
+     * positions not referenced by `positions` keep their old value. The
+     * positions must be distinct, since values are not accumulated.
+     *
+     * @note This is only implemented for the reference and OpenMP executors,
+     *       CUDA and HIP throw a NotImplemented exception.
+     *
+     * @param values  the new values
+     * @param positions  the storage positions of the new values, usually
+     *                   computed once by compute_value_positions()
+     */
+    void update_values(const Array<value_type> &values,
+                       const Array<index_type> &positions);
+
+    /**
+     * Computes the storage positions of the nonzeros of `data` within the
+     * sparsity pattern of this matrix.
+     *
+     * The result can be passed to update_values() together with a value
+     * stream in the order of `data.nonzeros` (e.g. the COO order of an
+     * assembly routine) to refresh the matrix without rebuilding it.
+     *
+     * Like read(), which stores duplicate entries separately, the k-th
+     * occurrence of an entry in `data` is mapped to the k-th matching entry of
+     * the row, so all returned positions are distinct. Occurrences without a
+     * matching entry left get -1.
+     *
+     * @note The positions are computed on the host, using a binary search in
+     *       rows sorted by column index and a linear search otherwise. This
+     *       is a setup cost meant to be paid once per sparsity pattern.
+     *
+     * @param data  the matrix data describing the order of the value stream
+     *
+     * @return the position of each nonzero of `data` in the value array of
+     *         this matrix, or -1 if its entry is not part of the sparsity
+     *         pattern (e.g. an explicit zero that was dropped by read())
+     */
+    Array<index_type> compute_value_positions(const mat_data &data) const;
+
     /**
      * Returns the values of the matrix.
      *
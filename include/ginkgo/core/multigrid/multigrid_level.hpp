@@ -0,0 +1,107 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MULTIGRID_MULTIGRID_LEVEL_HPP_
+#define GKO_CORE_MULTIGRID_MULTIGRID_LEVEL_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+/**
+ * @brief The multigrid components namespace.
+ *
+ * @ingroup multigrid
+ */
+namespace multigrid {
+
+
+/**
+ * This class represents two levels in a multigrid hierarchy.
+ *
+ * A MultigridLevel is generated from a fine operator $A$ and provides the
+ * restriction operator $R$, the coarse operator $A_c$ and the prolongation
+ * operator $P$ needed to move a residual from the fine level to the coarse
+ * level and the coarse correction back. Usually, $A_c = R A P$ (Galerkin
+ * product).
+ *
+ * solver::Multigrid uses this interface to build its hierarchy, so any
+ * LinOpFactory whose generated LinOps implement MultigridLevel can be used to
+ * coarsen the system.
+ *
+ * @ingroup multigrid
+ */
+class MultigridLevel {
+public:
+    virtual ~MultigridLevel() = default;
+
+    /**
+     * Returns the operator on the fine level.
+     *
+     * @return the operator on the fine level
+     */
+    virtual std::shared_ptr<const LinOp> get_fine_op() const = 0;
+
+    /**
+     * Returns the restriction operator, mapping fine vectors to coarse ones.
+     *
+     * @return the restriction operator
+     */
+    virtual std::shared_ptr<const LinOp> get_restrict_op() const = 0;
+
+    /**
+     * Returns the operator on the coarse level.
+     *
+     * @return the operator on the coarse level
+     */
+    virtual std::shared_ptr<const LinOp> get_coarse_op() const = 0;
+
+    /**
+     * Returns the prolongation operator, mapping coarse vectors to fine
+     * ones.
+     *
+     * @return the prolongation operator
+     */
+    virtual std::shared_ptr<const LinOp> get_prolong_op() const = 0;
+};
+
+
+}  // namespace multigrid
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_MULTIGRID_LEVEL_HPP_
@@ -0,0 +1,226 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MULTIGRID_PGM_HPP_
+#define GKO_CORE_MULTIGRID_PGM_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/multigrid_level.hpp>
+
+
+namespace gko {
+namespace multigrid {
+
+
+/**
+ * Parallel graph match (Pgm) is an aggregation-based coarsening method for
+ * algebraic multigrid.
+ *
+ * The unknowns are grouped into aggregates by repeatedly matching every
+ * unaggregated unknown with its strongest unaggregated neighbor in parallel.
+ * Two unknowns form an aggregate if they are each other's strongest neighbor.
+ * The strength of the connection between the unknowns $i$ and $j$ is
+ * $|a_{ij}| / \max(|a_{ii}|, |a_{jj}|)$, ties are broken by a hash of the
+ * edge, so the matching makes progress on regular stencils as well.
+ * After the matching phase, the remaining unknowns join the aggregate of
+ * their strongest aggregated neighbor, or form an aggregate on their own.
+ *
+ * The tentative prolongation $P$ is piecewise constant on the aggregates.
+ * Optionally, it is smoothed with one damped Jacobi step
+ * $P = (I - \omega D^{-1} A) P$ (smoothed aggregation), where $\omega$ is
+ * the smoothing weight divided by the Gershgorin bound
+ * $\max_i \sum_j |a_{ij}| / |a_{ii}|$ of the spectral radius of $D^{-1} A$.
+ * The restriction is
+ * $R = P^H$ and the coarse operator the Galerkin product $A_c = R A P$,
+ * computed with the sparse matrix-matrix product of matrix::Csr. Thus, the
+ * coarse operator of a Hermitian matrix is Hermitian as well.
+ *
+ * Applying a Pgm object computes the two-level approximation $P A_c R$ of the
+ * fine operator. It is usually not applied directly, but used as `mg_level`
+ * of solver::Multigrid.
+ *
+ * @note The strength of connection assumes a symmetric sparsity pattern.
+ *       For unsymmetric patterns, the aggregation is still valid, but fewer
+ *       unknowns are matched in each step.
+ *
+ * @note This class is not thread safe (even a const object is not) because it
+ *       uses an internal cache for the vectors of the coarse level.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup multigrid
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Pgm : public EnableLinOp<Pgm<ValueType, IndexType>>,
+            public MultigridLevel {
+    friend class EnableLinOp<Pgm>;
+    friend class EnablePolymorphicObject<Pgm, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+
+    std::shared_ptr<const LinOp> get_fine_op() const override
+    {
+        return system_matrix_;
+    }
+
+    std::shared_ptr<const LinOp> get_restrict_op() const override
+    {
+        return restrict_op_;
+    }
+
+    std::shared_ptr<const LinOp> get_coarse_op() const override
+    {
+        return coarse_op_;
+    }
+
+    std::shared_ptr<const LinOp> get_prolong_op() const override
+    {
+        return prolong_op_;
+    }
+
+    /**
+     * Returns the aggregate each fine unknown belongs to.
+     *
+     * @return the aggregate index of each row of the fine operator
+     */
+    const Array<IndexType> &get_const_agg() const noexcept { return agg_; }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The maximum number of matching steps. The matching stops earlier
+         * if no further unknowns are matched or if the ratio of unaggregated
+         * unknowns drops below `max_unassigned_ratio`.
+         */
+        unsigned GKO_FACTORY_PARAMETER(max_iterations, 15u);
+
+        /**
+         * The ratio of unaggregated unknowns below which the matching stops.
+         */
+        double GKO_FACTORY_PARAMETER(max_unassigned_ratio, 0.05);
+
+        /**
+         * `true` means the piecewise constant prolongation is smoothed with
+         * one damped Jacobi step (smoothed aggregation), `false` means it is
+         * used as is.
+         */
+        bool GKO_FACTORY_PARAMETER(smoothed_prolongation, false);
+
+        /**
+         * The weight of the Jacobi step smoothing the prolongation, relative
+         * to the estimated spectral radius of $D^{-1} A$. Only used if
+         * `smoothed_prolongation` is set.
+         */
+        remove_complex<value_type> GKO_FACTORY_PARAMETER(
+            prolongation_smoothing_weight, 4.0 / 3.0);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Pgm, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+    explicit Pgm(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Pgm>(std::move(exec)), agg_(this->get_executor())
+    {}
+
+    explicit Pgm(const Factory *factory,
+                 std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Pgm>(factory->get_executor(),
+                           system_matrix->get_size()),
+          parameters_{factory->get_parameters()},
+          system_matrix_{std::move(system_matrix)},
+          agg_(factory->get_executor(), system_matrix_->get_size()[0])
+    {
+        GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix_);
+        this->generate();
+    }
+
+    /**
+     * Aggregates the unknowns of the system matrix and builds the
+     * prolongation, restriction and coarse operators.
+     */
+    void generate();
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    std::shared_ptr<const LinOp> restrict_op_{};
+    std::shared_ptr<const LinOp> coarse_op_{};
+    std::shared_ptr<const LinOp> prolong_op_{};
+    Array<IndexType> agg_;
+
+    /**
+     * Manages the vectors used by apply as a cache, so there is no need to
+     * allocate them in every apply.
+     * Copying an instance will only yield an empty object since copying the
+     * cached vectors would not make sense.
+     */
+    mutable struct cache_struct {
+        cache_struct() = default;
+        ~cache_struct() = default;
+        cache_struct(const cache_struct &) {}
+        cache_struct(cache_struct &&) {}
+        cache_struct &operator=(const cache_struct &) { return *this; }
+        cache_struct &operator=(cache_struct &&) { return *this; }
+        // restricted right hand side
+        std::unique_ptr<matrix::Dense<ValueType>> coarse_b{};
+        // solution on the coarse level
+        std::unique_ptr<matrix::Dense<ValueType>> coarse_x{};
+        // copy of the solution used by the advanced apply
+        std::unique_ptr<matrix::Dense<ValueType>> x_copy{};
+    } cache_;
+};
+
+
+}  // namespace multigrid
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_PGM_HPP_
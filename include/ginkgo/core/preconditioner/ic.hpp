@@ -0,0 +1,259 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_PRECONDITIONER_IC_HPP_
+#define GKO_CORE_PRECONDITIONER_IC_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/factorization/par_ic.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/lower_trs.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * The Incomplete Cholesky (IC) preconditioner solves the equation $LL^Hx = b$
+ * for a given lower triangular matrix L and the right hand side b (can contain
+ * multiple right hand sides).
+ *
+ * Only the factor L is stored. The solve with $L^H$ uses the conjugate
+ * transposed solve of the L solver (see solver::LowerTrs::
+ * apply_conj_transposed), so compared to preconditioner::Ilu, only half of
+ * the factor memory is needed.
+ *
+ * An object of this class can be created with a matrix or a gko::Composition.
+ * If created with a matrix, it is factorized with factorization::ParIc before
+ * creating the solver. If a gko::Composition is used, its first operand will
+ * be taken as the L matrix, so the result of factorization::ParIc can be
+ * directly used, independently of whether it contains $L^H$ or not.
+ *
+ * @note This class is not thread safe (even a const object is not) because it
+ *       uses an internal cache to accelerate multiple (sequential) applies.
+ *       Using it in parallel can lead to segmentation faults, wrong results
+ *       and other unwanted behavior.
+ *
+ * @tparam LSolverType  type of the solver used for the L matrix. It needs to
+ *                      provide `apply_conj_transposed` for the solve with
+ *                      $L^H$. Defaults to solver::LowerTrs
+ * @tparam IndexTypeParIc  Type of the indices when ParIc is used to generate
+ *                         the L factor. Irrelevant otherwise.
+ *
+ * @ingroup precond
+ * @ingroup LinOp
+ */
+template <typename LSolverType = solver::LowerTrs<>,
+          typename IndexTypeParIc = int32>
+class Ic : public EnableLinOp<Ic<LSolverType, IndexTypeParIc>> {
+    friend class EnableLinOp<Ic>;
+    friend class EnablePolymorphicObject<Ic, LinOp>;
+
+public:
+    using value_type = typename LSolverType::value_type;
+    using l_solver_type = LSolverType;
+    using index_type_par_ic = IndexTypeParIc;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Factory for the L solver
+         */
+        std::shared_ptr<typename l_solver_type::Factory> GKO_FACTORY_PARAMETER(
+            l_solver_factory, nullptr);
+    };
+
+    GKO_ENABLE_LIN_OP_FACTORY(Ic, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Returns the solver which is used for the provided L matrix.
+     *
+     * @returns  the solver which is used for the provided L matrix
+     */
+    std::shared_ptr<const l_solver_type> get_l_solver() const
+    {
+        return l_solver_;
+    }
+
+    /**
+     * Recomputes the preconditioner for a new system matrix with the same
+     * sparsity pattern as the one it was generated from.
+     *
+     * The incomplete factor is updated in place, reusing its sparsity pattern.
+     * A solver working directly on the factor (like the default triangular
+     * solver) keeps its analysis, all others are regenerated.
+     *
+     * @param system_matrix  the matrix with the updated values
+     *
+     * @note This is only supported if the factor was computed by this
+     *       preconditioner, i.e. if it was not generated from a Composition.
+     */
+    void update_values(const std::shared_ptr<const LinOp> &system_matrix)
+    {
+        if (par_ic_ == nullptr) {
+            GKO_NOT_SUPPORTED(this);
+        }
+        par_ic_->update_values(system_matrix);
+        const auto l_factor = par_ic_->get_l_factor();
+        const LinOp *l_solver_matrix = l_solver_->get_system_matrix().get();
+        if (l_solver_matrix != l_factor.get()) {
+            l_solver_ = generate_l_solver(l_factor);
+        }
+    }
+
+protected:
+    void apply_impl(const LinOp *b, LinOp *x) const override
+    {
+        set_cache_to(b);
+        l_solver_->apply(b, cache_.intermediate.get());
+        l_solver_->apply_conj_transposed(cache_.intermediate.get(), x);
+    }
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override
+    {
+        auto dense_x = as<matrix::Dense<value_type>>(x);
+        set_cache_to(b);
+        l_solver_->apply(b, cache_.intermediate.get());
+        auto solution = dense_x->clone();
+        l_solver_->apply_conj_transposed(cache_.intermediate.get(),
+                                         solution.get());
+        dense_x->scale(beta);
+        dense_x->add_scaled(alpha, solution.get());
+    }
+
+    explicit Ic(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Ic>(std::move(exec))
+    {}
+
+    explicit Ic(const Factory *factory, std::shared_ptr<const LinOp> lin_op)
+        : EnableLinOp<Ic>(factory->get_executor(), lin_op->get_size()),
+          parameters_{factory->get_parameters()}
+    {
+        auto comp_cast =
+            dynamic_cast<const Composition<value_type> *>(lin_op.get());
+        std::shared_ptr<const LinOp> l_factor;
+
+        if (comp_cast == nullptr) {
+            auto exec = lin_op->get_executor();
+            par_ic_ = share(
+                factorization::ParIc<value_type, index_type_par_ic>::build()
+                    .with_both_factors(false)
+                    .on(exec)
+                    ->generate(lin_op));
+            l_factor = par_ic_->get_l_factor();
+        } else if (comp_cast->get_operators().size() > 0) {
+            l_factor = comp_cast->get_operators()[0];
+        } else {
+            GKO_NOT_SUPPORTED(comp_cast);
+        }
+        GKO_ASSERT_IS_SQUARE_MATRIX(l_factor);
+
+        l_solver_ = generate_l_solver(l_factor);
+    }
+
+    /**
+     * Generates the solver for the L matrix, using a default solver if no
+     * factory was provided.
+     *
+     * @param l_factor  the L matrix
+     */
+    std::shared_ptr<const l_solver_type> generate_l_solver(
+        const std::shared_ptr<const LinOp> &l_factor) const
+    {
+        if (!parameters_.l_solver_factory) {
+            return l_solver_type::build()
+                .on(this->get_executor())
+                ->generate(l_factor);
+        }
+        return parameters_.l_solver_factory->generate(l_factor);
+    }
+
+    /**
+     * Prepares the intermediate vector for the solve by creating it and
+     * by copying the values from `b`, so `b` acts as the initial guess.
+     *
+     * @param b  Right hand side of the first solve. Also acts as the initial
+     *           guess, meaning the intermediate value will be a copy of b
+     */
+    void set_cache_to(const LinOp *b) const
+    {
+        if (cache_.intermediate == nullptr) {
+            cache_.intermediate =
+                matrix::Dense<value_type>::create(this->get_executor());
+        }
+        // Use b as the initial guess for the first triangular solve
+        cache_.intermediate->copy_from(b);
+    }
+
+private:
+    std::shared_ptr<factorization::ParIc<value_type, index_type_par_ic>>
+        par_ic_{};
+    std::shared_ptr<const l_solver_type> l_solver_{};
+    /**
+     * Manages a vector as a cache, so there is no need to allocate one every
+     * time an intermediate vector is required.
+     * Copying an instance will only yield an empty object since copying the
+     * cached vector would not make sense.
+     *
+     * @internal  The struct is present so the whole class can be copyable
+     *            (could also be done with writing `operator=` and copy
+     *            constructor of the enclosing class by hand)
+     */
+    mutable struct cache_struct {
+        cache_struct() = default;
+        ~cache_struct() = default;
+        cache_struct(const cache_struct &) {}
+        cache_struct(cache_struct &&) {}
+        cache_struct &operator=(const cache_struct &) { return *this; }
+        cache_struct &operator=(cache_struct &&) { return *this; }
+        std::unique_ptr<LinOp> intermediate{};
+    } cache_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_IC_HPP_
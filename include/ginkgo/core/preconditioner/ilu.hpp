@@ -163,6 +163,37 @@ public:
         return u_solver_;
     }
 
+    /**
+     * Recomputes the preconditioner for a new system matrix with the same
+     * sparsity pattern as the one it was generated from.
+     *
+     * The incomplete factors are updated in place, reusing their sparsity
+     * pattern. Solvers working directly on the factors (like the default
+     * triangular solvers) keep their analysis, all others are regenerated.
+     *
+     * @param system_matrix  the matrix with the updated values
+     *
+     * @note This is only supported if the factors were computed by this
+     *       preconditioner, i.e. if it was not generated from a Composition.
+     */
+    void update_values(const std::shared_ptr<const LinOp> &system_matrix)
+    {
+        if (par_ilu_ == nullptr) {
+            GKO_NOT_SUPPORTED(this);
+        }
+        par_ilu_->update_values(system_matrix);
+        const auto l_factor = par_ilu_->get_l_factor();
+        const auto u_factor = par_ilu_->get_u_factor();
+        const LinOp *l_solver_matrix = l_solver_->get_system_matrix().get();
+        if (l_solver_matrix != l_factor.get()) {
+            l_solver_ = generate_l_solver(l_factor);
+        }
+        const LinOp *u_solver_matrix = u_solver_->get_system_matrix().get();
+        if (u_solver_matrix != u_factor.get()) {
+            u_solver_ = generate_u_solver(u_factor);
+        }
+    }
+
 protected:
     void apply_impl(const LinOp *b, LinOp *x) const override
     {
@@ -204,12 +235,12 @@ protected:
 
         if (comp_cast == nullptr) {
             auto exec = lin_op->get_executor();
-            auto par_ilu =
+            par_ilu_ = share(
                 factorization::ParIlu<value_type, index_type_par_ilu>::build()
                     .on(exec)
-                    ->generate(lin_op);
-            l_factor = par_ilu->get_l_factor();
-            u_factor = par_ilu->get_u_factor();
+                    ->generate(lin_op));
+            l_factor = par_ilu_->get_l_factor();
+            u_factor = par_ilu_->get_u_factor();
         } else if (comp_cast->get_operators().size() == 2) {
             l_factor = comp_cast->get_operators()[0];
             u_factor = comp_cast->get_operators()[1];
@@ -218,19 +249,40 @@ protected:
         }
         GKO_ASSERT_EQUAL_DIMENSIONS(l_factor, u_factor);
 
-        auto exec = this->get_executor();
+        l_solver_ = generate_l_solver(l_factor);
+        u_solver_ = generate_u_solver(u_factor);
+    }
 
-        // If no factories are provided, generate default ones
+    /**
+     * Generates the solver for the L matrix, using a default solver if no
+     * factory was provided.
+     *
+     * @param l_factor  the L matrix
+     */
+    std::shared_ptr<const l_solver_type> generate_l_solver(
+        const std::shared_ptr<const LinOp> &l_factor) const
+    {
         if (!parameters_.l_solver_factory) {
-            l_solver_ = generate_default_solver<l_solver_type>(exec, l_factor);
-        } else {
-            l_solver_ = parameters_.l_solver_factory->generate(l_factor);
+            return generate_default_solver<l_solver_type>(this->get_executor(),
+                                                          l_factor);
         }
+        return parameters_.l_solver_factory->generate(l_factor);
+    }
+
+    /**
+     * Generates the solver for the U matrix, using a default solver if no
+     * factory was provided.
+     *
+     * @param u_factor  the U matrix
+     */
+    std::shared_ptr<const u_solver_type> generate_u_solver(
+        const std::shared_ptr<const LinOp> &u_factor) const
+    {
         if (!parameters_.u_solver_factory) {
-            u_solver_ = generate_default_solver<u_solver_type>(exec, u_factor);
-        } else {
-            u_solver_ = parameters_.u_solver_factory->generate(u_factor);
+            return generate_default_solver<u_solver_type>(this->get_executor(),
+                                                          u_factor);
         }
+        return parameters_.u_solver_factory->generate(u_factor);
     }
 
     /**
@@ -334,6 +386,8 @@ protected:
     }
 
 private:
+    std::shared_ptr<factorization::ParIlu<value_type, index_type_par_ilu>>
+        par_ilu_{};
     std::shared_ptr<const l_solver_type> l_solver_{};
     std::shared_ptr<const u_solver_type> u_solver_{};
     /**
@@ -190,6 +190,12 @@ struct block_interleaved_storage_scheme {
  * setting the Jacobi::Factory's `storage_optimization` parameter.  Refer to the
  * documentation of the parameter for more details.
  *
+ * If the maximum block size is set to 1 and no storage optimization is used,
+ * the preconditioner becomes a scalar (point) Jacobi preconditioner. In this
+ * case, block detection, the block-interleaved storage and the block inversion
+ * are skipped: only the inverted diagonal of the matrix is stored as one
+ * contiguous array, and the application reduces to an elementwise product.
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  integral type used to store pointers to the start of each
  *                    block
@@ -287,12 +293,27 @@ public:
 
     void write(mat_data &data) const override;
 
+    /**
+     * Recomputes the preconditioner for a new system matrix with the same
+     * sparsity pattern as the one it was generated from.
+     *
+     * The block structure, the storage scheme and the precision hints
+     * determined during generation are reused, only the diagonal blocks are
+     * extracted and inverted again.
+     *
+     * @param system_matrix  the matrix with the updated values
+     */
+    void update_values(const LinOp *system_matrix);
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
          * Maximal size of diagonal blocks.
          *
          * @note This value has to be between 1 and 32.
+         * @note A value of 1 without storage optimization selects the scalar
+         *       Jacobi preconditioner, which sets the block_pointers
+         *       parameter to one block per row during generation.
          */
         uint32 GKO_FACTORY_PARAMETER(max_block_size, 32u);
 
@@ -462,7 +483,8 @@ protected:
         : EnableLinOp<Jacobi>(exec),
           num_blocks_{},
           blocks_(exec),
-          conditioning_(exec)
+          conditioning_(exec),
+          precision_hints_(exec)
     {
         parameters_.block_pointers.set_executor(exec);
         parameters_.storage_optimization.block_wise.set_executor(exec);
@@ -485,7 +507,8 @@ protected:
           blocks_(factory->get_executor(),
                   storage_scheme_.compute_storage_space(
                       parameters_.block_pointers.get_num_elems() - 1)),
-          conditioning_(factory->get_executor())
+          conditioning_(factory->get_executor()),
+          precision_hints_(factory->get_executor())
     {
         if (parameters_.max_block_size > 32 || parameters_.max_block_size < 1) {
             GKO_NOT_SUPPORTED(this);
@@ -541,6 +564,28 @@ protected:
      */
     void detect_blocks(const matrix::Csr<ValueType, IndexType> *system_matrix);
 
+    /**
+     * Extracts and inverts the diagonal blocks, reusing the block structure
+     * and storage scheme determined by generate().
+     *
+     * @param system_matrix  the source matrix of the diagonal blocks
+     */
+    void compute_blocks(const matrix::Csr<ValueType, IndexType> *system_matrix);
+
+    /**
+     * Returns true if this is a scalar Jacobi preconditioner, which only
+     * stores the inverted diagonal of the system matrix.
+     *
+     * @return whether this is a scalar Jacobi preconditioner
+     */
+    bool is_scalar() const noexcept
+    {
+        return parameters_.max_block_size == 1 &&
+               !parameters_.storage_optimization.is_block_wise &&
+               parameters_.storage_optimization.of_all_blocks ==
+                   precision_reduction(0, 0);
+    }
+
     void apply_impl(const LinOp *b, LinOp *x) const override;
 
     void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
@@ -551,6 +596,7 @@ private:
     size_type num_blocks_;
     Array<value_type> blocks_;
     Array<remove_complex<value_type>> conditioning_;
+    Array<precision_reduction> precision_hints_;
 };
 
 
@@ -39,11 +39,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/log/logger.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/workspace.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/criterion.hpp>
 
@@ -55,6 +57,38 @@ namespace solver {
 constexpr size_type default_krylov_dim = 100u;
 
 
+namespace gmres {
+
+
+/**
+ * Specifies how the Arnoldi process of Gmres orthogonalizes a new Krylov
+ * vector against the previous ones.
+ */
+enum class ortho_method {
+    /**
+     * Modified Gram-Schmidt: the new vector is orthogonalized against one
+     * previous basis vector at a time. This is the most robust variant, but
+     * it needs one dot product and one update pass per basis vector.
+     */
+    mgs,
+    /**
+     * Classical Gram-Schmidt: all projections are computed from the
+     * unmodified vector, so the orthogonalization is done in two passes over
+     * the Krylov basis. It loses orthogonality faster than MGS.
+     */
+    cgs,
+    /**
+     * Classical Gram-Schmidt with one step of reorthogonalization: the CGS
+     * passes are applied twice, which recovers the orthogonality of MGS at
+     * the cost of four passes over the Krylov basis.
+     */
+    cgs2
+};
+
+
+}  // namespace gmres
+
+
 /**
  * GMRES or the generalized minimal residual method is an iterative type Krylov
  * subspace method which is suitable for nonsymmetric linear systems.
@@ -63,13 +97,27 @@ constexpr size_type default_krylov_dim = 100u;
  * use of data locality. The inner operations in one iteration of GMRES are
  * merged into 2 separate steps.
  *
+ * The orthogonalization scheme of the Arnoldi process can be selected with the
+ * `ortho_method` parameter. The classical Gram-Schmidt variants need far fewer
+ * synchronization points than the default modified Gram-Schmidt, which pays
+ * off for large Krylov dimensions.
+ *
+ * The Krylov basis is the largest object of the solver and is traversed in
+ * every iteration, which makes GMRES memory-bound. The `storage_precision`
+ * parameter stores the basis in a reduced precision and converts its values to
+ * ValueType on every load, so halving the size of the basis roughly halves the
+ * memory traffic of the orthogonalization, and allows larger Krylov dimensions
+ * for the same amount of memory.
+ *
  * @tparam ValueType  precision of matrix elements
  *
  * @ingroup solvers
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision>
-class Gmres : public EnableLinOp<Gmres<ValueType>>, public Preconditionable {
+class Gmres : public EnableLinOp<Gmres<ValueType>>,
+              public Preconditionable,
+              public EnableWorkspace {
     friend class EnableLinOp<Gmres>;
     friend class EnablePolymorphicObject<Gmres, LinOp>;
 
@@ -118,6 +166,32 @@ public:
          * krylov dimension factory.
          */
         size_type GKO_FACTORY_PARAMETER(krylov_dim, 0u);
+
+        /**
+         * Orthogonalization scheme used by the Arnoldi process.
+         */
+        gmres::ortho_method GKO_FACTORY_PARAMETER(ortho_method,
+                                                  gmres::ortho_method::mgs);
+
+        /**
+         * Precision in which the Krylov basis is stored.
+         *
+         * The reduction is interpreted in the same way as the storage
+         * optimization of the block-Jacobi preconditioner, e.g.
+         * `precision_reduction(0, 1)` stores a `double` basis in `float`,
+         * `precision_reduction(0, 2)` in 16-bit half precision and
+         * `precision_reduction(1, 0)` keeps only the upper half of the bits of
+         * each value. All computations, including the Hessenberg matrix, are
+         * still done in ValueType. The default value (and
+         * `precision_reduction::autodetect()`) keeps the basis in ValueType.
+         *
+         * @note A reduced storage precision is only supported by the
+         *       reference and OpenMP executors. Generating a solver with a
+         *       reduced storage precision on a CUDA or HIP executor throws a
+         *       NotSupported exception.
+         */
+        precision_reduction GKO_FACTORY_PARAMETER(storage_precision,
+                                                  precision_reduction(0, 0));
     };
     GKO_ENABLE_LIN_OP_FACTORY(Gmres, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -139,6 +213,17 @@ protected:
           parameters_{factory->get_parameters()},
           system_matrix_{std::move(system_matrix)}
     {
+        const auto storage_prec = parameters_.storage_precision;
+        if (storage_prec != precision_reduction(0, 0) &&
+            storage_prec != precision_reduction::autodetect()) {
+            // compressed Krylov bases are only implemented for the reference
+            // and OpenMP executors
+            const auto exec = this->get_executor().get();
+            if (dynamic_cast<const CudaExecutor *>(exec) != nullptr ||
+                dynamic_cast<const HipExecutor *>(exec) != nullptr) {
+                GKO_NOT_SUPPORTED(*exec);
+            }
+        }
         if (parameters_.generated_preconditioner) {
             GKO_ASSERT_EQUAL_DIMENSIONS(parameters_.generated_preconditioner,
                                         this);
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/workspace.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/criterion.hpp>
 
@@ -94,7 +95,7 @@ namespace solver {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision>
-class Ir : public EnableLinOp<Ir<ValueType>> {
+class Ir : public EnableLinOp<Ir<ValueType>>, public EnableWorkspace {
     friend class EnableLinOp<Ir>;
     friend class EnablePolymorphicObject<Ir, LinOp>;
 
@@ -150,6 +151,14 @@ public:
          */
         std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER(generated_solver,
                                                            nullptr);
+
+        /**
+         * Relaxation factor for the update of the solution, i.e.
+         * `solution = solution + relaxation_factor * error`. Values below 1
+         * damp the inner solver, which turns Ir with a Jacobi inner solver
+         * into a damped Jacobi method (e.g. for use as multigrid smoother).
+         */
+        ValueType GKO_FACTORY_PARAMETER(relaxation_factor, value_type{1});
     };
     GKO_ENABLE_LIN_OP_FACTORY(Ir, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -95,6 +95,23 @@ public:
         return system_matrix_;
     }
 
+    /**
+     * Solves the conjugate transposed system $L^H x = b$ with the stored
+     * system matrix $L$, without forming $L^H$ explicitly. This allows
+     * symmetric preconditioners like preconditioner::Ic to store only a
+     * single triangular factor.
+     *
+     * The diagonal entry of each row is located by its column index, so the
+     * entries of a row do not need to be sorted. Entries above the diagonal
+     * are ignored, and a missing diagonal entry is treated as zero.
+     * The OpenMP executor reuses the levels of the analysis phase in reverse
+     * order, and the same logger events as for apply() are emitted.
+     *
+     * @param b  the right hand side(s)
+     * @param x  the solution vector(s), of the same size as b
+     */
+    void apply_conj_transposed(const LinOp *b, LinOp *x) const;
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
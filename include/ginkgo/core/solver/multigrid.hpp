@@ -0,0 +1,312 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_SOLVER_MULTIGRID_HPP_
+#define GKO_CORE_SOLVER_MULTIGRID_HPP_
+
+
+#include <memory>
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/multigrid_level.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * The cycle used by Multigrid to visit the levels of its hierarchy.
+ */
+enum class multigrid_cycle {
+    /**
+     * Visits every coarser level once per visit of the finer level.
+     */
+    v,
+    /**
+     * Visits every coarser level twice per visit of the finer level.
+     */
+    w
+};
+
+
+/**
+ * Multigrid (MG) is an iterative method which reduces the error of the
+ * current solution on a hierarchy of successively coarser levels.
+ *
+ * On every level, a few steps of a smoother reduce the high-frequency
+ * components of the error. The residual is then restricted to the next
+ * coarser level, where the remaining smooth error is approximated
+ * recursively, and the coarse correction is prolongated back and added to the
+ * solution. On the coarsest level, the system is solved with the coarsest
+ * solver.
+ *
+ * The hierarchy is built by the `mg_level` factory, whose generated LinOps
+ * have to implement multigrid::MultigridLevel, until the coarse operator has
+ * at most `min_coarse_rows` rows, `max_levels` levels exist, or the
+ * coarsening does not reduce the size anymore. By default, the aggregation
+ * of multigrid::Pgm is used.
+ *
+ * The smoothers are generated on each level and have to use the current
+ * solution as initial guess, e.g. solver::Ir. By default, one step of Jacobi
+ * damped by 0.9 (solver::Ir with a scalar preconditioner::Jacobi) is used
+ * before and after the coarse correction. The default coarsest solver runs
+ * four steps of the same damped Jacobi method.
+ *
+ * If stopping criteria are given, Multigrid is a standalone solver which
+ * repeats the cycle, using the initial value of the solution, until the
+ * criteria are met. Without criteria, every application runs a single cycle
+ * starting from a zero solution, which is what is expected from a
+ * preconditioner.
+ *
+ * @note This class is not thread safe (even a const object is not) because it
+ *       uses an internal cache for the vectors of the coarse levels.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class Multigrid : public EnableLinOp<Multigrid<ValueType>> {
+    friend class EnableLinOp<Multigrid>;
+    friend class EnablePolymorphicObject<Multigrid, LinOp>;
+
+public:
+    using value_type = ValueType;
+
+    /**
+     * Returns the system operator (matrix) of the linear system.
+     *
+     * @return the system operator (matrix)
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    /**
+     * Returns the levels of the multigrid hierarchy, starting with the finest
+     * one. Each of them implements multigrid::MultigridLevel.
+     *
+     * @return the levels of the multigrid hierarchy
+     */
+    const std::vector<std::shared_ptr<const LinOp>> &get_mg_level_list() const
+    {
+        return mg_level_list_;
+    }
+
+    /**
+     * Returns the smoothers applied before the coarse correction, one per
+     * level.
+     *
+     * @return the pre-smoothers
+     */
+    const std::vector<std::shared_ptr<const LinOp>> &get_pre_smoother_list()
+        const
+    {
+        return pre_smoother_list_;
+    }
+
+    /**
+     * Returns the smoothers applied after the coarse correction, one per
+     * level.
+     *
+     * @return the post-smoothers
+     */
+    const std::vector<std::shared_ptr<const LinOp>> &get_post_smoother_list()
+        const
+    {
+        return post_smoother_list_;
+    }
+
+    /**
+     * Returns the solver used on the coarsest level.
+     *
+     * @return the coarsest solver
+     */
+    std::shared_ptr<const LinOp> get_coarsest_solver() const
+    {
+        return coarsest_solver_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Criterion factories. If none are given, every application runs a
+         * single cycle from a zero initial guess.
+         */
+        std::vector<std::shared_ptr<const stop::CriterionFactory>>
+            GKO_FACTORY_PARAMETER(criteria, nullptr);
+
+        /**
+         * Factory generating the levels of the hierarchy. The default value
+         * `nullptr` results in multigrid::Pgm.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER(mg_level,
+                                                                  nullptr);
+
+        /**
+         * Factory generating the smoothers applied before the coarse
+         * correction. The default value `nullptr` results in one step of
+         * damped Jacobi.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER(
+            pre_smoother, nullptr);
+
+        /**
+         * Factory generating the smoothers applied after the coarse
+         * correction. The default value `nullptr` reuses the pre-smoothers.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER(
+            post_smoother, nullptr);
+
+        /**
+         * Factory generating the solver on the coarsest level. The default
+         * value `nullptr` results in four steps of damped Jacobi.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER(
+            coarsest_solver, nullptr);
+
+        /**
+         * The maximum number of levels, including the coarsest one.
+         */
+        size_type GKO_FACTORY_PARAMETER(max_levels, 10u);
+
+        /**
+         * The coarsening stops once a level has at most this many rows.
+         */
+        size_type GKO_FACTORY_PARAMETER(min_coarse_rows, 64u);
+
+        /**
+         * The cycle used to visit the levels.
+         */
+        multigrid_cycle GKO_FACTORY_PARAMETER(cycle, multigrid_cycle::v);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Multigrid, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+    /**
+     * Runs one cycle on the given level, using x as initial guess.
+     *
+     * @param level  the level of the hierarchy, `get_mg_level_list().size()`
+     *               denotes the coarsest one
+     * @param b  the right hand side on this level
+     * @param x  the solution on this level
+     */
+    void run_cycle(size_type level, const matrix::Dense<ValueType> *b,
+                   matrix::Dense<ValueType> *x) const;
+
+    /**
+     * Builds the hierarchy, the smoothers and the coarsest solver.
+     */
+    void generate();
+
+    explicit Multigrid(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Multigrid>(std::move(exec))
+    {}
+
+    explicit Multigrid(const Factory *factory,
+                       std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Multigrid>(factory->get_executor(),
+                                 transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()},
+          system_matrix_{std::move(system_matrix)}
+    {
+        GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix_);
+        this->generate();
+        if (!parameters_.criteria.empty()) {
+            stop_criterion_factory_ =
+                stop::combine(std::move(parameters_.criteria));
+        }
+    }
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    std::vector<std::shared_ptr<const LinOp>> mg_level_list_{};
+    std::vector<std::shared_ptr<const LinOp>> pre_smoother_list_{};
+    std::vector<std::shared_ptr<const LinOp>> post_smoother_list_{};
+    std::shared_ptr<const LinOp> coarsest_solver_{};
+    std::shared_ptr<const stop::CriterionFactory> stop_criterion_factory_{};
+
+    /**
+     * Manages the vectors of the coarse levels and of the outer iteration as
+     * a cache, so there is no need to allocate them in every cycle or apply.
+     * Copying an instance will only yield an empty object since copying the
+     * cached vectors would not make sense.
+     */
+    mutable struct cache_struct {
+        cache_struct() = default;
+        ~cache_struct() = default;
+        cache_struct(const cache_struct &) {}
+        cache_struct(cache_struct &&) {}
+        cache_struct &operator=(const cache_struct &) { return *this; }
+        cache_struct &operator=(cache_struct &&) { return *this; }
+        // residual on each level
+        std::vector<std::unique_ptr<matrix::Dense<ValueType>>> r{};
+        // restricted residual (right hand side) on the next coarser level
+        std::vector<std::unique_ptr<matrix::Dense<ValueType>>> b{};
+        // correction on the next coarser level
+        std::vector<std::unique_ptr<matrix::Dense<ValueType>>> x{};
+        // residual of the outer iteration
+        std::unique_ptr<matrix::Dense<ValueType>> residual{};
+        // stopping status of the outer iteration
+        Array<stopping_status> stop_status{};
+        // copy of the solution used by the advanced apply
+        std::unique_ptr<matrix::Dense<ValueType>> x_copy{};
+        std::unique_ptr<matrix::Dense<ValueType>> one{};
+        std::unique_ptr<matrix::Dense<ValueType>> neg_one{};
+    } cache_;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_MULTIGRID_HPP_
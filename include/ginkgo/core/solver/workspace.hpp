@@ -0,0 +1,261 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_SOLVER_WORKSPACE_HPP_
+#define GKO_CORE_SOLVER_WORKSPACE_HPP_
+
+
+#include <memory>
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace solver {
+namespace detail {
+
+
+/**
+ * Stores the temporary vectors and arrays of a solver between calls to its
+ * apply method.
+ *
+ * Each object is identified by an id chosen by the solver. It is recreated
+ * only if it does not exist yet, or if the requested size, type or executor
+ * differs from the stored one. The contents of reused objects are left as
+ * they are, so the solver has to initialize them on every apply.
+ *
+ * Copying or moving a workspace does not transfer its contents, the copy
+ * starts out empty.
+ */
+class workspace {
+public:
+    workspace() = default;
+
+    workspace(const workspace &) {}
+
+    workspace(workspace &&) noexcept {}
+
+    workspace &operator=(const workspace &)
+    {
+        this->clear();
+        return *this;
+    }
+
+    workspace &operator=(workspace &&) noexcept
+    {
+        this->clear();
+        return *this;
+    }
+
+    /**
+     * Returns a dense vector of the requested size.
+     *
+     * @param exec  the executor of the vector
+     * @param id  the id of the vector
+     * @param size  the size of the vector
+     *
+     * @return the vector with the given id
+     */
+    template <typename ValueType>
+    matrix::Dense<ValueType> *get_vector(std::shared_ptr<const Executor> exec,
+                                         size_type id, const dim<2> &size)
+    {
+        using Vector = matrix::Dense<ValueType>;
+        auto &op = get_entry(operators_, id);
+        auto vector = dynamic_cast<Vector *>(op.get());
+        if (vector == nullptr || vector->get_size() != size ||
+            vector->get_executor() != exec) {
+            op = Vector::create(std::move(exec), size);
+            vector = static_cast<Vector *>(op.get());
+        }
+        return vector;
+    }
+
+    /**
+     * Returns a 1x1 dense matrix storing a constant value.
+     *
+     * The value is only written when the matrix is created, so a solver must
+     * use each id for a single value.
+     *
+     * @param exec  the executor of the constant
+     * @param id  the id of the constant
+     * @param value  the value of the constant
+     *
+     * @return the constant with the given id
+     */
+    template <typename ValueType>
+    const matrix::Dense<ValueType> *get_constant(
+        std::shared_ptr<const Executor> exec, size_type id, ValueType value)
+    {
+        using Vector = matrix::Dense<ValueType>;
+        auto &op = get_entry(constants_, id);
+        auto constant = dynamic_cast<Vector *>(op.get());
+        if (constant == nullptr || constant->get_executor() != exec) {
+            op = initialize<Vector>({value}, std::move(exec));
+            constant = static_cast<Vector *>(op.get());
+        }
+        return constant;
+    }
+
+    /**
+     * Returns an array of the requested size.
+     *
+     * @param exec  the executor of the array
+     * @param id  the id of the array
+     * @param num_elems  the size of the array
+     *
+     * @return the array with the given id
+     */
+    template <typename ValueType>
+    Array<ValueType> &get_array(std::shared_ptr<const Executor> exec,
+                                size_type id, size_type num_elems)
+    {
+        auto &array = get_scratch_array<ValueType>(std::move(exec), id);
+        if (array.get_num_elems() != num_elems) {
+            array.resize_and_reset(num_elems);
+        }
+        return array;
+    }
+
+    /**
+     * Returns an array whose size is managed by the kernels using it, e.g.
+     * scratch space that a kernel enlarges to the size it needs. The size is
+     * kept between calls, so the array is only reallocated if a kernel
+     * needs more space than before.
+     *
+     * @param exec  the executor of the array
+     * @param id  the id of the array, shared with the ids of get_array
+     *
+     * @return the array with the given id
+     */
+    template <typename ValueType>
+    Array<ValueType> &get_scratch_array(std::shared_ptr<const Executor> exec,
+                                        size_type id)
+    {
+        auto &holder = get_entry(arrays_, id);
+        auto typed = dynamic_cast<array_holder<ValueType> *>(holder.get());
+        if (typed == nullptr || typed->array.get_executor() != exec) {
+            holder.reset(new array_holder<ValueType>(std::move(exec)));
+            typed = static_cast<array_holder<ValueType> *>(holder.get());
+        }
+        return typed->array;
+    }
+
+    /**
+     * Frees all objects stored in the workspace.
+     */
+    void clear()
+    {
+        operators_.clear();
+        constants_.clear();
+        arrays_.clear();
+    }
+
+private:
+    struct array_holder_base {
+        virtual ~array_holder_base() = default;
+    };
+
+    template <typename ValueType>
+    struct array_holder : array_holder_base {
+        explicit array_holder(std::shared_ptr<const Executor> exec)
+            : array(std::move(exec))
+        {}
+
+        Array<ValueType> array;
+    };
+
+    template <typename T>
+    static std::unique_ptr<T> &get_entry(std::vector<std::unique_ptr<T>> &list,
+                                         size_type id)
+    {
+        if (list.size() <= id) {
+            list.resize(id + 1);
+        }
+        return list[id];
+    }
+
+    std::vector<std::unique_ptr<LinOp>> operators_;
+    std::vector<std::unique_ptr<LinOp>> constants_;
+    std::vector<std::unique_ptr<array_holder_base>> arrays_;
+};
+
+
+}  // namespace detail
+
+
+/**
+ * A solver implementing this interface keeps the temporary vectors it needs
+ * during apply() alive between calls, as long as the shape of the right hand
+ * side and the executor stay the same.
+ *
+ * This avoids allocating memory on every call when the same solver is applied
+ * to many right hand sides. As a consequence, the same solver object must not
+ * be applied from multiple threads at the same time.
+ *
+ * @ingroup solvers
+ */
+class EnableWorkspace {
+public:
+    virtual ~EnableWorkspace() = default;
+
+    /**
+     * Frees the temporary vectors kept by the solver. They are allocated again
+     * on the next apply.
+     */
+    void release_workspace() const { workspace_.clear(); }
+
+protected:
+    /**
+     * Returns the workspace of the solver.
+     *
+     * @return the workspace of the solver
+     */
+    detail::workspace &get_workspace() const { return workspace_; }
+
+private:
+    mutable detail::workspace workspace_;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_WORKSPACE_HPP_
@@ -0,0 +1,140 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_OMP_BASE_BLAS_BINDINGS_HPP_
+#define GKO_OMP_BASE_BLAS_BINDINGS_HPP_
+
+
+#include <complex>
+#include <limits>
+
+
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#ifdef GINKGO_OMP_USE_BLAS
+
+
+extern "C" {
+
+
+void sgemm_(const char *transa, const char *transb, const int *m, const int *n,
+            const int *k, const float *alpha, const float *a, const int *lda,
+            const float *b, const int *ldb, const float *beta, float *c,
+            const int *ldc);
+
+void dgemm_(const char *transa, const char *transb, const int *m, const int *n,
+            const int *k, const double *alpha, const double *a, const int *lda,
+            const double *b, const int *ldb, const double *beta, double *c,
+            const int *ldc);
+
+void cgemm_(const char *transa, const char *transb, const int *m, const int *n,
+            const int *k, const std::complex<float> *alpha,
+            const std::complex<float> *a, const int *lda,
+            const std::complex<float> *b, const int *ldb,
+            const std::complex<float> *beta, std::complex<float> *c,
+            const int *ldc);
+
+void zgemm_(const char *transa, const char *transb, const int *m, const int *n,
+            const int *k, const std::complex<double> *alpha,
+            const std::complex<double> *a, const int *lda,
+            const std::complex<double> *b, const int *ldb,
+            const std::complex<double> *beta, std::complex<double> *c,
+            const int *ldc);
+
+
+}  // extern "C"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The BLAS namespace.
+ *
+ * Bindings to the (Fortran interface of the) BLAS library Ginkgo was
+ * configured with using `GINKGO_OMP_USE_BLAS`.
+ *
+ * @ingroup blas
+ */
+namespace blas {
+
+
+/**
+ * Checks whether all dimensions and strides fit into the 32 bit integers used
+ * by the BLAS interface.
+ */
+template <typename... Sizes>
+inline bool fits_blas_int(Sizes... sizes)
+{
+    const size_type all_sizes[] = {static_cast<size_type>(sizes)...};
+    for (auto size : all_sizes) {
+        if (size > static_cast<size_type>(std::numeric_limits<int>::max())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+#define GKO_BIND_BLAS_GEMM(ValueType, BlasName)                               \
+    inline void gemm(int m, int n, int k, ValueType alpha, const ValueType *a, \
+                     int lda, const ValueType *b, int ldb, ValueType beta,    \
+                     ValueType *c, int ldc)                                   \
+    {                                                                         \
+        const char no_trans = 'N';                                            \
+        BlasName(&no_trans, &no_trans, &m, &n, &k, &alpha, a, &lda, b, &ldb,  \
+                 &beta, c, &ldc);                                             \
+    }                                                                         \
+    static_assert(true,                                                       \
+                  "This assert is used to counter the false positive extra "  \
+                  "semi-colon warnings")
+
+GKO_BIND_BLAS_GEMM(float, sgemm_);
+GKO_BIND_BLAS_GEMM(double, dgemm_);
+GKO_BIND_BLAS_GEMM(std::complex<float>, cgemm_);
+GKO_BIND_BLAS_GEMM(std::complex<double>, zgemm_);
+
+#undef GKO_BIND_BLAS_GEMM
+
+
+}  // namespace blas
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GINKGO_OMP_USE_BLAS
+
+
+#endif  // GKO_OMP_BASE_BLAS_BINDINGS_HPP_
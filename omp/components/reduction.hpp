@@ -0,0 +1,249 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_OMP_COMPONENTS_REDUCTION_HPP_
+#define GKO_OMP_COMPONENTS_REDUCTION_HPP_
+
+
+#include <algorithm>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+
+
+/**
+ * @internal
+ *
+ * Minimal number of rows processed by a single block of a blocked reduction.
+ * Smaller inputs use fewer blocks, so the fork/join overhead does not
+ * dominate short vectors.
+ */
+constexpr size_type min_rows_per_reduction_block = 1024;
+
+
+/**
+ * @internal
+ *
+ * Returns the number of row blocks a blocked reduction over `num_rows` rows
+ * is split into.
+ *
+ * The result only depends on `num_rows` and the maximal number of OpenMP
+ * threads, so repeated reductions with the same setup combine their partial
+ * results in the same order.
+ */
+inline size_type get_num_reduction_blocks(size_type num_rows)
+{
+    const auto max_blocks = ceildiv(num_rows, min_rows_per_reduction_block);
+    return std::max<size_type>(
+        1, std::min<size_type>(omp_get_max_threads(), max_blocks));
+}
+
+
+/**
+ * @internal
+ *
+ * Returns the number of cache line padded values storing the partial
+ * results of a blocked reduction computing `num_values` sums of `num_rows`
+ * rows each.
+ *
+ * A caller that keeps an array of at least this size between reductions can
+ * pass it as workspace to blocked_column_reduction or
+ * blocked_column_multi_reduction, so the reduction does not allocate memory.
+ */
+template <typename ValueType>
+size_type get_reduction_workspace_size(size_type num_rows, size_type num_values)
+{
+    // pad each block's partial results to a full cache line
+    constexpr size_type values_per_line =
+        sizeof(ValueType) < 64 ? 64 / sizeof(ValueType) : 1;
+    return get_num_reduction_blocks(num_rows) *
+           ceildiv(num_values, values_per_line) * values_per_line;
+}
+
+
+/**
+ * @internal
+ *
+ * Computes `num_values` column-wise sums per column in a single sweep:
+ * `result[k * num_cols + j] = sum_i v_k(i, j)` for all `0 <= i < num_rows`,
+ * `0 <= j < num_cols` and `0 <= k < num_values`, where
+ * `op(i, j, sums)` adds the contributions `v_k(i, j)` to `sums[k]`.
+ *
+ * The rows are split into contiguous blocks which are reduced in parallel,
+ * each into its own (cache line padded) slot of partial results. The partial
+ * results are then summed up in ascending block order, which makes the result
+ * deterministic for a fixed number of threads. Inside a block, the rows are
+ * traversed in storage order, which keeps the access pattern contiguous for
+ * tall and skinny row-major multi-vectors.
+ *
+ * `op` is evaluated exactly once per entry, with the columns of a row visited
+ * in ascending order. This allows kernels to update an entry inside `op` and
+ * reduce the updated value in the same sweep.
+ *
+ * @tparam num_values  number of sums computed for each column
+ *
+ * @param num_rows  number of rows to reduce over
+ * @param num_cols  number of columns
+ * @param op  the operation adding the contributions of entry (i, j)
+ * @param result  output array of size `num_values * num_cols`
+ * @param workspace  array for the partial results, it is enlarged to
+ *                   get_reduction_workspace_size(num_rows,
+ *                   num_values * num_cols) if it is smaller
+ */
+template <size_type num_values, typename ValueType, typename Operation>
+void blocked_column_multi_reduction(size_type num_rows, size_type num_cols,
+                                    Operation op, ValueType *result,
+                                    Array<ValueType> &workspace)
+{
+    if (num_cols == 0) {
+        return;
+    }
+    const auto num_blocks = get_num_reduction_blocks(num_rows);
+    const size_type rows_per_block = ceildiv(num_rows, num_blocks);
+    const auto workspace_size =
+        get_reduction_workspace_size<ValueType>(num_rows, num_values * num_cols);
+    if (workspace.get_num_elems() < workspace_size) {
+        workspace.resize_and_reset(workspace_size);
+    }
+    const auto partial_stride = workspace_size / num_blocks;
+    auto partial = workspace.get_data();
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_type block = 0; block < num_blocks; ++block) {
+        const auto begin = block * rows_per_block;
+        const auto end = std::min(begin + rows_per_block, num_rows);
+        auto block_partial = partial + block * partial_stride;
+        if (num_cols == 1) {
+            // accumulate in local variables, which do not alias the input
+            ValueType sums[num_values]{};
+            for (size_type row = begin; row < end; ++row) {
+                op(row, 0, sums);
+            }
+            std::copy_n(sums, num_values, block_partial);
+        } else {
+            ValueType sums[num_values];
+            std::fill_n(block_partial, num_values * num_cols,
+                        zero<ValueType>());
+            for (size_type row = begin; row < end; ++row) {
+                for (size_type col = 0; col < num_cols; ++col) {
+                    std::fill_n(sums, num_values, zero<ValueType>());
+                    op(row, col, sums);
+                    for (size_type k = 0; k < num_values; ++k) {
+                        block_partial[k * num_cols + col] += sums[k];
+                    }
+                }
+            }
+        }
+    }
+
+    for (size_type value = 0; value < num_values * num_cols; ++value) {
+        auto sum = zero<ValueType>();
+        for (size_type block = 0; block < num_blocks; ++block) {
+            sum += partial[block * partial_stride + value];
+        }
+        result[value] = sum;
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes the column-wise sums `result[j] = sum_i op(i, j)` for all
+ * `0 <= i < num_rows` and `0 <= j < num_cols`, with the partial results
+ * stored in `workspace`.
+ *
+ * @see blocked_column_multi_reduction
+ *
+ * @param num_rows  number of rows to reduce over
+ * @param num_cols  number of independent reductions
+ * @param op  the operation computing the contribution of entry (i, j)
+ * @param result  output array of size `num_cols`
+ * @param workspace  array for the partial results, it is enlarged to
+ *                   get_reduction_workspace_size(num_rows, num_cols) if it is
+ *                   smaller
+ */
+template <typename ValueType, typename Operation>
+void blocked_column_reduction(size_type num_rows, size_type num_cols,
+                              Operation op, ValueType *result,
+                              Array<ValueType> &workspace)
+{
+    blocked_column_multi_reduction<1>(
+        num_rows, num_cols,
+        [&op](size_type row, size_type col, ValueType *sums) {
+            sums[0] += op(row, col);
+        },
+        result, workspace);
+}
+
+
+/**
+ * @internal
+ *
+ * Computes the column-wise sums `result[j] = sum_i op(i, j)` for all
+ * `0 <= i < num_rows` and `0 <= j < num_cols`, allocating the partial
+ * results on `exec`.
+ *
+ * @see blocked_column_multi_reduction
+ *
+ * @param exec  the executor used to allocate the partial results
+ * @param num_rows  number of rows to reduce over
+ * @param num_cols  number of independent reductions
+ * @param op  the operation computing the contribution of entry (i, j)
+ * @param result  output array of size `num_cols`
+ */
+template <typename ValueType, typename Operation>
+void blocked_column_reduction(std::shared_ptr<const OmpExecutor> exec,
+                              size_type num_rows, size_type num_cols,
+                              Operation op, ValueType *result)
+{
+    Array<ValueType> workspace(exec);
+    blocked_column_reduction(num_rows, num_cols, op, result, workspace);
+}
+
+
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_COMPONENTS_REDUCTION_HPP_
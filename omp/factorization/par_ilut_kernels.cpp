@@ -0,0 +1,417 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/par_ilut_kernels.hpp"
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The parallel ILUT factorization namespace.
+ *
+ * @ingroup factor
+ */
+namespace par_ilut_factorization {
+
+
+/**
+ * Iterates over the union of the sparsity patterns of row `row` of `a`, `lu`
+ * and the factors `l` and `u` (without the unit diagonal of `l`) in ascending
+ * column order. For each column, `callback(col, a_val, lu_val, in_factor,
+ * factor_val)` is called, where missing entries are treated as zero.
+ */
+template <typename ValueType, typename IndexType, typename Callback>
+void merge_candidate_row(const matrix::Csr<ValueType, IndexType> *lu,
+                         const matrix::Csr<ValueType, IndexType> *a,
+                         const matrix::Csr<ValueType, IndexType> *l,
+                         const matrix::Csr<ValueType, IndexType> *u,
+                         size_type row, Callback callback)
+{
+    constexpr auto sentinel = std::numeric_limits<IndexType>::max();
+    const auto lu_row_ptrs = lu->get_const_row_ptrs();
+    const auto lu_col_idxs = lu->get_const_col_idxs();
+    const auto lu_vals = lu->get_const_values();
+    const auto a_row_ptrs = a->get_const_row_ptrs();
+    const auto a_col_idxs = a->get_const_col_idxs();
+    const auto a_vals = a->get_const_values();
+    const auto l_row_ptrs = l->get_const_row_ptrs();
+    const auto l_col_idxs = l->get_const_col_idxs();
+    const auto l_vals = l->get_const_values();
+    const auto u_row_ptrs = u->get_const_row_ptrs();
+    const auto u_col_idxs = u->get_const_col_idxs();
+    const auto u_vals = u->get_const_values();
+    auto lu_nz = lu_row_ptrs[row];
+    auto a_nz = a_row_ptrs[row];
+    auto l_nz = l_row_ptrs[row];
+    auto u_nz = u_row_ptrs[row];
+    const auto lu_end = lu_row_ptrs[row + 1];
+    const auto a_end = a_row_ptrs[row + 1];
+    // the diagonal of L is stored last and handled by the caller
+    const auto l_end = l_row_ptrs[row + 1] - 1;
+    const auto u_end = u_row_ptrs[row + 1];
+    while (true) {
+        const auto lu_col = lu_nz < lu_end ? lu_col_idxs[lu_nz] : sentinel;
+        const auto a_col = a_nz < a_end ? a_col_idxs[a_nz] : sentinel;
+        const auto factor_col =
+            l_nz < l_end ? l_col_idxs[l_nz]
+                         : (u_nz < u_end ? u_col_idxs[u_nz] : sentinel);
+        const auto col = std::min(std::min(lu_col, a_col), factor_col);
+        if (col == sentinel) {
+            break;
+        }
+        auto lu_val = zero<ValueType>();
+        auto a_val = zero<ValueType>();
+        auto factor_val = zero<ValueType>();
+        if (lu_col == col) {
+            lu_val = lu_vals[lu_nz++];
+        }
+        if (a_col == col) {
+            a_val = a_vals[a_nz++];
+        }
+        const auto in_factor = factor_col == col;
+        if (in_factor) {
+            factor_val = l_nz < l_end ? l_vals[l_nz++] : u_vals[u_nz++];
+        }
+        callback(static_cast<IndexType>(col), a_val, lu_val, in_factor,
+                 factor_val);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void add_candidates(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType> *lu,
+                    const matrix::Csr<ValueType, IndexType> *a,
+                    const matrix::Csr<ValueType, IndexType> *l,
+                    const matrix::Csr<ValueType, IndexType> *u,
+                    Array<IndexType> &l_new_row_ptrs_array,
+                    Array<IndexType> &l_new_col_idxs_array,
+                    Array<ValueType> &l_new_vals_array,
+                    Array<IndexType> &u_new_row_ptrs_array,
+                    Array<IndexType> &u_new_col_idxs_array,
+                    Array<ValueType> &u_new_vals_array)
+{
+    const auto num_rows = a->get_size()[0];
+    const auto u_row_ptrs = u->get_const_row_ptrs();
+    const auto u_vals = u->get_const_values();
+
+    // first sweep: count nnz for each row
+    l_new_row_ptrs_array.resize_and_reset(num_rows + 1);
+    u_new_row_ptrs_array.resize_and_reset(num_rows + 1);
+    auto l_new_row_ptrs = l_new_row_ptrs_array.get_data();
+    auto u_new_row_ptrs = u_new_row_ptrs_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        // the unit diagonal of L is not part of the merged pattern
+        IndexType l_nnz{1};
+        IndexType u_nnz{};
+        merge_candidate_row(lu, a, l, u, row,
+                            [&](IndexType col, ValueType, ValueType, bool,
+                                ValueType) {
+                                if (col < static_cast<IndexType>(row)) {
+                                    ++l_nnz;
+                                } else {
+                                    ++u_nnz;
+                                }
+                            });
+        l_new_row_ptrs[row + 1] = l_nnz;
+        u_new_row_ptrs[row + 1] = u_nnz;
+    }
+
+    // build row pointers: exclusive scan (thus the + 1)
+    l_new_row_ptrs[0] = 0;
+    u_new_row_ptrs[0] = 0;
+    std::partial_sum(l_new_row_ptrs + 1, l_new_row_ptrs + num_rows + 1,
+                     l_new_row_ptrs + 1);
+    std::partial_sum(u_new_row_ptrs + 1, u_new_row_ptrs + num_rows + 1,
+                     u_new_row_ptrs + 1);
+
+    // second sweep: keep existing entries, compute new ones from A - LU
+    l_new_col_idxs_array.resize_and_reset(l_new_row_ptrs[num_rows]);
+    l_new_vals_array.resize_and_reset(l_new_row_ptrs[num_rows]);
+    u_new_col_idxs_array.resize_and_reset(u_new_row_ptrs[num_rows]);
+    u_new_vals_array.resize_and_reset(u_new_row_ptrs[num_rows]);
+    auto l_new_col_idxs = l_new_col_idxs_array.get_data();
+    auto l_new_vals = l_new_vals_array.get_data();
+    auto u_new_col_idxs = u_new_col_idxs_array.get_data();
+    auto u_new_vals = u_new_vals_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        auto l_new_nz = l_new_row_ptrs[row];
+        auto u_new_nz = u_new_row_ptrs[row];
+        merge_candidate_row(
+            lu, a, l, u, row,
+            [&](IndexType col, ValueType a_val, ValueType lu_val,
+                bool in_factor, ValueType factor_val) {
+                const auto r_val = a_val - lu_val;
+                if (col < static_cast<IndexType>(row)) {
+                    const auto u_diag = u_vals[u_row_ptrs[col]];
+                    l_new_col_idxs[l_new_nz] = col;
+                    l_new_vals[l_new_nz] =
+                        in_factor ? factor_val : r_val / u_diag;
+                    ++l_new_nz;
+                } else {
+                    u_new_col_idxs[u_new_nz] = col;
+                    u_new_vals[u_new_nz] = in_factor ? factor_val : r_val;
+                    ++u_new_nz;
+                }
+            });
+        l_new_col_idxs[l_new_nz] = row;
+        l_new_vals[l_new_nz] = one<ValueType>();
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_ADD_CANDIDATES_KERNEL);
+
+
+/**
+ * Returns the entry (row, col) of the sorted Csr matrix `a`, or zero if it is
+ * not stored.
+ */
+template <typename ValueType, typename IndexType>
+ValueType find_value(const matrix::Csr<ValueType, IndexType> *a,
+                     IndexType row, IndexType col)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto begin = col_idxs + row_ptrs[row];
+    const auto end = col_idxs + row_ptrs[row + 1];
+    const auto it = std::lower_bound(begin, end, col);
+    return it != end && *it == col ? a->get_const_values()[it - col_idxs]
+                                   : zero<ValueType>();
+}
+
+
+/**
+ * Computes a(row, col) - sum_{k < min(row, col)} l(row, k) * u(k, col), using
+ * the CSC representation `u_csc` of U.
+ */
+template <typename ValueType, typename IndexType>
+ValueType compute_residual(const matrix::Csr<ValueType, IndexType> *a,
+                           const matrix::Csr<ValueType, IndexType> *l,
+                           const matrix::Csr<ValueType, IndexType> *u_csc,
+                           IndexType row, IndexType col)
+{
+    const auto l_row_ptrs = l->get_const_row_ptrs();
+    const auto l_col_idxs = l->get_const_col_idxs();
+    const auto l_vals = l->get_const_values();
+    const auto u_col_ptrs = u_csc->get_const_row_ptrs();
+    const auto u_row_idxs = u_csc->get_const_col_idxs();
+    const auto u_vals = u_csc->get_const_values();
+    const auto last = std::min(row, col);
+    auto sum = find_value(a, row, col);
+    auto l_nz = l_row_ptrs[row];
+    auto u_nz = u_col_ptrs[col];
+    const auto l_end = l_row_ptrs[row + 1];
+    const auto u_end = u_col_ptrs[col + 1];
+    while (l_nz < l_end && u_nz < u_end) {
+        const auto l_col = l_col_idxs[l_nz];
+        const auto u_row = u_row_idxs[u_nz];
+        if (l_col >= last || u_row >= last) {
+            break;
+        }
+        if (l_col == u_row) {
+            sum -= l_vals[l_nz] * u_vals[u_nz];
+        }
+        l_nz += l_col <= u_row;
+        u_nz += u_row <= l_col;
+    }
+    return sum;
+}
+
+
+template <typename ValueType, typename IndexType>
+void compute_l_u_factors(std::shared_ptr<const OmpExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType> *a,
+                         matrix::Csr<ValueType, IndexType> *l,
+                         matrix::Csr<ValueType, IndexType> *u,
+                         matrix::Csr<ValueType, IndexType> *u_csc)
+{
+    const auto num_rows = static_cast<IndexType>(a->get_size()[0]);
+    const auto l_row_ptrs = l->get_const_row_ptrs();
+    const auto l_col_idxs = l->get_const_col_idxs();
+    auto l_vals = l->get_values();
+    const auto u_row_ptrs = u->get_const_row_ptrs();
+    const auto u_col_idxs = u->get_const_col_idxs();
+    auto u_vals = u->get_values();
+    const auto u_csc_col_ptrs = u_csc->get_const_row_ptrs();
+    const auto u_csc_row_idxs = u_csc->get_const_col_idxs();
+    auto u_csc_vals = u_csc->get_values();
+    // all rows of the factors are updated in parallel, so the sweep reads
+    // partially updated values as in ParILU
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        // the diagonal of L is stored last and always one
+        for (auto l_nz = l_row_ptrs[row]; l_nz < l_row_ptrs[row + 1] - 1;
+             ++l_nz) {
+            const auto col = l_col_idxs[l_nz];
+            // the diagonal of U is stored last in each column of U^T
+            const auto u_diag = u_csc_vals[u_csc_col_ptrs[col + 1] - 1];
+            const auto to_write =
+                compute_residual(a, l, u_csc, row, col) / u_diag;
+            if (isfinite(to_write)) {
+                l_vals[l_nz] = to_write;
+            }
+        }
+        for (auto u_nz = u_row_ptrs[row]; u_nz < u_row_ptrs[row + 1];
+             ++u_nz) {
+            const auto col = u_col_idxs[u_nz];
+            const auto to_write = compute_residual(a, l, u_csc, row, col);
+            if (isfinite(to_write)) {
+                u_vals[u_nz] = to_write;
+                // keep the CSC copy of U consistent
+                const auto begin = u_csc_row_idxs + u_csc_col_ptrs[col];
+                const auto end = u_csc_row_idxs + u_csc_col_ptrs[col + 1];
+                const auto it = std::lower_bound(begin, end, row);
+                u_csc_vals[it - u_csc_row_idxs] = to_write;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_COMPUTE_L_U_FACTORS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void threshold_select(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *m,
+                      IndexType rank, Array<ValueType> &tmp,
+                      remove_complex<ValueType> &threshold)
+{
+    const auto nnz = m->get_num_stored_elements();
+    const auto vals = m->get_const_values();
+    tmp.resize_and_reset(nnz);
+    auto begin = tmp.get_data();
+#pragma omp parallel for
+    for (size_type nz = 0; nz < nnz; ++nz) {
+        begin[nz] = vals[nz];
+    }
+    auto target = begin + rank;
+    std::nth_element(begin, target, begin + nnz,
+                     [](ValueType a, ValueType b) { return abs(a) < abs(b); });
+    threshold = abs(*target);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_THRESHOLD_SELECT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void threshold_filter(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *a,
+                      const matrix::Csr<ValueType, IndexType> *m,
+                      remove_complex<ValueType> threshold,
+                      remove_complex<ValueType> drop_tolerance,
+                      Array<IndexType> &new_row_ptrs_array,
+                      Array<IndexType> &new_col_idxs_array,
+                      Array<ValueType> &new_vals_array)
+{
+    const auto num_rows = a->get_size()[0];
+    const auto a_row_ptrs = a->get_const_row_ptrs();
+    const auto a_vals = a->get_const_values();
+    const auto row_ptrs = m->get_const_row_ptrs();
+    const auto col_idxs = m->get_const_col_idxs();
+    const auto vals = m->get_const_values();
+    auto keep = [&](size_type row, IndexType nz,
+                    remove_complex<ValueType> row_threshold) {
+        const auto magnitude = abs(vals[nz]);
+        return static_cast<size_type>(col_idxs[nz]) == row ||
+               (magnitude >= threshold && magnitude >= row_threshold);
+    };
+    auto get_row_threshold = [&](size_type row) {
+        remove_complex<ValueType> norm{};
+        for (auto nz = a_row_ptrs[row]; nz < a_row_ptrs[row + 1]; ++nz) {
+            norm += squared_norm(a_vals[nz]);
+        }
+        return drop_tolerance * std::sqrt(norm);
+    };
+
+    // first sweep: count nnz for each row
+    new_row_ptrs_array.resize_and_reset(num_rows + 1);
+    auto new_row_ptrs = new_row_ptrs_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto row_threshold = get_row_threshold(row);
+        IndexType count{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            count += keep(row, nz, row_threshold);
+        }
+        new_row_ptrs[row + 1] = count;
+    }
+
+    // build row pointers: exclusive scan (thus the + 1)
+    new_row_ptrs[0] = 0;
+    std::partial_sum(new_row_ptrs + 1, new_row_ptrs + num_rows + 1,
+                     new_row_ptrs + 1);
+
+    // second sweep: copy the remaining entries
+    new_col_idxs_array.resize_and_reset(new_row_ptrs[num_rows]);
+    new_vals_array.resize_and_reset(new_row_ptrs[num_rows]);
+    auto new_col_idxs = new_col_idxs_array.get_data();
+    auto new_vals = new_vals_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto row_threshold = get_row_threshold(row);
+        auto new_nz = new_row_ptrs[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            if (keep(row, nz, row_threshold)) {
+                new_col_idxs[new_nz] = col_idxs[nz];
+                new_vals[new_nz] = vals[nz];
+                ++new_nz;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_KERNEL);
+
+
+}  // namespace par_ilut_factorization
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
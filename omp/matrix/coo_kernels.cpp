@@ -33,9 +33,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/coo_kernels.hpp"
 
 
+#include <algorithm>
+
+
 #include <omp.h>
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
@@ -98,22 +102,88 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_COO_ADVANCED_SPMV_KERNEL);
 
 
+namespace {
+
+
+/**
+ * @internal
+ *
+ * Computes `c += scale(A * b)` for a COO matrix `A` with row-sorted entries.
+ *
+ * The nonzeros are split into equally sized chunks, one per thread. Since
+ * the entries are sorted by row, only the first row of a chunk can be shared
+ * with a preceding chunk. Each chunk accumulates the contributions to its
+ * first row into a separate buffer and writes all other rows directly to `c`.
+ * The buffered contributions are added afterwards in chunk order, so no
+ * atomic operations are required and the result is deterministic.
+ */
+template <typename ValueType, typename IndexType, typename Scale>
+inline void spmv2_impl(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix::Coo<ValueType, IndexType> *a,
+                       const matrix::Dense<ValueType> *b,
+                       matrix::Dense<ValueType> *c, Scale scale)
+{
+    const auto coo_val = a->get_const_values();
+    const auto coo_col = a->get_const_col_idxs();
+    const auto coo_row = a->get_const_row_idxs();
+    const auto num_cols = b->get_size()[1];
+    const auto nnz = a->get_num_stored_elements();
+    if (nnz == 0 || num_cols == 0) {
+        return;
+    }
+    const size_type num_chunks =
+        std::min<size_type>(omp_get_max_threads(), nnz);
+    const size_type chunk_size = ceildiv(nnz, num_chunks);
+
+    Array<ValueType> first_row_sums_array(exec, num_chunks * num_cols);
+    Array<IndexType> first_rows_array(exec, num_chunks);
+    auto first_row_sums = first_row_sums_array.get_data();
+    auto first_rows = first_rows_array.get_data();
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto begin = std::min(chunk * chunk_size, nnz);
+        const auto end = std::min(begin + chunk_size, nnz);
+        auto partial = first_row_sums + chunk * num_cols;
+        std::fill_n(partial, num_cols, zero<ValueType>());
+        if (begin == end) {
+            first_rows[chunk] = 0;
+            continue;
+        }
+        const auto first_row = coo_row[begin];
+        first_rows[chunk] = first_row;
+        auto nz = begin;
+        for (; nz < end && coo_row[nz] == first_row; ++nz) {
+            for (size_type j = 0; j < num_cols; ++j) {
+                partial[j] += coo_val[nz] * b->at(coo_col[nz], j);
+            }
+        }
+        for (; nz < end; ++nz) {
+            const auto row = coo_row[nz];
+            for (size_type j = 0; j < num_cols; ++j) {
+                c->at(row, j) += scale(coo_val[nz] * b->at(coo_col[nz], j));
+            }
+        }
+    }
+
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto row = first_rows[chunk];
+        for (size_type j = 0; j < num_cols; ++j) {
+            c->at(row, j) += scale(first_row_sums[chunk * num_cols + j]);
+        }
+    }
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void spmv2(std::shared_ptr<const OmpExecutor> exec,
            const matrix::Coo<ValueType, IndexType> *a,
            const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *c)
 {
-    auto coo_val = a->get_const_values();
-    auto coo_col = a->get_const_col_idxs();
-    auto coo_row = a->get_const_row_idxs();
-    auto num_cols = b->get_size()[1];
-
-#pragma omp parallel for
-    for (size_type j = 0; j < num_cols; j++) {
-        for (size_type i = 0; i < a->get_num_stored_elements(); i++) {
-            c->at(coo_row[i], j) += coo_val[i] * b->at(coo_col[i], j);
-        }
-    }
+    spmv2_impl(exec, a, b, c, [](const ValueType &x) { return x; });
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_COO_SPMV2_KERNEL);
@@ -126,19 +196,9 @@ void advanced_spmv2(std::shared_ptr<const OmpExecutor> exec,
                     const matrix::Dense<ValueType> *b,
                     matrix::Dense<ValueType> *c)
 {
-    auto coo_val = a->get_const_values();
-    auto coo_col = a->get_const_col_idxs();
-    auto coo_row = a->get_const_row_idxs();
-    auto alpha_val = alpha->at(0, 0);
-    auto num_cols = b->get_size()[1];
-
-#pragma omp parallel for
-    for (size_type j = 0; j < num_cols; j++) {
-        for (size_type i = 0; i < a->get_num_stored_elements(); i++) {
-            c->at(coo_row[i], j) +=
-                alpha_val * coo_val[i] * b->at(coo_col[i], j);
-        }
-    }
+    const auto alpha_val = alpha->at(0, 0);
+    spmv2_impl(exec, a, b, c,
+               [&alpha_val](const ValueType &x) { return alpha_val * x; });
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
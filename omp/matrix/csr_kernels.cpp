@@ -36,8 +36,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <iostream>
 #include <numeric>
-#include <unordered_map>
-#include <unordered_set>
+#include <string>
 #include <utility>
 
 
@@ -49,7 +48,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
 #include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
 
 
 #include "core/base/iterator_factory.hpp"
@@ -67,31 +68,278 @@ namespace omp {
 namespace csr {
 
 
-template <typename ValueType, typename IndexType>
-void spmv(std::shared_ptr<const OmpExecutor> exec,
-          const matrix::Csr<ValueType, IndexType> *a,
-          const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *c)
+namespace {
+
+
+/**
+ * @internal
+ *
+ * Computes the rows `[row_begin, row_end)` of an SpMV. `init_row` is called
+ * once for each row before the contributions `scale(a_ij * b_jk)` are added.
+ */
+template <typename ValueType, typename IndexType, typename InitRow,
+          typename Scale>
+inline void spmv_rows(const matrix::Csr<ValueType, IndexType> *a,
+                      const matrix::Dense<ValueType> *b,
+                      matrix::Dense<ValueType> *c, size_type row_begin,
+                      size_type row_end, InitRow init_row, Scale scale)
 {
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    auto vals = a->get_const_values();
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_cols = c->get_size()[1];
+    for (auto row = row_begin; row < row_end; ++row) {
+        init_row(row);
+        for (size_type k = row_ptrs[row];
+             k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
+            const auto val = vals[k];
+            const auto col = col_idxs[k];
+            for (size_type j = 0; j < num_cols; ++j) {
+                c->at(row, j) += scale(val * b->at(col, j));
+            }
+        }
+    }
+}
 
+
+/**
+ * @internal
+ *
+ * Row-parallel SpMV with a static schedule, used by the `classical` and the
+ * library strategies.
+ */
+template <typename ValueType, typename IndexType, typename InitRow,
+          typename Scale>
+inline void classical_spmv(const matrix::Csr<ValueType, IndexType> *a,
+                           const matrix::Dense<ValueType> *b,
+                           matrix::Dense<ValueType> *c, InitRow init_row,
+                           Scale scale)
+{
 #pragma omp parallel for
     for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            c->at(row, j) = zero<ValueType>();
+        spmv_rows(a, b, c, row, row + 1, init_row, scale);
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * SpMV used by the `load_balance` strategy: the rows are split into one
+ * contiguous block per thread, such that each block contains about the same
+ * number of nonzeros.
+ */
+template <typename ValueType, typename IndexType, typename InitRow,
+          typename Scale>
+inline void load_balance_spmv(const matrix::Csr<ValueType, IndexType> *a,
+                              const matrix::Dense<ValueType> *b,
+                              matrix::Dense<ValueType> *c, InitRow init_row,
+                              Scale scale)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto num_rows = a->get_size()[0];
+    const auto nnz = static_cast<size_type>(row_ptrs[num_rows]);
+    const size_type num_blocks = omp_get_max_threads();
+    const size_type nnz_per_block = ceildiv(nnz, num_blocks);
+    const auto first_row_with_nnz = [&](size_type nz) {
+        const auto it = std::lower_bound(row_ptrs, row_ptrs + num_rows,
+                                         static_cast<IndexType>(nz));
+        return static_cast<size_type>(std::distance(row_ptrs, it));
+    };
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_type block = 0; block < num_blocks; ++block) {
+        const auto row_begin =
+            block == 0 ? 0 : first_row_with_nnz(block * nnz_per_block);
+        const auto row_end = block == num_blocks - 1
+                                 ? num_rows
+                                 : first_row_with_nnz((block + 1) *
+                                                      nnz_per_block);
+        spmv_rows(a, b, c, row_begin, row_end, init_row, scale);
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Finds the coordinates (row, nonzero) where the merge path of the row end
+ * offsets and the nonzero indices crosses the given diagonal.
+ */
+template <typename IndexType>
+inline std::pair<size_type, size_type> merge_path_search(
+    const IndexType *row_end_ptrs, size_type num_rows, size_type nnz,
+    size_type diagonal)
+{
+    size_type row_min = diagonal > nnz ? diagonal - nnz : 0;
+    size_type row_max = std::min(diagonal, num_rows);
+    while (row_min < row_max) {
+        const auto pivot = row_min + (row_max - row_min) / 2;
+        if (static_cast<size_type>(row_end_ptrs[pivot]) + pivot + 1 <=
+            diagonal) {
+            row_min = pivot + 1;
+        } else {
+            row_max = pivot;
         }
-        for (size_type k = row_ptrs[row];
-             k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-            auto val = vals[k];
-            auto col = col_idxs[k];
-            for (size_type j = 0; j < c->get_size()[1]; ++j) {
-                c->at(row, j) += val * b->at(col, j);
+    }
+    return {row_min, diagonal - row_min};
+}
+
+
+/**
+ * @internal
+ *
+ * SpMV used by the `merge_path` strategy (Merrill and Garland: Merge-Based
+ * Parallel Sparse Matrix-Vector Multiplication).
+ *
+ * Each thread processes an equal share of the combined sequence of rows and
+ * nonzeros, so long rows are split between several threads. The partial sum
+ * of the last (incomplete) row of each thread is carried out and added after
+ * the parallel region in thread order.
+ */
+template <typename ValueType, typename IndexType, typename InitRow,
+          typename Scale>
+inline void merge_path_spmv(std::shared_ptr<const OmpExecutor> exec,
+                            const matrix::Csr<ValueType, IndexType> *a,
+                            const matrix::Dense<ValueType> *b,
+                            matrix::Dense<ValueType> *c, InitRow init_row,
+                            Scale scale)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rows = a->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto nnz = static_cast<size_type>(row_ptrs[num_rows]);
+    const size_type num_threads = omp_get_max_threads();
+    const size_type items_per_thread = ceildiv(num_rows + nnz, num_threads);
+
+    Array<ValueType> carry_vals_array(exec, num_threads * num_cols);
+    Array<size_type> carry_rows_array(exec, num_threads);
+    auto carry_vals = carry_vals_array.get_data();
+    auto carry_rows = carry_rows_array.get_data();
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_type tid = 0; tid < num_threads; ++tid) {
+        const auto start_diagonal =
+            std::min(tid * items_per_thread, num_rows + nnz);
+        const auto end_diagonal =
+            std::min(start_diagonal + items_per_thread, num_rows + nnz);
+        const auto start =
+            merge_path_search(row_ptrs + 1, num_rows, nnz, start_diagonal);
+        const auto end =
+            merge_path_search(row_ptrs + 1, num_rows, nnz, end_diagonal);
+        auto row = start.first;
+        auto nz = start.second;
+        for (; row < end.first; ++row) {
+            init_row(row);
+            for (; nz < static_cast<size_type>(row_ptrs[row + 1]); ++nz) {
+                const auto val = vals[nz];
+                const auto col = col_idxs[nz];
+                for (size_type j = 0; j < num_cols; ++j) {
+                    c->at(row, j) += scale(val * b->at(col, j));
+                }
+            }
+        }
+        auto carry = carry_vals + tid * num_cols;
+        std::fill_n(carry, num_cols, zero<ValueType>());
+        for (; nz < end.second; ++nz) {
+            const auto val = vals[nz];
+            const auto col = col_idxs[nz];
+            for (size_type j = 0; j < num_cols; ++j) {
+                carry[j] += val * b->at(col, j);
+            }
+        }
+        carry_rows[tid] = end.first;
+    }
+
+    for (size_type tid = 0; tid < num_threads; ++tid) {
+        const auto row = carry_rows[tid];
+        if (row < num_rows) {
+            for (size_type j = 0; j < num_cols; ++j) {
+                c->at(row, j) += scale(carry_vals[tid * num_cols + j]);
             }
         }
     }
 }
 
+
+/**
+ * @internal
+ *
+ * Resolves the `automatical` strategy from the row-length statistics the
+ * strategy collected when it processed the matrix: if a single row holds more
+ * than a thread's share of the nonzeros, rows need to be split (merge_path),
+ * if the row lengths are very uneven, the rows are distributed by their
+ * number of nonzeros (load_balance). Otherwise, a static row distribution is
+ * used (classical).
+ */
+template <typename ValueType, typename IndexType>
+inline std::string select_spmv_strategy(
+    const matrix::Csr<ValueType, IndexType> *a)
+{
+    using Csr = matrix::Csr<ValueType, IndexType>;
+    auto strategy = a->get_strategy();
+    auto automatic =
+        std::dynamic_pointer_cast<typename Csr::automatical>(strategy);
+    if (!automatic) {
+        return strategy->get_name();
+    }
+    const size_type num_threads = omp_get_max_threads();
+    const auto num_rows = a->get_size()[0];
+    const auto nnz = a->get_num_stored_elements();
+    const auto max_row_length =
+        static_cast<size_type>(automatic->get_max_length_per_row());
+    // maximal ratio between the longest and the average row length for which
+    // a static row distribution is still considered balanced
+    constexpr size_type max_row_length_ratio = 4;
+    if (num_threads == 1 || num_rows == 0) {
+        return "classical";
+    } else if (max_row_length > ceildiv(nnz, num_threads)) {
+        return "merge_path";
+    } else if (max_row_length > max_row_length_ratio * ceildiv(nnz, num_rows)) {
+        return "load_balance";
+    }
+    return "classical";
+}
+
+
+template <typename ValueType, typename IndexType, typename InitRow,
+          typename Scale>
+inline void spmv_dispatch(std::shared_ptr<const OmpExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType> *a,
+                          const matrix::Dense<ValueType> *b,
+                          matrix::Dense<ValueType> *c, InitRow init_row,
+                          Scale scale)
+{
+    const auto strategy = select_spmv_strategy(a);
+    if (strategy == "merge_path") {
+        merge_path_spmv(exec, a, b, c, init_row, scale);
+    } else if (strategy == "load_balance") {
+        load_balance_spmv(a, b, c, init_row, scale);
+    } else {
+        classical_spmv(a, b, c, init_row, scale);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Csr<ValueType, IndexType> *a,
+          const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *c)
+{
+    spmv_dispatch(exec, a, b, c,
+                  [c](size_type row) {
+                      for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                          c->at(row, j) = zero<ValueType>();
+                      }
+                  },
+                  [](const ValueType &x) { return x; });
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPMV_KERNEL);
 
 
@@ -103,154 +351,309 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
                    const matrix::Dense<ValueType> *beta,
                    matrix::Dense<ValueType> *c)
 {
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    auto vals = a->get_const_values();
-    auto valpha = alpha->at(0, 0);
-    auto vbeta = beta->at(0, 0);
-
-#pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            c->at(row, j) *= vbeta;
-        }
-        for (size_type k = row_ptrs[row];
-             k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-            auto val = vals[k];
-            auto col = col_idxs[k];
-            for (size_type j = 0; j < c->get_size()[1]; ++j) {
-                c->at(row, j) += valpha * val * b->at(col, j);
-            }
-        }
-    }
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_dispatch(exec, a, b, c,
+                  [c, vbeta](size_type row) {
+                      for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                          c->at(row, j) *= vbeta;
+                      }
+                  },
+                  [valpha](const ValueType &x) { return valpha * x; });
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL);
 
 
-template <typename ValueType, typename IndexType>
-void spgemm_insert_row(std::unordered_set<IndexType> &cols,
-                       const matrix::Csr<ValueType, IndexType> *c,
-                       size_type row)
-{
-    auto row_ptrs = c->get_const_row_ptrs();
-    auto col_idxs = c->get_const_col_idxs();
-    cols.insert(col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1]);
-}
+namespace {
 
 
-template <typename ValueType, typename IndexType>
-void spgemm_insert_row2(std::unordered_set<IndexType> &cols,
-                        const matrix::Csr<ValueType, IndexType> *a,
-                        const matrix::Csr<ValueType, IndexType> *b,
-                        size_type row)
+// Rows of the product with at most this many contributing terms are
+// accumulated by sorting them, longer rows use a dense accumulator.
+constexpr size_type spgemm_sorted_accumulator_limit = 64;
+
+
+/**
+ * @internal
+ *
+ * Calls `callback(col, value)` for each term contributing to row `row` of
+ * `beta * d + alpha * a * b`. The terms of `d` are skipped if `d` is `nullptr`
+ * or beta is zero, the terms of `a * b` are skipped if alpha is zero.
+ */
+template <typename ValueType, typename IndexType, typename Callback>
+inline void spgemm_for_each_term(const matrix::Csr<ValueType, IndexType> *a,
+                                 const matrix::Csr<ValueType, IndexType> *b,
+                                 ValueType alpha,
+                                 const matrix::Csr<ValueType, IndexType> *d,
+                                 ValueType beta, size_type row,
+                                 Callback callback)
 {
-    auto a_row_ptrs = a->get_const_row_ptrs();
-    auto a_col_idxs = a->get_const_col_idxs();
-    auto b_row_ptrs = b->get_const_row_ptrs();
-    auto b_col_idxs = b->get_const_col_idxs();
-    for (size_type a_nz = a_row_ptrs[row];
-         a_nz < size_type(a_row_ptrs[row + 1]); ++a_nz) {
-        auto a_col = a_col_idxs[a_nz];
-        auto b_row = a_col;
-        cols.insert(b_col_idxs + b_row_ptrs[b_row],
-                    b_col_idxs + b_row_ptrs[b_row + 1]);
+    if (d != nullptr && beta != zero(beta)) {
+        auto d_row_ptrs = d->get_const_row_ptrs();
+        auto d_col_idxs = d->get_const_col_idxs();
+        auto d_vals = d->get_const_values();
+        for (auto d_nz = d_row_ptrs[row]; d_nz < d_row_ptrs[row + 1]; ++d_nz) {
+            callback(d_col_idxs[d_nz], beta * d_vals[d_nz]);
+        }
+    }
+    if (alpha != zero(alpha)) {
+        auto a_row_ptrs = a->get_const_row_ptrs();
+        auto a_col_idxs = a->get_const_col_idxs();
+        auto a_vals = a->get_const_values();
+        auto b_row_ptrs = b->get_const_row_ptrs();
+        auto b_col_idxs = b->get_const_col_idxs();
+        auto b_vals = b->get_const_values();
+        for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+            const auto b_row = a_col_idxs[a_nz];
+            const auto a_val = alpha * a_vals[a_nz];
+            for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+                 ++b_nz) {
+                callback(b_col_idxs[b_nz], a_val * b_vals[b_nz]);
+            }
+        }
     }
 }
 
 
 template <typename ValueType, typename IndexType>
-void spgemm_accumulate_row(std::unordered_map<IndexType, ValueType> &cols,
-                           const matrix::Csr<ValueType, IndexType> *c,
-                           ValueType scale, size_type row)
+inline size_type spgemm_count_terms(const matrix::Csr<ValueType, IndexType> *a,
+                                    const matrix::Csr<ValueType, IndexType> *b,
+                                    ValueType alpha,
+                                    const matrix::Csr<ValueType, IndexType> *d,
+                                    ValueType beta, size_type row)
 {
-    auto row_ptrs = c->get_const_row_ptrs();
-    auto col_idxs = c->get_const_col_idxs();
-    auto vals = c->get_const_values();
-    for (size_type c_nz = row_ptrs[row]; c_nz < size_type(row_ptrs[row + 1]);
-         ++c_nz) {
-        auto c_col = col_idxs[c_nz];
-        auto c_val = vals[c_nz];
-        cols[c_col] += scale * c_val;
+    size_type num_terms{};
+    if (d != nullptr && beta != zero(beta)) {
+        num_terms += d->get_const_row_ptrs()[row + 1] -
+                     d->get_const_row_ptrs()[row];
     }
+    if (alpha != zero(alpha)) {
+        auto a_row_ptrs = a->get_const_row_ptrs();
+        auto a_col_idxs = a->get_const_col_idxs();
+        auto b_row_ptrs = b->get_const_row_ptrs();
+        for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+            const auto b_row = a_col_idxs[a_nz];
+            num_terms += b_row_ptrs[b_row + 1] - b_row_ptrs[b_row];
+        }
+    }
+    return num_terms;
 }
 
 
+/**
+ * @internal
+ *
+ * Computes the number of nonzeros in row `row` of the product. If `out` is
+ * not `nullptr`, their column indices are also written to it in ascending
+ * order.
+ *
+ * Short rows are collected in `sorted_accumulator` (of size
+ * `spgemm_sorted_accumulator_limit`) and deduplicated by sorting. Long rows
+ * use `dense_accumulator`, which holds one entry per column of the product and
+ * marks the columns already seen in this row by the row index. It is only
+ * allocated once the first long row is encountered, so products without long
+ * rows never touch `num_cols` entries per thread.
+ */
 template <typename ValueType, typename IndexType>
-void spgemm_accumulate_row2(std::unordered_map<IndexType, ValueType> &cols,
-                            const matrix::Csr<ValueType, IndexType> *a,
-                            const matrix::Csr<ValueType, IndexType> *b,
-                            ValueType scale, size_type row)
-{
-    auto a_row_ptrs = a->get_const_row_ptrs();
-    auto a_col_idxs = a->get_const_col_idxs();
-    auto a_vals = a->get_const_values();
-    auto b_row_ptrs = b->get_const_row_ptrs();
-    auto b_col_idxs = b->get_const_col_idxs();
-    auto b_vals = b->get_const_values();
-    for (size_type a_nz = a_row_ptrs[row];
-         a_nz < size_type(a_row_ptrs[row + 1]); ++a_nz) {
-        auto a_col = a_col_idxs[a_nz];
-        auto a_val = a_vals[a_nz];
-        auto b_row = a_col;
-        for (size_type b_nz = b_row_ptrs[b_row];
-             b_nz < size_type(b_row_ptrs[b_row + 1]); ++b_nz) {
-            auto b_col = b_col_idxs[b_nz];
-            auto b_val = b_vals[b_nz];
-            cols[b_col] += scale * a_val * b_val;
+inline size_type spgemm_row_pattern(const matrix::Csr<ValueType, IndexType> *a,
+                                    const matrix::Csr<ValueType, IndexType> *b,
+                                    ValueType alpha,
+                                    const matrix::Csr<ValueType, IndexType> *d,
+                                    ValueType beta, size_type row,
+                                    Array<IndexType> &dense_accumulator,
+                                    IndexType *sorted_accumulator,
+                                    IndexType *out)
+{
+    size_type count{};
+    if (spgemm_count_terms(a, b, alpha, d, beta, row) <=
+        spgemm_sorted_accumulator_limit) {
+        auto end = sorted_accumulator;
+        spgemm_for_each_term(a, b, alpha, d, beta, row,
+                             [&](IndexType col, ValueType) { *end++ = col; });
+        std::sort(sorted_accumulator, end);
+        end = std::unique(sorted_accumulator, end);
+        count = end - sorted_accumulator;
+        if (out != nullptr) {
+            std::copy(sorted_accumulator, end, out);
+        }
+    } else {
+        const auto num_cols = b->get_size()[1];
+        if (dense_accumulator.get_num_elems() != num_cols) {
+            dense_accumulator.resize_and_reset(num_cols);
+            std::fill_n(dense_accumulator.get_data(), num_cols,
+                        -one<IndexType>());
+        }
+        const auto marker = static_cast<IndexType>(row);
+        auto dense = dense_accumulator.get_data();
+        spgemm_for_each_term(a, b, alpha, d, beta, row,
+                             [&](IndexType col, ValueType) {
+                                 if (dense[col] != marker) {
+                                     dense[col] = marker;
+                                     if (out != nullptr) {
+                                         out[count] = col;
+                                     }
+                                     ++count;
+                                 }
+                             });
+        if (out != nullptr) {
+            std::sort(out, out + count);
         }
     }
+    return count;
 }
 
 
+/**
+ * @internal
+ *
+ * Computes the sparsity pattern of `beta * d + alpha * a * b` with column
+ * indices sorted in each row.
+ */
 template <typename ValueType, typename IndexType>
-void spgemm(std::shared_ptr<const OmpExecutor> exec,
-            const matrix::Csr<ValueType, IndexType> *a,
-            const matrix::Csr<ValueType, IndexType> *b,
-            Array<IndexType> &c_row_ptrs_array,
-            Array<IndexType> &c_col_idxs_array, Array<ValueType> &c_vals_array)
+void spgemm_symbolic(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType> *a,
+                     const matrix::Csr<ValueType, IndexType> *b,
+                     ValueType alpha,
+                     const matrix::Csr<ValueType, IndexType> *d,
+                     ValueType beta, Array<IndexType> &c_row_ptrs_array,
+                     Array<IndexType> &c_col_idxs_array)
 {
-    auto num_rows = a->get_size()[0];
-
-    // first sweep: count nnz for each row
+    const auto num_rows = a->get_size()[0];
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    Array<IndexType> sorted_accumulators(
+        exec, num_threads * spgemm_sorted_accumulator_limit);
     c_row_ptrs_array.resize_and_reset(num_rows + 1);
     auto c_row_ptrs = c_row_ptrs_array.get_data();
 
-    std::unordered_set<IndexType> local_col_idxs;
-#pragma omp parallel for firstprivate(local_col_idxs)
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        local_col_idxs.clear();
-        spgemm_insert_row2(local_col_idxs, a, b, a_row);
-        c_row_ptrs[a_row + 1] = local_col_idxs.size();
+    // first sweep: count nnz for each row
+#pragma omp parallel
+    {
+        const auto thread_id = static_cast<size_type>(omp_get_thread_num());
+        Array<IndexType> dense(exec);
+        auto sorted = sorted_accumulators.get_data() +
+                      thread_id * spgemm_sorted_accumulator_limit;
+#pragma omp for schedule(dynamic, 32)
+        for (size_type row = 0; row < num_rows; ++row) {
+            c_row_ptrs[row + 1] = spgemm_row_pattern<ValueType, IndexType>(
+                a, b, alpha, d, beta, row, dense, sorted, nullptr);
+        }
     }
 
     // build row pointers: exclusive scan (thus the + 1)
     c_row_ptrs[0] = 0;
     std::partial_sum(c_row_ptrs + 1, c_row_ptrs + num_rows + 1, c_row_ptrs + 1);
 
-    // second sweep: accumulate non-zeros
-    auto new_nnz = c_row_ptrs[num_rows];
-    c_col_idxs_array.resize_and_reset(new_nnz);
-    c_vals_array.resize_and_reset(new_nnz);
+    // second sweep: write the sorted column indices
+    c_col_idxs_array.resize_and_reset(c_row_ptrs[num_rows]);
     auto c_col_idxs = c_col_idxs_array.get_data();
-    auto c_vals = c_vals_array.get_data();
-
-    std::unordered_map<IndexType, ValueType> local_row_nzs;
-#pragma omp parallel for firstprivate(local_row_nzs)
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        local_row_nzs.clear();
-        spgemm_accumulate_row2(local_row_nzs, a, b, one<ValueType>(), a_row);
-        // store result
-        auto c_nz = c_row_ptrs[a_row];
-        for (auto pair : local_row_nzs) {
-            c_col_idxs[c_nz] = pair.first;
-            c_vals[c_nz] = pair.second;
-            ++c_nz;
+#pragma omp parallel
+    {
+        const auto thread_id = static_cast<size_type>(omp_get_thread_num());
+        // rows may be assigned to different threads than in the first sweep,
+        // so the markers of the first sweep cannot be reused
+        Array<IndexType> dense(exec);
+        auto sorted = sorted_accumulators.get_data() +
+                      thread_id * spgemm_sorted_accumulator_limit;
+#pragma omp for schedule(dynamic, 32)
+        for (size_type row = 0; row < num_rows; ++row) {
+            spgemm_row_pattern<ValueType, IndexType>(
+                a, b, alpha, d, beta, row, dense, sorted,
+                c_col_idxs + c_row_ptrs[row]);
+        }
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes the values of `beta * d + alpha * a * b` for the sorted sparsity
+ * pattern given by `c_row_ptrs` and `c_col_idxs`. Terms outside of the
+ * pattern are dropped.
+ *
+ * Short rows look up the position of each term by binary search in the row
+ * of the pattern, long rows scatter the positions of the row into a dense
+ * array holding one entry per column of the product.
+ */
+template <typename ValueType, typename IndexType>
+void spgemm_numeric_impl(std::shared_ptr<const OmpExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType> *a,
+                         const matrix::Csr<ValueType, IndexType> *b,
+                         ValueType alpha,
+                         const matrix::Csr<ValueType, IndexType> *d,
+                         ValueType beta, const IndexType *c_row_ptrs,
+                         const IndexType *c_col_idxs, ValueType *c_vals)
+{
+    const auto num_rows = a->get_size()[0];
+    const auto num_cols = b->get_size()[1];
+
+#pragma omp parallel
+    {
+        // allocated on the first long row handled by this thread
+        Array<IndexType> positions_array(exec);
+#pragma omp for schedule(dynamic, 32)
+        for (size_type row = 0; row < num_rows; ++row) {
+            const auto begin = c_row_ptrs[row];
+            const auto end = c_row_ptrs[row + 1];
+            std::fill(c_vals + begin, c_vals + end, zero<ValueType>());
+            if (spgemm_count_terms(a, b, alpha, d, beta, row) <=
+                spgemm_sorted_accumulator_limit) {
+                spgemm_for_each_term(
+                    a, b, alpha, d, beta, row,
+                    [&](IndexType col, ValueType val) {
+                        auto it = std::lower_bound(c_col_idxs + begin,
+                                                   c_col_idxs + end, col);
+                        if (it != c_col_idxs + end && *it == col) {
+                            c_vals[it - c_col_idxs] += val;
+                        }
+                    });
+            } else {
+                if (positions_array.get_num_elems() != num_cols) {
+                    positions_array.resize_and_reset(num_cols);
+                    std::fill_n(positions_array.get_data(), num_cols,
+                                -one<IndexType>());
+                }
+                auto positions = positions_array.get_data();
+                for (auto nz = begin; nz < end; ++nz) {
+                    positions[c_col_idxs[nz]] = nz;
+                }
+                spgemm_for_each_term(a, b, alpha, d, beta, row,
+                                     [&](IndexType col, ValueType val) {
+                                         const auto nz = positions[col];
+                                         if (nz >= 0) {
+                                             c_vals[nz] += val;
+                                         }
+                                     });
+                for (auto nz = begin; nz < end; ++nz) {
+                    positions[c_col_idxs[nz]] = -1;
+                }
+            }
         }
     }
 }
 
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spgemm(std::shared_ptr<const OmpExecutor> exec,
+            const matrix::Csr<ValueType, IndexType> *a,
+            const matrix::Csr<ValueType, IndexType> *b,
+            Array<IndexType> &c_row_ptrs_array,
+            Array<IndexType> &c_col_idxs_array, Array<ValueType> &c_vals_array)
+{
+    spgemm_symbolic<ValueType, IndexType>(exec, a, b, one<ValueType>(),
+                                          nullptr, zero<ValueType>(),
+                                          c_row_ptrs_array, c_col_idxs_array);
+    c_vals_array.resize_and_reset(c_col_idxs_array.get_num_elems());
+    spgemm_numeric_impl<ValueType, IndexType>(
+        exec, a, b, one<ValueType>(), nullptr, zero<ValueType>(),
+        c_row_ptrs_array.get_const_data(), c_col_idxs_array.get_const_data(),
+        c_vals_array.get_data());
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_KERNEL);
 
 
@@ -265,60 +668,34 @@ void advanced_spgemm(std::shared_ptr<const OmpExecutor> exec,
                      Array<IndexType> &c_col_idxs_array,
                      Array<ValueType> &c_vals_array)
 {
-    auto num_rows = a->get_size()[0];
     auto valpha = alpha->at(0, 0);
     auto vbeta = beta->at(0, 0);
+    spgemm_symbolic(exec, a, b, valpha, d, vbeta, c_row_ptrs_array,
+                    c_col_idxs_array);
+    c_vals_array.resize_and_reset(c_col_idxs_array.get_num_elems());
+    spgemm_numeric_impl(exec, a, b, valpha, d, vbeta,
+                        c_row_ptrs_array.get_const_data(),
+                        c_col_idxs_array.get_const_data(),
+                        c_vals_array.get_data());
+}
 
-    // first sweep: count nnz for each row
-    c_row_ptrs_array.resize_and_reset(num_rows + 1);
-    auto c_row_ptrs = c_row_ptrs_array.get_data();
-
-    std::unordered_set<IndexType> local_col_idxs;
-#pragma omp parallel for firstprivate(local_col_idxs)
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        local_col_idxs.clear();
-        if (vbeta != zero(vbeta)) {
-            spgemm_insert_row(local_col_idxs, d, a_row);
-        }
-        if (valpha != zero(valpha)) {
-            spgemm_insert_row2(local_col_idxs, a, b, a_row);
-        }
-        c_row_ptrs[a_row + 1] = local_col_idxs.size();
-    }
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
 
-    // build row pointers: exclusive scan (thus the + 1)
-    c_row_ptrs[0] = 0;
-    std::partial_sum(c_row_ptrs + 1, c_row_ptrs + num_rows + 1, c_row_ptrs + 1);
 
-    // second sweep: accumulate non-zeros
-    auto new_nnz = c_row_ptrs[num_rows];
-    c_col_idxs_array.resize_and_reset(new_nnz);
-    c_vals_array.resize_and_reset(new_nnz);
-    auto c_col_idxs = c_col_idxs_array.get_data();
-    auto c_vals = c_vals_array.get_data();
-
-    std::unordered_map<IndexType, ValueType> local_row_nzs;
-#pragma omp parallel for firstprivate(local_row_nzs)
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        local_row_nzs.clear();
-        if (vbeta != zero(vbeta)) {
-            spgemm_accumulate_row(local_row_nzs, d, vbeta, a_row);
-        }
-        if (valpha != zero(valpha)) {
-            spgemm_accumulate_row2(local_row_nzs, a, b, valpha, a_row);
-        }
-        // store result
-        auto c_nz = c_row_ptrs[a_row];
-        for (auto pair : local_row_nzs) {
-            c_col_idxs[c_nz] = pair.first;
-            c_vals[c_nz] = pair.second;
-            ++c_nz;
-        }
-    }
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType> *a,
+                    const matrix::Csr<ValueType, IndexType> *b,
+                    matrix::Csr<ValueType, IndexType> *c)
+{
+    spgemm_numeric_impl<ValueType, IndexType>(
+        exec, a, b, one<ValueType>(), nullptr, zero<ValueType>(),
+        c->get_const_row_ptrs(), c->get_const_col_idxs(), c->get_values());
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
 
 
 template <typename IndexType>
@@ -379,7 +756,62 @@ template <typename ValueType, typename IndexType>
 void convert_to_sellp(std::shared_ptr<const OmpExecutor> exec,
                       matrix::Sellp<ValueType, IndexType> *result,
                       const matrix::Csr<ValueType, IndexType> *source)
-    GKO_NOT_IMPLEMENTED;
+{
+    const auto num_rows = result->get_size()[0];
+    auto vals = result->get_values();
+    auto col_idxs = result->get_col_idxs();
+    auto slice_lengths = result->get_slice_lengths();
+    auto slice_sets = result->get_slice_sets();
+    const auto slice_size = (result->get_slice_size() == 0)
+                                ? matrix::default_slice_size
+                                : result->get_slice_size();
+    const auto stride_factor = (result->get_stride_factor() == 0)
+                                   ? matrix::default_stride_factor
+                                   : result->get_stride_factor();
+
+    const auto source_row_ptrs = source->get_const_row_ptrs();
+    const auto source_col_idxs = source->get_const_col_idxs();
+    const auto source_values = source->get_const_values();
+
+    const size_type slice_num = ceildiv(num_rows, slice_size);
+#pragma omp parallel for
+    for (size_type slice = 0; slice < slice_num; slice++) {
+        const auto slice_end = std::min(num_rows, (slice + 1) * slice_size);
+        IndexType max_row_length = 0;
+        for (auto row = slice * slice_size; row < slice_end; row++) {
+            max_row_length =
+                std::max(max_row_length,
+                         source_row_ptrs[row + 1] - source_row_ptrs[row]);
+        }
+        slice_lengths[slice] =
+            stride_factor * ceildiv(max_row_length, stride_factor);
+    }
+
+    slice_sets[0] = 0;
+    std::partial_sum(slice_lengths, slice_lengths + slice_num, slice_sets + 1);
+
+#pragma omp parallel for
+    for (size_type slice = 0; slice < slice_num; slice++) {
+        for (size_type row = 0; row < slice_size; row++) {
+            const auto global_row = slice * slice_size + row;
+            if (global_row >= num_rows) {
+                break;
+            }
+            auto sellp_ind = slice_sets[slice] * slice_size + row;
+            for (auto csr_ind = source_row_ptrs[global_row];
+                 csr_ind < source_row_ptrs[global_row + 1]; csr_ind++) {
+                vals[sellp_ind] = source_values[csr_ind];
+                col_idxs[sellp_ind] = source_col_idxs[csr_ind];
+                sellp_ind += slice_size;
+            }
+            for (; sellp_ind < slice_sets[slice + 1] * slice_size;
+                 sellp_ind += slice_size) {
+                col_idxs[sellp_ind] = 0;
+                vals[sellp_ind] = zero<ValueType>();
+            }
+        }
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_CONVERT_TO_SELLP_KERNEL);
@@ -389,7 +821,27 @@ template <typename ValueType, typename IndexType>
 void convert_to_ell(std::shared_ptr<const OmpExecutor> exec,
                     matrix::Ell<ValueType, IndexType> *result,
                     const matrix::Csr<ValueType, IndexType> *source)
-    GKO_NOT_IMPLEMENTED;
+{
+    const auto num_rows = source->get_size()[0];
+    const auto vals = source->get_const_values();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto num_stored_elements_per_row =
+        result->get_num_stored_elements_per_row();
+
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        size_type i = 0;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++, i++) {
+            result->val_at(row, i) = vals[nz];
+            result->col_at(row, i) = col_idxs[nz];
+        }
+        for (; i < num_stored_elements_per_row; i++) {
+            result->val_at(row, i) = zero<ValueType>();
+            result->col_at(row, i) = 0;
+        }
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_CONVERT_TO_ELL_KERNEL);
@@ -467,7 +919,26 @@ template <typename ValueType, typename IndexType>
 void calculate_total_cols(std::shared_ptr<const OmpExecutor> exec,
                           const matrix::Csr<ValueType, IndexType> *source,
                           size_type *result, size_type stride_factor,
-                          size_type slice_size) GKO_NOT_IMPLEMENTED;
+                          size_type slice_size)
+{
+    const auto num_rows = source->get_size()[0];
+    const size_type slice_num = ceildiv(num_rows, slice_size);
+    const auto row_ptrs = source->get_const_row_ptrs();
+    size_type total_cols = 0;
+
+#pragma omp parallel for reduction(+ : total_cols)
+    for (size_type slice = 0; slice < slice_num; slice++) {
+        const auto slice_end = std::min(num_rows, (slice + 1) * slice_size);
+        IndexType max_row_length = 0;
+        for (auto row = slice * slice_size; row < slice_end; row++) {
+            max_row_length =
+                std::max(max_row_length, row_ptrs[row + 1] - row_ptrs[row]);
+        }
+        total_cols += ceildiv(max_row_length, stride_factor) * stride_factor;
+    }
+
+    *result = total_cols;
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_CALCULATE_TOTAL_COLS_KERNEL);
@@ -476,7 +947,19 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
 template <typename ValueType, typename IndexType>
 void calculate_max_nnz_per_row(std::shared_ptr<const OmpExecutor> exec,
                                const matrix::Csr<ValueType, IndexType> *source,
-                               size_type *result) GKO_NOT_IMPLEMENTED;
+                               size_type *result)
+{
+    const auto num_rows = source->get_size()[0];
+    const auto row_ptrs = source->get_const_row_ptrs();
+    IndexType max_nnz = 0;
+
+#pragma omp parallel for reduction(max : max_nnz)
+    for (size_type row = 0; row < num_rows; row++) {
+        max_nnz = std::max(row_ptrs[row + 1] - row_ptrs[row], max_nnz);
+    }
+
+    *result = max_nnz;
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_CALCULATE_MAX_NNZ_PER_ROW_KERNEL);
@@ -764,6 +1247,56 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_IS_SORTED_BY_COLUMN_INDEX);
 
 
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *orig,
+                      Array<ValueType> &diag)
+{
+    const auto row_ptrs = orig->get_const_row_ptrs();
+    const auto col_idxs = orig->get_const_col_idxs();
+    const auto values = orig->get_const_values();
+    const auto diag_size = diag.get_num_elems();
+    auto diag_values = diag.get_data();
+
+#pragma omp parallel for
+    for (size_type row = 0; row < diag_size; ++row) {
+        auto diag_value = zero<ValueType>();
+        for (auto idx = row_ptrs[row]; idx < row_ptrs[row + 1]; ++idx) {
+            if (col_idxs[idx] == static_cast<IndexType>(row)) {
+                diag_value = values[idx];
+                break;
+            }
+        }
+        diag_values[row] = diag_value;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
+
+
+template <typename ValueType, typename IndexType>
+void scatter_values(std::shared_ptr<const OmpExecutor> exec,
+                    const Array<ValueType> &values,
+                    const Array<IndexType> &positions,
+                    matrix::Csr<ValueType, IndexType> *mtx)
+{
+    const auto in_values = values.get_const_data();
+    const auto in_positions = positions.get_const_data();
+    const auto num_elems = values.get_num_elems();
+    auto out_values = mtx->get_values();
+
+#pragma omp parallel for
+    for (size_type i = 0; i < num_elems; ++i) {
+        if (in_positions[i] >= 0) {
+            out_values[in_positions[i]] = in_values[i];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SCATTER_VALUES_KERNEL);
+
+
 }  // namespace csr
 }  // namespace omp
 }  // namespace kernels
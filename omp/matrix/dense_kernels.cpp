@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <numeric>
 
 
 #include <omp.h>
@@ -50,6 +51,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
+#include "omp/base/blas_bindings.hpp"
+#include "omp/components/reduction.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -61,65 +66,267 @@ namespace omp {
 namespace dense {
 
 
+namespace {
+
+
+// Blocking parameters of the GEMM kernel: the micro-kernel computes a
+// `gemm_mr x gemm_nr` tile of C held in registers, the packed
+// `gemm_mc x gemm_kc` block of A is meant to stay in the L2 cache and the
+// packed `gemm_kc x gemm_nc` panel of B in the L3 cache.
+constexpr size_type gemm_mr = 4;
+constexpr size_type gemm_nr = 8;
+constexpr size_type gemm_mc = 64;
+constexpr size_type gemm_kc = 256;
+constexpr size_type gemm_nc = 1024;
+
+
+/**
+ * @internal
+ *
+ * Packs the `gemm_mc x gemm_kc` block of A starting at (`row`, `inner`) into
+ * strips of `gemm_mr` rows. Each strip stores its columns contiguously, rows
+ * beyond the end of A are padded with zeros.
+ */
 template <typename ValueType>
-void simple_apply(std::shared_ptr<const OmpExecutor> exec,
-                  const matrix::Dense<ValueType> *a,
-                  const matrix::Dense<ValueType> *b,
-                  matrix::Dense<ValueType> *c)
+inline void pack_a_block(const matrix::Dense<ValueType> *a, size_type row,
+                         size_type num_rows, size_type inner,
+                         size_type num_inner, ValueType *packed)
 {
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type col = 0; col < c->get_size()[1]; ++col) {
-            c->at(row, col) = zero<ValueType>();
+    for (size_type strip = 0; strip < num_rows; strip += gemm_mr) {
+        for (size_type k = 0; k < num_inner; ++k) {
+            for (size_type r = 0; r < gemm_mr; ++r) {
+                packed[r] = strip + r < num_rows
+                                ? a->at(row + strip + r, inner + k)
+                                : zero<ValueType>();
+            }
+            packed += gemm_mr;
         }
     }
+}
 
+
+/**
+ * @internal
+ *
+ * Packs the `gemm_kc x gemm_nc` panel of B starting at (`inner`, `col`) into
+ * strips of `gemm_nr` columns, padding columns beyond the end of B with zeros.
+ */
+template <typename ValueType>
+inline void pack_b_panel(const matrix::Dense<ValueType> *b, size_type inner,
+                         size_type num_inner, size_type col, size_type num_cols,
+                         ValueType *packed)
+{
+    const size_type num_strips = ceildiv(num_cols, gemm_nr);
 #pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) += a->at(row, inner) * b->at(inner, col);
+    for (size_type strip = 0; strip < num_strips; ++strip) {
+        auto packed_strip = packed + strip * gemm_nr * num_inner;
+        const auto strip_col = strip * gemm_nr;
+        for (size_type k = 0; k < num_inner; ++k) {
+            for (size_type c = 0; c < gemm_nr; ++c) {
+                packed_strip[k * gemm_nr + c] =
+                    strip_col + c < num_cols
+                        ? b->at(inner + k, col + strip_col + c)
+                        : zero<ValueType>();
             }
         }
     }
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_SIMPLE_APPLY_KERNEL);
+
+/**
+ * @internal
+ *
+ * Computes the `gemm_mr x gemm_nr` product of a packed strip of A and a packed
+ * strip of B and stores the valid part of it to C, either overwriting C
+ * (scaled by beta) on the first block of the inner dimension, or adding to it.
+ */
+template <typename ValueType>
+inline void gemm_micro_kernel(size_type num_inner, const ValueType *packed_a,
+                              const ValueType *packed_b, ValueType alpha,
+                              ValueType beta, bool first_block,
+                              size_type valid_rows, size_type valid_cols,
+                              ValueType *c, size_type c_stride)
+{
+    ValueType acc[gemm_mr][gemm_nr] = {};
+    for (size_type k = 0; k < num_inner; ++k) {
+        for (size_type r = 0; r < gemm_mr; ++r) {
+            const auto a_val = packed_a[k * gemm_mr + r];
+#pragma omp simd
+            for (size_type j = 0; j < gemm_nr; ++j) {
+                acc[r][j] += a_val * packed_b[k * gemm_nr + j];
+            }
+        }
+    }
+    for (size_type r = 0; r < valid_rows; ++r) {
+        auto c_row = c + r * c_stride;
+        if (!first_block) {
+            for (size_type j = 0; j < valid_cols; ++j) {
+                c_row[j] += alpha * acc[r][j];
+            }
+        } else if (beta == zero<ValueType>()) {
+            for (size_type j = 0; j < valid_cols; ++j) {
+                c_row[j] = alpha * acc[r][j];
+            }
+        } else {
+            for (size_type j = 0; j < valid_cols; ++j) {
+                c_row[j] = beta * c_row[j] + alpha * acc[r][j];
+            }
+        }
+    }
+}
 
 
+/**
+ * @internal
+ *
+ * Computes C = alpha * A * B + beta * C with a cache-blocked, register-tiled
+ * kernel working on packed copies of A and B. If beta is zero, C is
+ * overwritten without being read.
+ */
 template <typename ValueType>
-void apply(std::shared_ptr<const OmpExecutor> exec,
-           const matrix::Dense<ValueType> *alpha,
-           const matrix::Dense<ValueType> *a, const matrix::Dense<ValueType> *b,
-           const matrix::Dense<ValueType> *beta, matrix::Dense<ValueType> *c)
+void blocked_gemm(std::shared_ptr<const OmpExecutor> exec, ValueType alpha,
+                  const matrix::Dense<ValueType> *a,
+                  const matrix::Dense<ValueType> *b, ValueType beta,
+                  matrix::Dense<ValueType> *c)
 {
-    if (beta->at(0, 0) != zero<ValueType>()) {
-#pragma omp parallel for
-        for (size_type row = 0; row < c->get_size()[0]; ++row) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) *= beta->at(0, 0);
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+    const auto c_stride = c->get_stride();
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    const auto packed_a_size = ceildiv(gemm_mc, gemm_mr) * gemm_mr * gemm_kc;
+    const auto packed_b_size = ceildiv(gemm_nc, gemm_nr) * gemm_nr * gemm_kc;
+    Array<ValueType> packed_a_array(exec, num_threads * packed_a_size);
+    Array<ValueType> packed_b_array(exec, packed_b_size);
+    auto packed_b = packed_b_array.get_data();
+
+    for (size_type col = 0; col < num_cols; col += gemm_nc) {
+        const auto block_cols = std::min(gemm_nc, num_cols - col);
+        for (size_type inner = 0; inner < num_inner; inner += gemm_kc) {
+            const auto block_inner = std::min(gemm_kc, num_inner - inner);
+            const bool first_block = inner == 0;
+            pack_b_panel(b, inner, block_inner, col, block_cols, packed_b);
+#pragma omp parallel for schedule(dynamic)
+            for (size_type row = 0; row < num_rows; row += gemm_mc) {
+                const auto block_rows = std::min(gemm_mc, num_rows - row);
+                auto packed_a = packed_a_array.get_data() +
+                                omp_get_thread_num() * packed_a_size;
+                pack_a_block(a, row, block_rows, inner, block_inner, packed_a);
+                for (size_type j = 0; j < block_cols; j += gemm_nr) {
+                    for (size_type i = 0; i < block_rows; i += gemm_mr) {
+                        gemm_micro_kernel(
+                            block_inner, packed_a + i * block_inner,
+                            packed_b + j * block_inner, alpha, beta,
+                            first_block, std::min(gemm_mr, block_rows - i),
+                            std::min(gemm_nr, block_cols - j),
+                            c->get_values() + (row + i) * c_stride + col + j,
+                            c_stride);
+                    }
+                }
             }
         }
-    } else {
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes C = alpha * A * B + beta * C for a C with fewer columns than the
+ * width of the micro-kernel, e.g. a matrix-vector product. Each row of C is
+ * computed in a single, streaming pass over the corresponding row of A.
+ */
+template <typename ValueType>
+void narrow_gemm(ValueType alpha, const matrix::Dense<ValueType> *a,
+                 const matrix::Dense<ValueType> *b, ValueType beta,
+                 matrix::Dense<ValueType> *c)
+{
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
 #pragma omp parallel for
-        for (size_type row = 0; row < c->get_size()[0]; ++row) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) *= zero<ValueType>();
+    for (size_type row = 0; row < c->get_size()[0]; ++row) {
+        ValueType acc[gemm_nr] = {};
+        for (size_type k = 0; k < num_inner; ++k) {
+            const auto a_val = a->at(row, k);
+            for (size_type j = 0; j < num_cols; ++j) {
+                acc[j] += a_val * b->at(k, j);
             }
         }
+        for (size_type j = 0; j < num_cols; ++j) {
+            c->at(row, j) = beta == zero<ValueType>()
+                                ? alpha * acc[j]
+                                : beta * c->at(row, j) + alpha * acc[j];
+        }
     }
+}
 
+
+template <typename ValueType>
+void gemm(std::shared_ptr<const OmpExecutor> exec, ValueType alpha,
+          const matrix::Dense<ValueType> *a, const matrix::Dense<ValueType> *b,
+          ValueType beta, matrix::Dense<ValueType> *c)
+{
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+    if (num_rows == 0 || num_cols == 0) {
+        return;
+    }
+    if (num_inner == 0) {
 #pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) +=
-                    alpha->at(0, 0) * a->at(row, inner) * b->at(inner, col);
+        for (size_type row = 0; row < num_rows; ++row) {
+            for (size_type col = 0; col < num_cols; ++col) {
+                c->at(row, col) = beta == zero<ValueType>()
+                                      ? zero<ValueType>()
+                                      : beta * c->at(row, col);
             }
         }
+        return;
+    }
+#ifdef GINKGO_OMP_USE_BLAS
+    if (blas::fits_blas_int(num_rows, num_cols, num_inner, a->get_stride(),
+                            b->get_stride(), c->get_stride())) {
+        // BLAS uses column-major storage, so compute C^T = B^T * A^T
+        blas::gemm(num_cols, num_rows, num_inner, alpha, b->get_const_values(),
+                   std::max<size_type>(b->get_stride(), 1),
+                   a->get_const_values(),
+                   std::max<size_type>(a->get_stride(), 1), beta,
+                   c->get_values(), c->get_stride());
+        return;
+    }
+#endif  // GINKGO_OMP_USE_BLAS
+    if (num_cols < gemm_nr) {
+        narrow_gemm(alpha, a, b, beta, c);
+    } else {
+        blocked_gemm(exec, alpha, a, b, beta, c);
     }
 }
 
+
+}  // namespace
+
+
+template <typename ValueType>
+void simple_apply(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Dense<ValueType> *a,
+                  const matrix::Dense<ValueType> *b,
+                  matrix::Dense<ValueType> *c)
+{
+    gemm(exec, one<ValueType>(), a, b, zero<ValueType>(), c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_SIMPLE_APPLY_KERNEL);
+
+
+template <typename ValueType>
+void apply(std::shared_ptr<const OmpExecutor> exec,
+           const matrix::Dense<ValueType> *alpha,
+           const matrix::Dense<ValueType> *a, const matrix::Dense<ValueType> *b,
+           const matrix::Dense<ValueType> *beta, matrix::Dense<ValueType> *c)
+{
+    gemm(exec, alpha->at(0, 0), a, b, beta->at(0, 0), c);
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_APPLY_KERNEL);
 
 
@@ -178,16 +385,12 @@ void compute_dot(std::shared_ptr<const OmpExecutor> exec,
                  const matrix::Dense<ValueType> *y,
                  matrix::Dense<ValueType> *result)
 {
-#pragma omp parallel for
-    for (size_type j = 0; j < x->get_size()[1]; ++j) {
-        result->at(0, j) = zero<ValueType>();
-    }
-#pragma omp parallel for
-    for (size_type j = 0; j < x->get_size()[1]; ++j) {
-        for (size_type i = 0; i < x->get_size()[0]; ++i) {
-            result->at(0, j) += conj(x->at(i, j)) * y->at(i, j);
-        }
-    }
+    blocked_column_reduction(
+        exec, x->get_size()[0], x->get_size()[1],
+        [&](size_type row, size_type col) {
+            return conj(x->at(row, col)) * y->at(row, col);
+        },
+        result->get_values());
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_COMPUTE_DOT_KERNEL);
@@ -198,20 +401,63 @@ void compute_norm2(std::shared_ptr<const OmpExecutor> exec,
                    const matrix::Dense<ValueType> *x,
                    matrix::Dense<ValueType> *result)
 {
-    compute_dot(exec, x, x, result);
-    const size_type dim_0 = result->get_size()[0];
-    const size_type dim_1 = result->get_size()[1];
-#pragma omp parallel for collapse(2)
-    for (size_type i = 0; i < dim_0; ++i) {
-        for (size_type j = 0; j < dim_1; ++j) {
-            result->at(i, j) = sqrt(abs(result->at(i, j)));
-        }
+    using norm_type = remove_complex<ValueType>;
+    const auto num_cols = x->get_size()[1];
+    Array<norm_type> squared_norms(exec, num_cols);
+    auto norms = squared_norms.get_data();
+    blocked_column_reduction(
+        exec, x->get_size()[0], num_cols,
+        [&](size_type row, size_type col) {
+            return squared_norm(x->at(row, col));
+        },
+        norms);
+    for (size_type col = 0; col < num_cols; ++col) {
+        result->at(0, col) = sqrt(norms[col]);
     }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_COMPUTE_NORM2_KERNEL);
 
 
+namespace {
+
+
+template <typename ValueType>
+inline size_type count_row_nonzeros(const matrix::Dense<ValueType> *source,
+                                    size_type row)
+{
+    size_type num_nonzeros = 0;
+    for (size_type col = 0; col < source->get_size()[1]; ++col) {
+        num_nonzeros += (source->at(row, col) != zero<ValueType>());
+    }
+    return num_nonzeros;
+}
+
+
+/**
+ * @internal
+ *
+ * Computes the row pointers of the sparse matrix holding the nonzeros of
+ * `source`: the nonzeros of each row are counted in parallel, followed by an
+ * exclusive prefix sum.
+ */
+template <typename ValueType, typename IndexType>
+inline void compute_row_ptrs(const matrix::Dense<ValueType> *source,
+                             IndexType *row_ptrs)
+{
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        row_ptrs[row + 1] = count_row_nonzeros(source, row);
+    }
+    row_ptrs[0] = 0;
+    std::partial_sum(row_ptrs + 1, row_ptrs + num_rows + 1, row_ptrs + 1);
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void convert_to_coo(std::shared_ptr<const OmpExecutor> exec,
                     matrix::Coo<ValueType, IndexType> *result,
@@ -219,25 +465,25 @@ void convert_to_coo(std::shared_ptr<const OmpExecutor> exec,
 {
     auto num_rows = result->get_size()[0];
     auto num_cols = result->get_size()[1];
-    auto num_nonzeros = result->get_num_stored_elements();
 
     auto row_idxs = result->get_row_idxs();
     auto col_idxs = result->get_col_idxs();
     auto values = result->get_values();
 
-    size_type idxs = 0;
-    for (size_type row = 0; row < num_rows; ++row) {
+    Array<IndexType> row_ptrs_array(exec, num_rows + 1);
+    auto row_ptrs = row_ptrs_array.get_data();
+    compute_row_ptrs(source, row_ptrs);
+
 #pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        auto idxs = row_ptrs[row];
         for (size_type col = 0; col < num_cols; ++col) {
             auto val = source->at(row, col);
             if (val != zero<ValueType>()) {
-#pragma omp critical
-                {
-                    row_idxs[idxs] = row;
-                    col_idxs[idxs] = col;
-                    values[idxs] = val;
-                    ++idxs;
-                }
+                row_idxs[idxs] = row;
+                col_idxs[idxs] = col;
+                values[idxs] = val;
+                ++idxs;
             }
         }
     }
@@ -254,28 +500,24 @@ void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
 {
     auto num_rows = result->get_size()[0];
     auto num_cols = result->get_size()[1];
-    auto num_nonzeros = result->get_num_stored_elements();
 
     auto row_ptrs = result->get_row_ptrs();
     auto col_idxs = result->get_col_idxs();
     auto values = result->get_values();
 
-    size_type cur_ptr = 0;
-    row_ptrs[0] = cur_ptr;
-    for (size_type row = 0; row < num_rows; ++row) {
+    compute_row_ptrs(source, row_ptrs);
+
 #pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        auto cur_ptr = row_ptrs[row];
         for (size_type col = 0; col < num_cols; ++col) {
             auto val = source->at(row, col);
             if (val != zero<ValueType>()) {
-#pragma omp critical
-                {
-                    col_idxs[cur_ptr] = col;
-                    values[cur_ptr] = val;
-                    ++cur_ptr;
-                }
+                col_idxs[cur_ptr] = col;
+                values[cur_ptr] = val;
+                ++cur_ptr;
             }
         }
-        row_ptrs[row + 1] = cur_ptr;
     }
 }
 
@@ -345,9 +587,19 @@ void convert_to_hybrid(std::shared_ptr<const OmpExecutor> exec,
         coo_row[i] = 0;
     }
 
-    size_type coo_idx = 0;
-    // FIXME: This parallelization may cause the COO part to not being sorted by
-    //        row idx
+    // the first ell_lim nonzeros of each row go to the ELL part, the rest
+    // to the COO part, which is filled in row-major order
+    Array<size_type> coo_row_ptrs_array(exec, num_rows + 1);
+    auto coo_row_ptrs = coo_row_ptrs_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto row_nnz = count_row_nonzeros(source, row);
+        coo_row_ptrs[row + 1] = row_nnz > ell_lim ? row_nnz - ell_lim : 0;
+    }
+    coo_row_ptrs[0] = 0;
+    std::partial_sum(coo_row_ptrs + 1, coo_row_ptrs + num_rows + 1,
+                     coo_row_ptrs + 1);
+
 #pragma omp parallel for
     for (size_type row = 0; row < num_rows; row++) {
         size_type col_idx = 0;
@@ -361,20 +613,14 @@ void convert_to_hybrid(std::shared_ptr<const OmpExecutor> exec,
             }
             col++;
         }
+        auto coo_idx = coo_row_ptrs[row];
         while (col < num_cols) {
             auto val = source->at(row, col);
             if (val != zero<ValueType>()) {
-                size_type current_coo_idx;
-                // Use the critical section for accessing the coo_idx only, the
-                // rest can be performed in parallel since the index is unique
-#pragma omp critical
-                {
-                    current_coo_idx = coo_idx;
-                    ++coo_idx;
-                }
-                coo_val[current_coo_idx] = val;
-                coo_col[current_coo_idx] = col;
-                coo_row[current_coo_idx] = row;
+                coo_val[coo_idx] = val;
+                coo_col[coo_idx] = col;
+                coo_row[coo_idx] = row;
+                coo_idx++;
             }
             col++;
         }
@@ -470,21 +716,17 @@ void convert_to_sparsity_csr(std::shared_ptr<const OmpExecutor> exec,
     auto value = result->get_value();
     value[0] = one<ValueType>();
 
-    size_type cur_ptr = 0;
-    row_ptrs[0] = cur_ptr;
-    for (size_type row = 0; row < num_rows; ++row) {
+    compute_row_ptrs(source, row_ptrs);
+
 #pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        auto cur_ptr = row_ptrs[row];
         for (size_type col = 0; col < num_cols; ++col) {
-            auto val = source->at(row, col);
-            if (val != zero<ValueType>()) {
-#pragma omp critical
-                {
-                    col_idxs[cur_ptr] = col;
-                    ++cur_ptr;
-                }
+            if (source->at(row, col) != zero<ValueType>()) {
+                col_idxs[cur_ptr] = col;
+                ++cur_ptr;
             }
         }
-        row_ptrs[row + 1] = cur_ptr;
     }
 }
 
@@ -497,14 +739,11 @@ void count_nonzeros(std::shared_ptr<const OmpExecutor> exec,
                     const matrix::Dense<ValueType> *source, size_type *result)
 {
     auto num_rows = source->get_size()[0];
-    auto num_cols = source->get_size()[1];
-    auto num_nonzeros = 0;
+    size_type num_nonzeros = 0;
 
 #pragma omp parallel for reduction(+ : num_nonzeros)
     for (size_type row = 0; row < num_rows; ++row) {
-        for (size_type col = 0; col < num_cols; ++col) {
-            num_nonzeros += (source->at(row, col) != zero<ValueType>());
-        }
+        num_nonzeros += count_row_nonzeros(source, row);
     }
 
     *result = num_nonzeros;
@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/ell_kernels.hpp"
 
 
+#include <numeric>
+
+
 #include <omp.h>
 
 
@@ -141,7 +144,43 @@ template <typename ValueType, typename IndexType>
 void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
                     matrix::Csr<ValueType, IndexType> *result,
                     const matrix::Ell<ValueType, IndexType> *source)
-    GKO_NOT_IMPLEMENTED;
+{
+    const auto num_rows = source->get_size()[0];
+    const auto max_nnz_per_row = source->get_num_stored_elements_per_row();
+
+    auto row_ptrs = result->get_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto values = result->get_values();
+
+    // first sweep: count nnz for each row
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        IndexType nonzeros_in_this_row = 0;
+        for (size_type i = 0; i < max_nnz_per_row; i++) {
+            nonzeros_in_this_row +=
+                (source->val_at(row, i) != zero<ValueType>());
+        }
+        row_ptrs[row + 1] = nonzeros_in_this_row;
+    }
+
+    // build row pointers: exclusive scan (thus the + 1)
+    row_ptrs[0] = 0;
+    std::partial_sum(row_ptrs + 1, row_ptrs + num_rows + 1, row_ptrs + 1);
+
+    // second sweep: copy the nonzeros
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        auto cur_ptr = row_ptrs[row];
+        for (size_type i = 0; i < max_nnz_per_row; i++) {
+            const auto val = source->val_at(row, i);
+            if (val != zero<ValueType>()) {
+                values[cur_ptr] = val;
+                col_idxs[cur_ptr] = source->col_at(row, i);
+                cur_ptr++;
+            }
+        }
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ELL_CONVERT_TO_CSR_KERNEL);
@@ -154,10 +193,9 @@ void count_nonzeros(std::shared_ptr<const OmpExecutor> exec,
     size_type nonzeros = 0;
     const auto num_rows = source->get_size()[0];
     const auto max_nnz_per_row = source->get_num_stored_elements_per_row();
-    const auto stride = source->get_stride();
 
-    for (size_type row = 0; row < num_rows; row++) {
 #pragma omp parallel for reduction(+ : nonzeros)
+    for (size_type row = 0; row < num_rows; row++) {
         for (size_type i = 0; i < max_nnz_per_row; i++) {
             nonzeros += (source->val_at(row, i) != zero<ValueType>());
         }
@@ -173,7 +211,22 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
 template <typename ValueType, typename IndexType>
 void calculate_nonzeros_per_row(std::shared_ptr<const OmpExecutor> exec,
                                 const matrix::Ell<ValueType, IndexType> *source,
-                                Array<size_type> *result) GKO_NOT_IMPLEMENTED;
+                                Array<size_type> *result)
+{
+    const auto num_rows = source->get_size()[0];
+    const auto max_nnz_per_row = source->get_num_stored_elements_per_row();
+    auto row_nnz_val = result->get_data();
+
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        size_type nonzeros_in_this_row = 0;
+        for (size_type i = 0; i < max_nnz_per_row; i++) {
+            nonzeros_in_this_row +=
+                (source->val_at(row, i) != zero<ValueType>());
+        }
+        row_nnz_val[row] = nonzeros_in_this_row;
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ELL_CALCULATE_NONZEROS_PER_ROW_KERNEL);
@@ -33,10 +33,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/sellp_kernels.hpp"
 
 
+#include <numeric>
+
+
 #include <omp.h>
 
 
 #include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 
 
 namespace gko {
@@ -163,7 +169,55 @@ template <typename ValueType, typename IndexType>
 void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
                     matrix::Csr<ValueType, IndexType> *result,
                     const matrix::Sellp<ValueType, IndexType> *source)
-    GKO_NOT_IMPLEMENTED;
+{
+    const auto num_rows = source->get_size()[0];
+    const auto slice_size = source->get_slice_size();
+
+    const auto source_vals = source->get_const_values();
+    const auto source_slice_sets = source->get_const_slice_sets();
+    const auto source_col_idxs = source->get_const_col_idxs();
+
+    auto result_vals = result->get_values();
+    auto result_row_ptrs = result->get_row_ptrs();
+    auto result_col_idxs = result->get_col_idxs();
+
+    // first sweep: count nnz for each row
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto slice = row / slice_size;
+        const auto local_row = row % slice_size;
+        IndexType nonzeros_in_this_row = 0;
+        for (auto sellp_ind = source_slice_sets[slice] * slice_size + local_row;
+             sellp_ind < source_slice_sets[slice + 1] * slice_size;
+             sellp_ind += slice_size) {
+            nonzeros_in_this_row +=
+                (source_vals[sellp_ind] != zero<ValueType>());
+        }
+        result_row_ptrs[row + 1] = nonzeros_in_this_row;
+    }
+
+    // build row pointers: exclusive scan (thus the + 1)
+    result_row_ptrs[0] = 0;
+    std::partial_sum(result_row_ptrs + 1, result_row_ptrs + num_rows + 1,
+                     result_row_ptrs + 1);
+
+    // second sweep: copy the nonzeros
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto slice = row / slice_size;
+        const auto local_row = row % slice_size;
+        auto cur_ptr = result_row_ptrs[row];
+        for (auto sellp_ind = source_slice_sets[slice] * slice_size + local_row;
+             sellp_ind < source_slice_sets[slice + 1] * slice_size;
+             sellp_ind += slice_size) {
+            if (source_vals[sellp_ind] != zero<ValueType>()) {
+                result_vals[cur_ptr] = source_vals[sellp_ind];
+                result_col_idxs[cur_ptr] = source_col_idxs[sellp_ind];
+                cur_ptr++;
+            }
+        }
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_SELLP_CONVERT_TO_CSR_KERNEL);
@@ -172,7 +226,27 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
 template <typename ValueType, typename IndexType>
 void count_nonzeros(std::shared_ptr<const OmpExecutor> exec,
                     const matrix::Sellp<ValueType, IndexType> *source,
-                    size_type *result) GKO_NOT_IMPLEMENTED;
+                    size_type *result)
+{
+    const auto num_rows = source->get_size()[0];
+    const auto slice_size = source->get_slice_size();
+    const auto vals = source->get_const_values();
+    const auto slice_sets = source->get_const_slice_sets();
+    size_type num_nonzeros = 0;
+
+#pragma omp parallel for reduction(+ : num_nonzeros)
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto slice = row / slice_size;
+        const auto local_row = row % slice_size;
+        for (auto sellp_ind = slice_sets[slice] * slice_size + local_row;
+             sellp_ind < slice_sets[slice + 1] * slice_size;
+             sellp_ind += slice_size) {
+            num_nonzeros += (vals[sellp_ind] != zero<ValueType>());
+        }
+    }
+
+    *result = num_nonzeros;
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_SELLP_COUNT_NONZEROS_KERNEL);
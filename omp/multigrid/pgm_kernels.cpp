@@ -0,0 +1,333 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/multigrid/pgm_kernels.hpp"
+
+
+#include <algorithm>
+#include <cmath>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The parallel graph match aggregation namespace.
+ *
+ * @ingroup multigrid
+ */
+namespace pgm {
+namespace {
+
+
+// Hashes the undirected edge {i, j} to break ties between equally strong
+// connections. A total order on the edges guarantees that local maxima exist,
+// so the matching also progresses on matrices with constant coefficients.
+template <typename IndexType>
+inline uint64 edge_hash(IndexType i, IndexType j)
+{
+    auto hash = static_cast<uint64>(std::min(i, j)) * 0x9e3779b97f4a7c15ull ^
+                static_cast<uint64>(std::max(i, j));
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+
+template <typename ValueType>
+inline remove_complex<ValueType> strength(ValueType a_ij, ValueType d_i,
+                                          ValueType d_j)
+{
+    const auto scale = std::max(std::abs(d_i), std::abs(d_j));
+    return scale == zero<remove_complex<ValueType>>() ? std::abs(a_ij)
+                                                      : std::abs(a_ij) / scale;
+}
+
+
+// Returns the strongest neighbor of `row` whose aggregation state matches
+// `aggregated`, or -1 if there is none. `has_neighbor` is set if `row` is
+// connected to any other unknown.
+template <typename ValueType, typename IndexType>
+IndexType find_strongest(const matrix::Csr<ValueType, IndexType> *source,
+                         const ValueType *diag, const IndexType *agg,
+                         IndexType row, bool aggregated, bool &has_neighbor)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    IndexType strongest = -1;
+    remove_complex<ValueType> max_weight{};
+    uint64 max_hash{};
+    has_neighbor = false;
+    for (auto idx = row_ptrs[row]; idx < row_ptrs[row + 1]; ++idx) {
+        const auto col = col_idxs[idx];
+        if (col == row) {
+            continue;
+        }
+        const auto weight = strength(vals[idx], diag[row], diag[col]);
+        if (weight == zero<remove_complex<ValueType>>()) {
+            continue;
+        }
+        has_neighbor = true;
+        if ((agg[col] != -1) != aggregated) {
+            continue;
+        }
+        const auto hash = edge_hash(row, col);
+        if (strongest == -1 || weight > max_weight ||
+            (weight == max_weight && hash > max_hash)) {
+            strongest = col;
+            max_weight = weight;
+            max_hash = hash;
+        }
+    }
+    return strongest;
+}
+
+
+}  // namespace
+
+
+template <typename IndexType>
+void initialize_agg(std::shared_ptr<const OmpExecutor> exec,
+                    Array<IndexType> &agg)
+{
+    auto agg_vals = agg.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < agg.get_num_elems(); ++row) {
+        agg_vals[row] = -1;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_INITIALIZE_AGG_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void find_strongest_neighbor(std::shared_ptr<const OmpExecutor> exec,
+                             const matrix::Csr<ValueType, IndexType> *source,
+                             const Array<ValueType> &diag,
+                             const Array<IndexType> &agg,
+                             Array<IndexType> &strongest_neighbor)
+{
+    const auto agg_vals = agg.get_const_data();
+    auto strongest_vals = strongest_neighbor.get_data();
+    const auto num_rows = static_cast<IndexType>(agg.get_num_elems());
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        if (agg_vals[row] != -1) {
+            strongest_vals[row] = -1;
+            continue;
+        }
+        bool has_neighbor{};
+        const auto strongest = find_strongest(
+            source, diag.get_const_data(), agg_vals, row, false, has_neighbor);
+        // isolated unknowns are matched with themselves
+        strongest_vals[row] = has_neighbor ? strongest : row;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR_KERNEL);
+
+
+template <typename IndexType>
+void match_edge(std::shared_ptr<const OmpExecutor> exec,
+                const Array<IndexType> &strongest_neighbor,
+                Array<IndexType> &agg)
+{
+    const auto strongest_vals = strongest_neighbor.get_const_data();
+    auto agg_vals = agg.get_data();
+    const auto num_rows = static_cast<IndexType>(agg.get_num_elems());
+    // every row only writes its own aggregate and only reads the strongest
+    // neighbors, so the rows can be matched independently
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        if (agg_vals[row] != -1) {
+            continue;
+        }
+        const auto neighbor = strongest_vals[row];
+        if (neighbor != -1 && strongest_vals[neighbor] == row) {
+            agg_vals[row] = std::min(row, neighbor);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_MATCH_EDGE_KERNEL);
+
+
+template <typename IndexType>
+void count_unagg(std::shared_ptr<const OmpExecutor> exec,
+                 const Array<IndexType> &agg, IndexType *num_unagg)
+{
+    const auto agg_vals = agg.get_const_data();
+    IndexType unagg{};
+#pragma omp parallel for reduction(+ : unagg)
+    for (size_type row = 0; row < agg.get_num_elems(); ++row) {
+        unagg += agg_vals[row] == -1;
+    }
+    *num_unagg = unagg;
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void assign_to_exist_agg(std::shared_ptr<const OmpExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType> *source,
+                         const Array<ValueType> &diag, Array<IndexType> &agg,
+                         Array<IndexType> &intermediate_agg)
+{
+    auto agg_vals = agg.get_data();
+    auto intermediate_vals = intermediate_agg.get_data();
+    const auto num_rows = static_cast<IndexType>(agg.get_num_elems());
+    // The new aggregates only depend on the previous ones, so the rows can be
+    // processed in parallel
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        if (agg_vals[row] != -1) {
+            intermediate_vals[row] = agg_vals[row];
+            continue;
+        }
+        bool has_neighbor{};
+        const auto strongest = find_strongest(
+            source, diag.get_const_data(), agg_vals, row, true, has_neighbor);
+        intermediate_vals[row] = strongest == -1 ? row : agg_vals[strongest];
+    }
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        agg_vals[row] = intermediate_vals[row];
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG_KERNEL);
+
+
+template <typename IndexType>
+void renumber(std::shared_ptr<const OmpExecutor> exec,
+              Array<IndexType> &agg, IndexType *num_agg)
+{
+    const auto num_rows = agg.get_num_elems();
+    auto agg_vals = agg.get_data();
+    Array<IndexType> agg_map{exec, num_rows + 1};
+    auto map_vals = agg_map.get_data();
+    // every aggregate is represented by the unknown that was assigned to
+    // itself when the aggregate was formed
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        map_vals[row] = agg_vals[row] == static_cast<IndexType>(row);
+    }
+    map_vals[num_rows] = 0;
+    // exclusive prefix sum gives consecutive indices to the aggregates
+    IndexType sum{};
+    for (size_type row = 0; row <= num_rows; ++row) {
+        const auto marker = map_vals[row];
+        map_vals[row] = sum;
+        sum += marker;
+    }
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        agg_vals[row] = map_vals[agg_vals[row]];
+    }
+    *num_agg = map_vals[num_rows];
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_RENUMBER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_tentative_prolong(std::shared_ptr<const OmpExecutor> exec,
+                            const Array<IndexType> &agg,
+                            matrix::Csr<ValueType, IndexType> *prolong)
+{
+    const auto agg_vals = agg.get_const_data();
+    auto row_ptrs = prolong->get_row_ptrs();
+    auto col_idxs = prolong->get_col_idxs();
+    auto vals = prolong->get_values();
+    const auto num_rows = agg.get_num_elems();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        row_ptrs[row] = row;
+        col_idxs[row] = agg_vals[row];
+        vals[row] = one<ValueType>();
+    }
+    row_ptrs[num_rows] = num_rows;
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_FILL_TENTATIVE_PROLONG_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void scale_by_inverse_diag(std::shared_ptr<const OmpExecutor> exec,
+                           const Array<ValueType> &diag,
+                           matrix::Csr<ValueType, IndexType> *mtx,
+                           remove_complex<ValueType> *max_row_sum)
+{
+    const auto diag_vals = diag.get_const_data();
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    auto vals = mtx->get_values();
+    auto result = zero<remove_complex<ValueType>>();
+#pragma omp parallel for reduction(max : result)
+    for (size_type row = 0; row < mtx->get_size()[0]; ++row) {
+        // rows without a diagonal entry do not take part in the smoothing
+        const auto scale = diag_vals[row] == zero<ValueType>()
+                               ? zero<ValueType>()
+                               : one<ValueType>() / diag_vals[row];
+        auto row_sum = zero<remove_complex<ValueType>>();
+        for (auto idx = row_ptrs[row]; idx < row_ptrs[row + 1]; ++idx) {
+            vals[idx] *= scale;
+            row_sum += std::abs(vals[idx]);
+        }
+        result = std::max(result, row_sum);
+    }
+    *max_row_sum = result;
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_SCALE_BY_INVERSE_DIAG_KERNEL);
+
+
+}  // namespace pgm
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
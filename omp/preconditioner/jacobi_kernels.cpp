@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "core/base/extended_float.hpp"
 #include "core/preconditioner/jacobi_utils.hpp"
+#include "core/synthesizer/implementation_selection.hpp"
 #include "omp/components/matrix_operations.hpp"
 
 
@@ -62,6 +63,22 @@ namespace omp {
  * @ingroup jacobi
  */
 namespace jacobi {
+namespace {
+
+
+/**
+ * A compile-time list of block sizes for which dedicated generate and apply
+ * kernels should be compiled.
+ */
+#ifdef GINKGO_JACOBI_FULL_OPTIMIZATIONS
+using compiled_kernels = syn::as_list<syn::range<1, 33, 1>>;
+#else
+using compiled_kernels =
+    syn::value_list<int, 1, 2, 3, 4, 5, 6, 7, 8, 12, 13, 16, 24, 32>;
+#endif
+
+
+}  // namespace
 
 
 void initialize_precisions(std::shared_ptr<const OmpExecutor> exec,
@@ -95,8 +112,51 @@ inline bool has_same_nonzero_pattern(const IndexType *prev_row_ptr,
 }
 
 
+/**
+ * Splits the range [0, size) into at most `max_segments` contiguous segments
+ * of (almost) equal length, one per thread. Returns the number of segments.
+ */
+inline size_type get_segments(size_type size, size_type max_segments,
+                              size_type &segment_size)
+{
+    const auto num_segments = std::max<size_type>(
+        std::min<size_type>(max_segments, size), size_type{1});
+    segment_size = ceildiv(size, num_segments);
+    return ceildiv(size, segment_size);
+}
+
+
+/**
+ * Computes the exclusive prefix sum of `counts` in-place and returns the
+ * total.
+ */
+inline size_type exclusive_prefix_sum(std::vector<size_type> &counts)
+{
+    size_type total{};
+    for (auto &count : counts) {
+        const auto tmp = count;
+        count = total;
+        total += tmp;
+    }
+    return total;
+}
+
+
+/**
+ * Finds the natural blocks of the matrix, i.e. groups of consecutive rows with
+ * the same nonzero pattern, split into chunks of at most `max_block_size`
+ * rows (counting from the start of the group).
+ *
+ * The rows are processed in one segment per thread: first, the rows that
+ * start a new pattern are marked, then the start of the pattern group that
+ * crosses into each segment is propagated across the segment boundaries, and
+ * finally each segment writes its block starts at an offset given by the
+ * prefix sum of the per-segment block counts. The result is identical to the
+ * one of a sequential left-to-right scan.
+ */
 template <typename ValueType, typename IndexType>
-size_type find_natural_blocks(const matrix::Csr<ValueType, IndexType> *mtx,
+size_type find_natural_blocks(std::shared_ptr<const OmpExecutor> exec,
+                              const matrix::Csr<ValueType, IndexType> *mtx,
                               uint32 max_block_size, IndexType *block_ptrs)
 {
     const auto rows = mtx->get_size()[0];
@@ -106,49 +166,175 @@ size_type find_natural_blocks(const matrix::Csr<ValueType, IndexType> *mtx,
     if (rows == 0) {
         return 0;
     }
-    size_type num_blocks = 1;
-    int32 current_block_size = 1;
-    for (size_type i = 1; i < rows; ++i) {
-        const auto prev_row_ptr = col_idx + row_ptrs[i - 1];
-        const auto curr_row_ptr = col_idx + row_ptrs[i];
-        const auto next_row_ptr = col_idx + row_ptrs[i + 1];
-        if (current_block_size < max_block_size &&
-            has_same_nonzero_pattern(prev_row_ptr, curr_row_ptr,
-                                     next_row_ptr)) {
-            ++current_block_size;
-        } else {
-            block_ptrs[num_blocks] =
-                block_ptrs[num_blocks - 1] + current_block_size;
-            ++num_blocks;
-            current_block_size = 1;
+    size_type segment_size{};
+    const auto num_segments =
+        get_segments(rows, omp_get_max_threads(), segment_size);
+    Array<uint8> is_block_start(exec, rows);
+    auto flags = is_block_start.get_data();
+    // the last row starting a new pattern in each segment, `rows` if none
+    std::vector<size_type> last_pattern_start(num_segments, rows);
+    std::vector<size_type> block_offsets(num_segments, 0);
+
+#pragma omp parallel for
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, rows);
+        for (auto i = begin; i < end; ++i) {
+            const auto new_pattern =
+                i == 0 || !has_same_nonzero_pattern(col_idx + row_ptrs[i - 1],
+                                                    col_idx + row_ptrs[i],
+                                                    col_idx + row_ptrs[i + 1]);
+            flags[i] = new_pattern;
+            if (new_pattern) {
+                last_pattern_start[segment] = i;
+            }
+        }
+    }
+
+    // propagate the start of the pattern group entering each segment
+    size_type pattern_start{};
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto segment_last_start = last_pattern_start[segment];
+        last_pattern_start[segment] = pattern_start;
+        if (segment_last_start != rows) {
+            pattern_start = segment_last_start;
+        }
+    }
+
+#pragma omp parallel for
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, rows);
+        auto group_start = last_pattern_start[segment];
+        size_type count{};
+        for (auto i = begin; i < end; ++i) {
+            if (flags[i]) {
+                group_start = i;
+            }
+            flags[i] = (i - group_start) % max_block_size == 0;
+            count += flags[i];
+        }
+        block_offsets[segment] = count;
+    }
+
+    const auto num_blocks = exclusive_prefix_sum(block_offsets);
+
+#pragma omp parallel for
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, rows);
+        auto out = block_offsets[segment];
+        for (auto i = begin; i < end; ++i) {
+            if (flags[i]) {
+                block_ptrs[out++] = i;
+            }
         }
     }
-    block_ptrs[num_blocks] = block_ptrs[num_blocks - 1] + current_block_size;
+    block_ptrs[num_blocks] = rows;
     return num_blocks;
 }
 
 
+/**
+ * Merges consecutive natural blocks into supervariables of at most
+ * `max_block_size` rows, using the same greedy left-to-right strategy as the
+ * sequential algorithm.
+ *
+ * Each segment of natural blocks is first processed speculatively, assuming
+ * that its first block starts a new supervariable. Afterwards, the segments
+ * are corrected in order: starting from the actual supervariable size at the
+ * end of the previous segment, the greedy scan is repeated only until it
+ * starts a supervariable at a block where the speculative scan did so too,
+ * as from then on both scans coincide. This is usually the case after a
+ * handful of blocks, so the sequential part of the algorithm is short.
+ */
 template <typename IndexType>
-inline size_type agglomerate_supervariables(uint32 max_block_size,
-                                            size_type num_natural_blocks,
-                                            IndexType *block_ptrs)
+size_type agglomerate_supervariables(std::shared_ptr<const OmpExecutor> exec,
+                                     uint32 max_block_size,
+                                     size_type num_natural_blocks,
+                                     IndexType *block_ptrs)
 {
     if (num_natural_blocks == 0) {
         return 0;
     }
-    size_type num_blocks = 1;
-    int32 current_block_size = block_ptrs[1] - block_ptrs[0];
-    for (size_type i = 1; i < num_natural_blocks; ++i) {
-        const int32 block_size = block_ptrs[i + 1] - block_ptrs[i];
-        if (current_block_size + block_size <= max_block_size) {
-            current_block_size += block_size;
-        } else {
-            block_ptrs[num_blocks] = block_ptrs[i];
-            ++num_blocks;
-            current_block_size = block_size;
+    const auto max_size = static_cast<int32>(max_block_size);
+    size_type segment_size{};
+    const auto num_segments = get_segments(
+        num_natural_blocks, omp_get_max_threads(), segment_size);
+    Array<IndexType> natural_ptrs(exec, num_natural_blocks + 1);
+    auto ptrs = natural_ptrs.get_data();
+    Array<uint8> is_block_start(exec, num_natural_blocks);
+    auto flags = is_block_start.get_data();
+    // size of the last (speculative) supervariable in each segment
+    std::vector<int32> last_size(num_segments);
+    std::vector<size_type> block_offsets(num_segments, 0);
+
+#pragma omp parallel for
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, num_natural_blocks);
+        int32 current_block_size{};
+        for (auto i = begin; i < end; ++i) {
+            ptrs[i] = block_ptrs[i];
+            const int32 block_size = block_ptrs[i + 1] - block_ptrs[i];
+            const auto starts_block =
+                i == begin || current_block_size + block_size > max_size;
+            flags[i] = starts_block;
+            current_block_size =
+                starts_block ? block_size : current_block_size + block_size;
         }
+        last_size[segment] = current_block_size;
     }
-    block_ptrs[num_blocks] = block_ptrs[num_natural_blocks];
+    ptrs[num_natural_blocks] = block_ptrs[num_natural_blocks];
+
+    // fix the segment boundaries
+    auto current_block_size = last_size[0];
+    for (size_type segment = 1; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, num_natural_blocks);
+        auto converged = false;
+        for (auto i = begin; i < end && !converged; ++i) {
+            const int32 block_size = ptrs[i + 1] - ptrs[i];
+            if (current_block_size + block_size > max_size) {
+                // both scans start a supervariable here
+                converged = flags[i];
+                flags[i] = true;
+                current_block_size = block_size;
+            } else {
+                flags[i] = false;
+                current_block_size += block_size;
+            }
+        }
+        if (converged) {
+            current_block_size = last_size[segment];
+        }
+    }
+
+#pragma omp parallel for
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, num_natural_blocks);
+        size_type count{};
+        for (auto i = begin; i < end; ++i) {
+            count += flags[i];
+        }
+        block_offsets[segment] = count;
+    }
+
+    const auto num_blocks = exclusive_prefix_sum(block_offsets);
+
+#pragma omp parallel for
+    for (size_type segment = 0; segment < num_segments; ++segment) {
+        const auto begin = segment * segment_size;
+        const auto end = std::min(begin + segment_size, num_natural_blocks);
+        auto out = block_offsets[segment];
+        for (auto i = begin; i < end; ++i) {
+            if (flags[i]) {
+                block_ptrs[out++] = ptrs[i];
+            }
+        }
+    }
+    block_ptrs[num_blocks] = ptrs[num_natural_blocks];
     return num_blocks;
 }
 
@@ -162,9 +348,9 @@ void find_blocks(std::shared_ptr<const OmpExecutor> exec,
                  uint32 max_block_size, size_type &num_blocks,
                  Array<IndexType> &block_pointers)
 {
-    num_blocks = find_natural_blocks(system_matrix, max_block_size,
+    num_blocks = find_natural_blocks(exec, system_matrix, max_block_size,
                                      block_pointers.get_data());
-    num_blocks = agglomerate_supervariables(max_block_size, num_blocks,
+    num_blocks = agglomerate_supervariables(exec, max_block_size, num_blocks,
                                             block_pointers.get_data());
 }
 
@@ -240,9 +426,11 @@ inline bool apply_gauss_jordan_transform(IndexType row, IndexType col,
     }
     block[row * stride + col] = zero<ValueType>();
     for (IndexType i = 0; i < block_size; ++i) {
+        // block(row, col) is zero, so block(i, col) does not change here
+        const auto factor = block[i * stride + col];
+#pragma omp simd
         for (IndexType j = 0; j < block_size; ++j) {
-            block[i * stride + j] +=
-                block[i * stride + col] * block[row * stride + j];
+            block[i * stride + j] += factor * block[row * stride + j];
         }
     }
     for (IndexType j = 0; j < block_size; ++j) {
@@ -311,6 +499,39 @@ inline bool invert_block(IndexType block_size, IndexType *perm,
 }
 
 
+template <int max_block_size, typename ValueType, typename IndexType>
+inline void invert_block(syn::value_list<int, max_block_size>,
+                         IndexType block_size, IndexType *perm,
+                         ValueType *block, size_type stride, bool *status)
+{
+    // passing the block size as a constant lets the compiler unroll and
+    // vectorize the elimination loops for the most common block sizes
+    if (block_size == max_block_size) {
+        *status = invert_block(IndexType{max_block_size}, perm, block, stride);
+    } else {
+        *status = invert_block(block_size, perm, block, stride);
+    }
+}
+
+GKO_ENABLE_IMPLEMENTATION_SELECTION(select_invert_block, invert_block);
+
+
+template <typename ValueType, typename IndexType>
+inline bool invert_block_selected(IndexType block_size, IndexType *perm,
+                                  ValueType *block, size_type stride)
+{
+    bool status{};
+    select_invert_block(
+        compiled_kernels(),
+        [&](int compiled_block_size) {
+            return block_size <= compiled_block_size;
+        },
+        syn::value_list<int>(), syn::type_list<>(), block_size, perm, block,
+        stride, &status);
+    return status;
+}
+
+
 template <typename ReducedType, typename ValueType, typename IndexType>
 inline bool validate_precision_reduction_feasibility(IndexType block_size,
                                                      const ValueType *block,
@@ -329,7 +550,7 @@ inline bool validate_precision_reduction_feasibility(IndexType block_size,
     auto cond =
         compute_inf_norm(block_size, block_size, tmp.data(), block_size);
     auto succeeded =
-        invert_block(block_size, perm.data(), tmp.data(), block_size);
+        invert_block_selected(block_size, perm.data(), tmp.data(), block_size);
     if (!succeeded) {
         return false;
     }
@@ -379,8 +600,8 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
                     compute_inf_norm(block_size, block_size,
                                      block[b].get_const_data(), block_size);
             }
-            invert_block(block_size, perm[b].get_data(), block[b].get_data(),
-                         block_size);
+            invert_block_selected(block_size, perm[b].get_data(),
+                                  block[b].get_data(), block_size);
             if (cond) {
                 cond[g + b] *=
                     compute_inf_norm(block_size, block_size,
@@ -445,39 +666,64 @@ namespace {
 
 
 template <
-    typename ValueType, typename BlockValueType,
+    int max_block_size, typename ValueType, typename BlockValueType,
     typename ValueConverter = default_converter<BlockValueType, ValueType>>
-inline void apply_block(size_type block_size, size_type num_rhs,
-                        const BlockValueType *block, size_type stride,
-                        ValueType alpha, const ValueType *b, size_type stride_b,
-                        ValueType beta, ValueType *x, size_type stride_x,
-                        ValueConverter converter = {})
+inline void apply_block_impl(size_type block_size, size_type num_rhs,
+                             const BlockValueType *block, size_type stride,
+                             ValueType alpha, const ValueType *b,
+                             size_type stride_b, ValueType beta, ValueType *x,
+                             size_type stride_x, ValueConverter converter = {})
 {
-    if (beta != zero<ValueType>()) {
+    ValueType result[max_block_size];
+    for (size_type col = 0; col < num_rhs; ++col) {
         for (size_type row = 0; row < block_size; ++row) {
-            for (size_type col = 0; col < num_rhs; ++col) {
-                x[row * stride_x + col] *= beta;
+            result[row] = zero<ValueType>();
+        }
+        // the blocks are stored transposed, so each column is contiguous
+        for (size_type inner = 0; inner < block_size; ++inner) {
+            const auto b_value = b[inner * stride_b + col];
+            const auto block_col = block + inner * stride;
+#pragma omp simd
+            for (size_type row = 0; row < block_size; ++row) {
+                result[row] += converter(block_col[row]) * b_value;
             }
         }
-    } else {
-        for (size_type row = 0; row < block_size; ++row) {
-            for (size_type col = 0; col < num_rhs; ++col) {
-                x[row * stride_x + col] = zero<ValueType>();
+        if (beta != zero<ValueType>()) {
+            for (size_type row = 0; row < block_size; ++row) {
+                x[row * stride_x + col] =
+                    beta * x[row * stride_x + col] + alpha * result[row];
+            }
+        } else {
+            for (size_type row = 0; row < block_size; ++row) {
+                x[row * stride_x + col] = alpha * result[row];
             }
         }
     }
+}
 
-    for (size_type inner = 0; inner < block_size; ++inner) {
-        for (size_type row = 0; row < block_size; ++row) {
-            for (size_type col = 0; col < num_rhs; ++col) {
-                x[row * stride_x + col] +=
-                    alpha * converter(block[row + inner * stride]) *
-                    b[inner * stride_b + col];
-            }
-        }
+
+template <int max_block_size, typename ValueType, typename BlockValueType>
+inline void apply_block(syn::value_list<int, max_block_size>, int block_size,
+                        size_type num_rhs,
+                        const BlockValueType *block, size_type stride,
+                        ValueType alpha, const ValueType *b, size_type stride_b,
+                        ValueType beta, ValueType *x, size_type stride_x)
+{
+    // passing the block size as a constant lets the compiler fully unroll the
+    // product for the most common block sizes
+    if (block_size == max_block_size) {
+        apply_block_impl<max_block_size>(max_block_size, num_rhs, block, stride,
+                                         alpha, b, stride_b, beta, x,
+                                         stride_x);
+    } else {
+        apply_block_impl<max_block_size>(block_size, num_rhs, block, stride,
+                                         alpha, b, stride_b, beta, x,
+                                         stride_x);
     }
 }
 
+GKO_ENABLE_IMPLEMENTATION_SELECTION(select_apply_block, apply_block);
+
 
 }  // namespace
 
@@ -496,6 +742,9 @@ void apply(std::shared_ptr<const OmpExecutor> exec, size_type num_blocks,
 {
     const auto ptrs = block_pointers.get_const_data();
     const auto prec = block_precisions.get_const_data();
+    const auto num_rhs = b->get_size()[1];
+    const auto alpha_value = alpha->at(0, 0);
+    const auto beta_value = beta->at(0, 0);
 #pragma omp parallel for
     for (size_type i = 0; i < num_blocks; ++i) {
         const auto group =
@@ -506,12 +755,17 @@ void apply(std::shared_ptr<const OmpExecutor> exec, size_type num_blocks,
         const auto p = prec ? prec[i] : precision_reduction();
         GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
             ValueType, p,
-            apply_block(block_size, b->get_size()[1],
-                        reinterpret_cast<const resolved_precision *>(group) +
-                            storage_scheme.get_block_offset(i),
-                        storage_scheme.get_stride(), alpha->at(0, 0), block_b,
-                        b->get_stride(), beta->at(0, 0), block_x,
-                        x->get_stride()));
+            select_apply_block(
+                compiled_kernels(),
+                [&](int compiled_block_size) {
+                    return block_size <= compiled_block_size;
+                },
+                syn::value_list<int>(), syn::type_list<>(), block_size,
+                num_rhs,
+                reinterpret_cast<const resolved_precision *>(group) +
+                    storage_scheme.get_block_offset(i),
+                storage_scheme.get_stride(), alpha_value, block_b,
+                b->get_stride(), beta_value, block_x, x->get_stride()));
     }
 }
 
@@ -530,6 +784,7 @@ void simple_apply(
 {
     const auto ptrs = block_pointers.get_const_data();
     const auto prec = block_precisions.get_const_data();
+    const auto num_rhs = b->get_size()[1];
 #pragma omp parallel for
     for (size_type i = 0; i < num_blocks; ++i) {
         const auto group =
@@ -540,12 +795,17 @@ void simple_apply(
         const auto p = prec ? prec[i] : precision_reduction();
         GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
             ValueType, p,
-            apply_block(block_size, b->get_size()[1],
-                        reinterpret_cast<const resolved_precision *>(group) +
-                            storage_scheme.get_block_offset(i),
-                        storage_scheme.get_stride(), one<ValueType>(), block_b,
-                        b->get_stride(), zero<ValueType>(), block_x,
-                        x->get_stride()));
+            select_apply_block(
+                compiled_kernels(),
+                [&](int compiled_block_size) {
+                    return block_size <= compiled_block_size;
+                },
+                syn::value_list<int>(), syn::type_list<>(), block_size,
+                num_rhs,
+                reinterpret_cast<const resolved_precision *>(group) +
+                    storage_scheme.get_block_offset(i),
+                storage_scheme.get_stride(), one<ValueType>(), block_b,
+                b->get_stride(), zero<ValueType>(), block_x, x->get_stride()));
     }
 }
 
@@ -593,6 +853,104 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_JACOBI_CONVERT_TO_DENSE_KERNEL);
 
 
+template <typename ValueType>
+void invert_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                     Array<ValueType> &diag)
+{
+    const auto size = diag.get_num_elems();
+    auto values = diag.get_data();
+#pragma omp parallel for
+    for (size_type i = 0; i < size; ++i) {
+        // singular 1x1 blocks are left as they are, like in generate
+        if (values[i] != zero<ValueType>()) {
+            values[i] = one<ValueType>() / values[i];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_JACOBI_INVERT_DIAGONAL_KERNEL);
+
+
+template <typename ValueType>
+void scalar_apply(std::shared_ptr<const OmpExecutor> exec,
+                  const Array<ValueType> &inverse_diag,
+                  const matrix::Dense<ValueType> *alpha,
+                  const matrix::Dense<ValueType> *b,
+                  const matrix::Dense<ValueType> *beta,
+                  matrix::Dense<ValueType> *x)
+{
+    const auto diag = inverse_diag.get_const_data();
+    const auto alpha_value = alpha->at(0, 0);
+    const auto beta_value = beta->at(0, 0);
+    const auto num_rows = x->get_size()[0];
+    const auto num_cols = x->get_size()[1];
+    const auto b_values = b->get_const_values();
+    const auto b_stride = b->get_stride();
+    auto x_values = x->get_values();
+    const auto x_stride = x->get_stride();
+    if (beta_value == zero<ValueType>()) {
+#pragma omp parallel for
+        for (size_type row = 0; row < num_rows; ++row) {
+            const auto scale = alpha_value * diag[row];
+#pragma omp simd
+            for (size_type col = 0; col < num_cols; ++col) {
+                x_values[row * x_stride + col] =
+                    scale * b_values[row * b_stride + col];
+            }
+        }
+    } else {
+#pragma omp parallel for
+        for (size_type row = 0; row < num_rows; ++row) {
+            const auto scale = alpha_value * diag[row];
+#pragma omp simd
+            for (size_type col = 0; col < num_cols; ++col) {
+                x_values[row * x_stride + col] =
+                    beta_value * x_values[row * x_stride + col] +
+                    scale * b_values[row * b_stride + col];
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_JACOBI_SCALAR_APPLY_KERNEL);
+
+
+template <typename ValueType>
+void simple_scalar_apply(std::shared_ptr<const OmpExecutor> exec,
+                         const Array<ValueType> &inverse_diag,
+                         const matrix::Dense<ValueType> *b,
+                         matrix::Dense<ValueType> *x)
+{
+    const auto diag = inverse_diag.get_const_data();
+    const auto num_rows = x->get_size()[0];
+    const auto num_cols = x->get_size()[1];
+    const auto b_values = b->get_const_values();
+    const auto b_stride = b->get_stride();
+    auto x_values = x->get_values();
+    const auto x_stride = x->get_stride();
+    if (num_cols == 1) {
+        // a single right-hand side is a plain elementwise product
+#pragma omp parallel for simd
+        for (size_type row = 0; row < num_rows; ++row) {
+            x_values[row * x_stride] = diag[row] * b_values[row * b_stride];
+        }
+        return;
+    }
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto scale = diag[row];
+#pragma omp simd
+        for (size_type col = 0; col < num_cols; ++col) {
+            x_values[row * x_stride + col] =
+                scale * b_values[row * b_stride + col];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_JACOBI_SIMPLE_SCALAR_APPLY_KERNEL);
+
+
 }  // namespace jacobi
 }  // namespace omp
 }  // namespace kernels
@@ -44,6 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/math.hpp>
 
 
+#include "omp/components/reduction.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -133,23 +136,36 @@ void step_2(std::shared_ptr<const OmpExecutor> exec,
             const matrix::Dense<ValueType> *rho,
             matrix::Dense<ValueType> *alpha,
             const matrix::Dense<ValueType> *beta,
+            matrix::Dense<ValueType> *s_norm,
             const Array<stopping_status> *stop_status)
 {
-#pragma omp parallel for
-    for (size_type i = 0; i < s->get_size()[0]; ++i) {
-        for (size_type j = 0; j < s->get_size()[1]; ++j) {
-            if (stop_status->get_const_data()[j].has_stopped()) {
-                continue;
-            }
-            if (beta->at(j) != zero<ValueType>()) {
-                alpha->at(j) = rho->at(j) / beta->at(j);
-                s->at(i, j) = r->at(i, j) - alpha->at(j) * v->at(i, j);
-            } else {
-                alpha->at(j) = zero<ValueType>();
-                s->at(i, j) = r->at(i, j);
-            }
+    using norm_type = remove_complex<ValueType>;
+    const auto num_cols = s->get_size()[1];
+    for (size_type j = 0; j < num_cols; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        if (beta->at(j) != zero<ValueType>()) {
+            alpha->at(j) = rho->at(j) / beta->at(j);
+        } else {
+            alpha->at(j) = zero<ValueType>();
         }
     }
+    Array<norm_type> squared_norms(exec, num_cols);
+    auto norms = squared_norms.get_data();
+    blocked_column_reduction(
+        exec, s->get_size()[0], num_cols,
+        [&](size_type row, size_type col) {
+            if (!stop_status->get_const_data()[col].has_stopped()) {
+                s->at(row, col) =
+                    r->at(row, col) - alpha->at(col) * v->at(row, col);
+            }
+            return squared_norm(s->at(row, col));
+        },
+        norms);
+    for (size_type j = 0; j < num_cols; ++j) {
+        s_norm->at(j) = sqrt(norms[j]);
+    }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_2_KERNEL);
@@ -162,10 +178,12 @@ void step_3(
     const matrix::Dense<ValueType> *t, const matrix::Dense<ValueType> *y,
     const matrix::Dense<ValueType> *z, const matrix::Dense<ValueType> *alpha,
     const matrix::Dense<ValueType> *beta, const matrix::Dense<ValueType> *gamma,
-    matrix::Dense<ValueType> *omega, const Array<stopping_status> *stop_status)
+    matrix::Dense<ValueType> *omega, const matrix::Dense<ValueType> *rr,
+    matrix::Dense<ValueType> *rho, matrix::Dense<ValueType> *residual_norm,
+    const Array<stopping_status> *stop_status)
 {
-#pragma omp parallel for
-    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+    const auto num_cols = x->get_size()[1];
+    for (size_type j = 0; j < num_cols; ++j) {
         if (stop_status->get_const_data()[j].has_stopped()) {
             continue;
         }
@@ -175,16 +193,31 @@ void step_3(
             omega->at(j) = zero<ValueType>();
         }
     }
-#pragma omp parallel for
-    for (size_type i = 0; i < x->get_size()[0]; ++i) {
-        for (size_type j = 0; j < x->get_size()[1]; ++j) {
-            if (stop_status->get_const_data()[j].has_stopped()) {
-                continue;
+    // the next rho = (rr, r) and the norm of r are reduced as 2 * num_cols
+    // columns while r is updated. The blocked reduction visits the columns of
+    // a row in ascending order, so r(row, j) is updated (for col = j) before
+    // its norm contribution is computed (for col = num_cols + j).
+    Array<ValueType> results(exec, 2 * num_cols);
+    auto sums = results.get_data();
+    blocked_column_reduction(
+        exec, x->get_size()[0], 2 * num_cols,
+        [&](size_type row, size_type col) {
+            if (col >= num_cols) {
+                return static_cast<ValueType>(
+                    squared_norm(r->at(row, col - num_cols)));
             }
-            x->at(i, j) +=
-                alpha->at(j) * y->at(i, j) + omega->at(j) * z->at(i, j);
-            r->at(i, j) = s->at(i, j) - omega->at(j) * t->at(i, j);
-        }
+            if (!stop_status->get_const_data()[col].has_stopped()) {
+                x->at(row, col) += alpha->at(col) * y->at(row, col) +
+                                   omega->at(col) * z->at(row, col);
+                r->at(row, col) =
+                    s->at(row, col) - omega->at(col) * t->at(row, col);
+            }
+            return conj(rr->at(row, col)) * r->at(row, col);
+        },
+        sums);
+    for (size_type j = 0; j < num_cols; ++j) {
+        rho->at(j) = sums[j];
+        residual_norm->at(j) = sqrt(abs(sums[num_cols + j]));
     }
 }
 
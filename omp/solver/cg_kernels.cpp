@@ -42,6 +42,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/types.hpp>
 
 
+#include "omp/components/reduction.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -112,20 +115,29 @@ void step_2(std::shared_ptr<const OmpExecutor> exec,
             const matrix::Dense<ValueType> *q,
             const matrix::Dense<ValueType> *beta,
             const matrix::Dense<ValueType> *rho,
+            matrix::Dense<ValueType> *residual_norm,
             const Array<stopping_status> *stop_status)
 {
-#pragma omp parallel for
-    for (size_type i = 0; i < x->get_size()[0]; ++i) {
-        for (size_type j = 0; j < x->get_size()[1]; ++j) {
-            if (stop_status->get_const_data()[j].has_stopped()) {
-                continue;
-            }
-            if (beta->at(j) != zero<ValueType>()) {
-                auto tmp = rho->at(j) / beta->at(j);
-                x->at(i, j) += tmp * p->at(i, j);
-                r->at(i, j) -= tmp * q->at(i, j);
+    using norm_type = remove_complex<ValueType>;
+    const auto num_cols = x->get_size()[1];
+    Array<norm_type> squared_norms(exec, num_cols);
+    auto norms = squared_norms.get_data();
+    // the residual norm is accumulated while r is updated, which saves the
+    // stopping criterion another pass over r
+    blocked_column_reduction(
+        exec, x->get_size()[0], num_cols,
+        [&](size_type row, size_type col) {
+            if (!stop_status->get_const_data()[col].has_stopped() &&
+                beta->at(col) != zero<ValueType>()) {
+                auto tmp = rho->at(col) / beta->at(col);
+                x->at(row, col) += tmp * p->at(row, col);
+                r->at(row, col) -= tmp * q->at(row, col);
             }
-        }
+            return squared_norm(r->at(row, col));
+        },
+        norms);
+    for (size_type col = 0; col < num_cols; ++col) {
+        residual_norm->at(col) = sqrt(norms[col]);
     }
 }
 
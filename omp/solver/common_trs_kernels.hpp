@@ -0,0 +1,287 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+#define GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+struct SolveStruct {
+    virtual void dummy() {}
+};
+
+
+namespace omp {
+
+
+/**
+ * Stores the result of the analysis phase of a triangular solve: the rows of
+ * the matrix grouped into levels, such that all rows of a level only depend
+ * on rows of previous levels, and the algorithm used by the solve.
+ */
+struct SolveStruct : gko::solver::SolveStruct {
+    enum class algorithm {
+        /** Plain sweep over the rows, used with a single thread. */
+        sequential,
+        /** Rows of each level are solved in parallel, levels in order. */
+        level_set,
+        /**
+         * Rows are distributed statically over the threads, and each row
+         * waits on the completion flags of the rows it depends on.
+         */
+        sync_free
+    };
+
+    SolveStruct(std::shared_ptr<const Executor> exec)
+        : algo{algorithm::sequential}, level_ptrs{exec}, level_rows{exec}
+    {}
+
+    algorithm algo;
+    /**
+     * `level_rows[level_ptrs[l]:level_ptrs[l + 1]]` are the rows of level l.
+     * They are filled for both parallel algorithms, since the conjugate
+     * transposed solve of LowerTrs traverses the levels in reverse order.
+     */
+    Array<size_type> level_ptrs;
+    Array<size_type> level_rows;
+};
+
+
+}  // namespace omp
+}  // namespace solver
+
+
+namespace kernels {
+namespace omp {
+namespace {
+
+
+/**
+ * Minimal average number of rows per level and thread for which the
+ * level-set solve is preferred over the sync-free solve. Narrower levels do
+ * not amortize the barrier at the end of each level.
+ */
+constexpr size_type min_rows_per_level_and_thread = 4;
+
+
+/**
+ * Number of consecutive rows assigned to a thread by the sync-free solve.
+ * Small chunks keep the threads close to each other in the dependency chain
+ * while avoiding false sharing on the solution vector.
+ */
+constexpr int sync_free_chunk_size = 8;
+
+
+void init_struct_kernel(std::shared_ptr<const OmpExecutor> exec,
+                        std::shared_ptr<solver::SolveStruct> &solve_struct)
+{
+    solve_struct = std::make_shared<solver::omp::SolveStruct>(exec);
+}
+
+
+template <typename IndexType>
+inline bool is_dependency(IndexType row, IndexType col, bool is_upper)
+{
+    return is_upper ? col > row : col < row;
+}
+
+
+template <typename ValueType, typename IndexType>
+void generate_kernel(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType> *matrix,
+                     solver::SolveStruct *solve_struct, bool is_upper)
+{
+    auto omp_solve_struct =
+        dynamic_cast<solver::omp::SolveStruct *>(solve_struct);
+    if (omp_solve_struct == nullptr) {
+        return;
+    }
+    using algorithm = solver::omp::SolveStruct::algorithm;
+    const auto num_rows = matrix->get_size()[0];
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    if (num_threads == 1 || num_rows == 0) {
+        omp_solve_struct->algo = algorithm::sequential;
+        return;
+    }
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+
+    // the level of a row is one more than the largest level of the rows it
+    // depends on, which are all visited before it in solve order
+    std::vector<size_type> levels(num_rows);
+    size_type num_levels = 0;
+    for (size_type i = 0; i < num_rows; ++i) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        size_type level = 0;
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = col_idxs[k];
+            if (is_dependency(static_cast<IndexType>(row), col, is_upper)) {
+                level = std::max(level, levels[col] + 1);
+            }
+        }
+        levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+
+    omp_solve_struct->algo =
+        num_rows < min_rows_per_level_and_thread * num_threads * num_levels
+            ? algorithm::sync_free
+            : algorithm::level_set;
+    auto &level_ptrs_array = omp_solve_struct->level_ptrs;
+    auto &level_rows_array = omp_solve_struct->level_rows;
+    level_ptrs_array.resize_and_reset(num_levels + 1);
+    level_rows_array.resize_and_reset(num_rows);
+    auto level_ptrs = level_ptrs_array.get_data();
+    auto level_rows = level_rows_array.get_data();
+    std::fill_n(level_ptrs, num_levels + 1, 0);
+    for (size_type row = 0; row < num_rows; ++row) {
+        ++level_ptrs[levels[row] + 1];
+    }
+    std::partial_sum(level_ptrs, level_ptrs + num_levels + 1, level_ptrs);
+    // rows are stored in solve order within each level
+    for (size_type i = 0; i < num_rows; ++i) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        level_rows[level_ptrs[levels[row]]++] = row;
+    }
+    std::copy_backward(level_ptrs, level_ptrs + num_levels,
+                       level_ptrs + num_levels + 1);
+    level_ptrs[0] = 0;
+}
+
+
+template <typename ValueType, typename IndexType, typename WaitFor>
+inline void solve_row(const matrix::Csr<ValueType, IndexType> *matrix,
+                      const matrix::Dense<ValueType> *b,
+                      matrix::Dense<ValueType> *x, size_type row,
+                      bool is_upper, WaitFor wait_for)
+{
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    const auto vals = matrix->get_const_values();
+    const auto diag =
+        is_upper ? vals[row_ptrs[row]] : vals[row_ptrs[row + 1] - 1];
+    const auto num_rhs = b->get_size()[1];
+    for (size_type j = 0; j < num_rhs; ++j) {
+        x->at(row, j) = b->at(row, j) / diag;
+    }
+    for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+        const auto col = col_idxs[k];
+        if (is_dependency(static_cast<IndexType>(row), col, is_upper)) {
+            wait_for(col);
+            for (size_type j = 0; j < num_rhs; ++j) {
+                x->at(row, j) += -vals[k] * x->at(col, j) / diag;
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void solve_kernel(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Csr<ValueType, IndexType> *matrix,
+                  const solver::SolveStruct *solve_struct,
+                  const matrix::Dense<ValueType> *b,
+                  matrix::Dense<ValueType> *x, bool is_upper)
+{
+    using algorithm = solver::omp::SolveStruct::algorithm;
+    const auto num_rows = matrix->get_size()[0];
+    const auto no_wait = [](IndexType) {};
+    auto omp_solve_struct =
+        dynamic_cast<const solver::omp::SolveStruct *>(solve_struct);
+    const auto algo = omp_solve_struct == nullptr ? algorithm::sequential
+                                                  : omp_solve_struct->algo;
+
+    if (algo == algorithm::level_set) {
+        const auto level_ptrs = omp_solve_struct->level_ptrs.get_const_data();
+        const auto level_rows = omp_solve_struct->level_rows.get_const_data();
+        const auto num_levels =
+            omp_solve_struct->level_ptrs.get_num_elems() - 1;
+#pragma omp parallel
+        for (size_type level = 0; level < num_levels; ++level) {
+#pragma omp for
+            for (size_type i = level_ptrs[level]; i < level_ptrs[level + 1];
+                 ++i) {
+                solve_row(matrix, b, x, level_rows[i], is_upper, no_wait);
+            }
+        }
+    } else if (algo == algorithm::sync_free) {
+        // value-initialization clears all completion flags
+        std::vector<std::atomic<bool>> ready(num_rows);
+        const auto wait_for = [&ready](IndexType col) {
+            while (!ready[col].load(std::memory_order_acquire)) {
+            }
+        };
+        // each thread processes its rows in solve order, so the first
+        // unfinished row can always make progress
+#pragma omp parallel for schedule(static, sync_free_chunk_size)
+        for (size_type i = 0; i < num_rows; ++i) {
+            const auto row = is_upper ? num_rows - 1 - i : i;
+            solve_row(matrix, b, x, row, is_upper, wait_for);
+            ready[row].store(true, std::memory_order_release);
+        }
+    } else {
+        for (size_type i = 0; i < num_rows; ++i) {
+            const auto row = is_upper ? num_rows - 1 - i : i;
+            solve_row(matrix, b, x, row, is_upper, no_wait);
+        }
+    }
+}
+
+
+}  // namespace
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/solver/lower_trs_kernels.hpp"
 
 
+#include <complex>
 #include <memory>
 
 
@@ -48,6 +49,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/lower_trs.hpp>
 
 
+#include "omp/solver/common_trs_kernels.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -69,8 +73,7 @@ void should_perform_transpose(std::shared_ptr<const OmpExecutor> exec,
 void init_struct(std::shared_ptr<const OmpExecutor> exec,
                  std::shared_ptr<solver::SolveStruct> &solve_struct)
 {
-    // This init kernel is here to allow initialization of the solve struct for
-    // a more sophisticated implementation as for other executors.
+    init_struct_kernel(exec, solve_struct);
 }
 
 
@@ -79,9 +82,7 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
               const matrix::Csr<ValueType, IndexType> *matrix,
               solver::SolveStruct *solve_struct, const gko::size_type num_rhs)
 {
-    // This generate kernel is here to allow for a more sophisticated
-    // implementation as for other executors. This kernel would perform the
-    // "analysis" phase for the triangular matrix.
+    generate_kernel(exec, matrix, solve_struct, false);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -99,27 +100,127 @@ void solve(std::shared_ptr<const OmpExecutor> exec,
            matrix::Dense<ValueType> *trans_b, matrix::Dense<ValueType> *trans_x,
            const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *x)
 {
-    auto row_ptrs = matrix->get_const_row_ptrs();
-    auto col_idxs = matrix->get_const_col_idxs();
-    auto vals = matrix->get_const_values();
+    solve_kernel(exec, matrix, solve_struct, b, x, false);
+}
 
-#pragma omp parallel for
-    for (size_type j = 0; j < b->get_size()[1]; ++j) {
-        for (size_type row = 0; row < matrix->get_size()[0]; ++row) {
-            x->at(row, j) = b->at(row, j) / vals[row_ptrs[row + 1] - 1];
-            for (size_type k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
-                auto col = col_idxs[k];
-                if (col < row) {
-                    x->at(row, j) +=
-                        -vals[k] * x->at(col, j) / vals[row_ptrs[row + 1] - 1];
-                }
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_LOWER_TRS_SOLVE_KERNEL);
+
+
+namespace {
+
+
+template <typename ValueType>
+inline void atomic_add(ValueType &target, ValueType value)
+{
+#pragma omp atomic
+    target += value;
+}
+
+
+template <typename ValueType>
+inline void atomic_add(std::complex<ValueType> &target,
+                       std::complex<ValueType> value)
+{
+    // std::complex is guaranteed to be laid out as an array of two values
+    auto parts = reinterpret_cast<ValueType *>(&target);
+#pragma omp atomic
+    parts[0] += value.real();
+#pragma omp atomic
+    parts[1] += value.imag();
+}
+
+
+/**
+ * Finishes the entry `row` of the solution of L^H x = b and scatters its
+ * contribution into the entries of the rows it depends on in L^H, i.e. the
+ * columns of row `row` of L left of the diagonal.
+ */
+template <typename ValueType, typename IndexType, typename Scatter>
+inline void solve_conj_transposed_row(
+    const matrix::Csr<ValueType, IndexType> *matrix,
+    matrix::Dense<ValueType> *x, IndexType row, Scatter scatter)
+{
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    const auto vals = matrix->get_const_values();
+    const auto num_rhs = x->get_size()[1];
+    // the diagonal is found by its column index, so the entries of a row
+    // may be stored in any order
+    auto diag = zero<ValueType>();
+    for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+        if (col_idxs[k] == row) {
+            diag = conj(vals[k]);
+        }
+    }
+    for (size_type j = 0; j < num_rhs; ++j) {
+        x->at(row, j) /= diag;
+    }
+    for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+        const auto col = col_idxs[k];
+        if (col < row) {
+            for (size_type j = 0; j < num_rhs; ++j) {
+                scatter(x->at(col, j), -conj(vals[k]) * x->at(row, j));
             }
         }
     }
 }
 
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void solve_conj_transposed(std::shared_ptr<const OmpExecutor> exec,
+                           const matrix::Csr<ValueType, IndexType> *matrix,
+                           const solver::SolveStruct *solve_struct,
+                           const matrix::Dense<ValueType> *b,
+                           matrix::Dense<ValueType> *x)
+{
+    using algorithm = solver::omp::SolveStruct::algorithm;
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto num_rhs = b->get_size()[1];
+    auto omp_solve_struct =
+        dynamic_cast<const solver::omp::SolveStruct *>(solve_struct);
+    const auto algo = omp_solve_struct == nullptr ? algorithm::sequential
+                                                  : omp_solve_struct->algo;
+
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            x->at(row, j) = b->at(row, j);
+        }
+    }
+    if (algo == algorithm::sequential) {
+        const auto add = [](ValueType &target, ValueType value) {
+            target += value;
+        };
+        for (auto row = num_rows - 1; row >= 0; --row) {
+            solve_conj_transposed_row(matrix, x, row, add);
+        }
+        return;
+    }
+    // Row i of L^H depends on row k if L has an entry in row k and column i,
+    // so all dependencies of a row lie in later levels of the solve with L.
+    // Rows of the same level may scatter into the same entry of x.
+    const auto level_ptrs = omp_solve_struct->level_ptrs.get_const_data();
+    const auto level_rows = omp_solve_struct->level_rows.get_const_data();
+    const auto num_levels = omp_solve_struct->level_ptrs.get_num_elems() - 1;
+    const auto add = [](ValueType &target, ValueType value) {
+        atomic_add(target, value);
+    };
+#pragma omp parallel
+    for (auto level = num_levels; level > 0; --level) {
+#pragma omp for
+        for (size_type i = level_ptrs[level - 1]; i < level_ptrs[level]; ++i) {
+            solve_conj_transposed_row(
+                matrix, x, static_cast<IndexType>(level_rows[i]), add);
+        }
+    }
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_LOWER_TRS_SOLVE_KERNEL);
+    GKO_DECLARE_LOWER_TRS_SOLVE_CONJ_TRANSPOSED_KERNEL);
 
 
 }  // namespace lower_trs
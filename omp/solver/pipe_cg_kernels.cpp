@@ -0,0 +1,183 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "omp/components/reduction.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The pipelined CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *r,
+                matrix::Dense<ValueType> *p, matrix::Dense<ValueType> *q,
+                matrix::Dense<ValueType> *s, matrix::Dense<ValueType> *z,
+                matrix::Dense<ValueType> *prev_gamma,
+                matrix::Dense<ValueType> *alpha,
+                Array<stopping_status> *stop_status)
+{
+#pragma omp parallel for
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        prev_gamma->at(j) = zero<ValueType>();
+        alpha->at(j) = one<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+#pragma omp parallel for
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+            p->at(i, j) = q->at(i, j) = zero<ValueType>();
+            s->at(i, j) = z->at(i, j) = zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const OmpExecutor> exec,
+            const matrix::Dense<ValueType> *r,
+            const matrix::Dense<ValueType> *u,
+            const matrix::Dense<ValueType> *w, matrix::Dense<ValueType> *gamma,
+            matrix::Dense<ValueType> *delta,
+            matrix::Dense<ValueType> *residual_norm,
+            Array<ValueType> *reduction_buffer)
+{
+    const auto num_rows = r->get_size()[0];
+    const auto num_cols = r->get_size()[1];
+    // the three reductions share one parallel region and one barrier. The
+    // buffer keeps the partial results followed by the final sums, and is
+    // only enlarged in the first iteration.
+    const auto workspace_size =
+        get_reduction_workspace_size<ValueType>(num_rows, 3 * num_cols);
+    if (reduction_buffer->get_num_elems() < workspace_size + 3 * num_cols) {
+        reduction_buffer->resize_and_reset(workspace_size + 3 * num_cols);
+    }
+    auto partial = Array<ValueType>::view(exec, workspace_size,
+                                          reduction_buffer->get_data());
+    auto sums = reduction_buffer->get_data() + workspace_size;
+    blocked_column_multi_reduction<3>(
+        num_rows, num_cols,
+        [&](size_type row, size_type j, ValueType *sums) {
+            sums[0] += conj(r->at(row, j)) * u->at(row, j);
+            sums[1] += conj(w->at(row, j)) * u->at(row, j);
+            sums[2] += static_cast<ValueType>(squared_norm(r->at(row, j)));
+        },
+        sums, partial);
+    for (size_type j = 0; j < num_cols; ++j) {
+        gamma->at(j) = sums[j];
+        delta->at(j) = sums[num_cols + j];
+        residual_norm->at(j) = sqrt(real(sums[2 * num_cols + j]));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const OmpExecutor> exec,
+            matrix::Dense<ValueType> *x, matrix::Dense<ValueType> *r,
+            matrix::Dense<ValueType> *u, matrix::Dense<ValueType> *w,
+            matrix::Dense<ValueType> *p, matrix::Dense<ValueType> *q,
+            matrix::Dense<ValueType> *s, matrix::Dense<ValueType> *z,
+            const matrix::Dense<ValueType> *m,
+            const matrix::Dense<ValueType> *n,
+            const matrix::Dense<ValueType> *gamma,
+            const matrix::Dense<ValueType> *prev_gamma,
+            const matrix::Dense<ValueType> *delta,
+            matrix::Dense<ValueType> *alpha, matrix::Dense<ValueType> *beta,
+            const Array<stopping_status> *stop_status)
+{
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        auto tmp_beta = zero<ValueType>();
+        auto denom = delta->at(j);
+        if (prev_gamma->at(j) != zero<ValueType>()) {
+            tmp_beta = gamma->at(j) / prev_gamma->at(j);
+            if (alpha->at(j) != zero<ValueType>()) {
+                denom -= tmp_beta * gamma->at(j) / alpha->at(j);
+            }
+        }
+        beta->at(j) = tmp_beta;
+        alpha->at(j) = denom == zero<ValueType>() ? zero<ValueType>()
+                                                  : gamma->at(j) / denom;
+    }
+#pragma omp parallel for
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            const auto tmp_alpha = alpha->at(j);
+            const auto tmp_beta = beta->at(j);
+            z->at(i, j) = n->at(i, j) + tmp_beta * z->at(i, j);
+            q->at(i, j) = m->at(i, j) + tmp_beta * q->at(i, j);
+            s->at(i, j) = w->at(i, j) + tmp_beta * s->at(i, j);
+            p->at(i, j) = u->at(i, j) + tmp_beta * p->at(i, j);
+            x->at(i, j) += tmp_alpha * p->at(i, j);
+            r->at(i, j) -= tmp_alpha * s->at(i, j);
+            u->at(i, j) -= tmp_alpha * q->at(i, j);
+            w->at(i, j) -= tmp_alpha * z->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -48,6 +48,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/upper_trs.hpp>
 
 
+#include "omp/solver/common_trs_kernels.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -69,8 +72,7 @@ void should_perform_transpose(std::shared_ptr<const OmpExecutor> exec,
 void init_struct(std::shared_ptr<const OmpExecutor> exec,
                  std::shared_ptr<solver::SolveStruct> &solve_struct)
 {
-    // This init kernel is here to allow initialization of the solve struct for
-    // a more sophisticated implementation as for other executors.
+    init_struct_kernel(exec, solve_struct);
 }
 
 
@@ -79,9 +81,7 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
               const matrix::Csr<ValueType, IndexType> *matrix,
               solver::SolveStruct *solve_struct, const gko::size_type num_rhs)
 {
-    // This generate kernel is here to allow for a more sophisticated
-    // implementation as for other executors. This kernel would perform the
-    // "analysis" phase for the triangular matrix.
+    generate_kernel(exec, matrix, solve_struct, true);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -99,23 +99,7 @@ void solve(std::shared_ptr<const OmpExecutor> exec,
            matrix::Dense<ValueType> *trans_b, matrix::Dense<ValueType> *trans_x,
            const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *x)
 {
-    auto row_ptrs = matrix->get_const_row_ptrs();
-    auto col_idxs = matrix->get_const_col_idxs();
-    auto vals = matrix->get_const_values();
-
-#pragma omp parallel for
-    for (int j = 0; j < b->get_size()[1]; ++j) {
-        for (int row = matrix->get_size()[0] - 1; row >= 0; --row) {
-            x->at(row, j) = b->at(row, j) / vals[row_ptrs[row]];
-            for (int k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
-                auto col = col_idxs[k];
-                if (col > row) {
-                    x->at(row, j) +=
-                        -vals[k] * x->at(col, j) / vals[row_ptrs[row]];
-                }
-            }
-        }
-    }
+    solve_kernel(exec, matrix, solve_struct, b, x, true);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -0,0 +1,196 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/par_ic_kernels.hpp"
+
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class ParIc : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+
+    ParIc()
+        : ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create()),
+          rand_engine(1337)
+    {}
+
+    void SetUp() override
+    {
+        const gko::size_type num_rows = 123;
+        auto lower = gko::test::generate_random_lower_triangular_matrix<Csr>(
+            num_rows, num_rows, false,
+            std::uniform_int_distribution<>(1, 10),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        mtx_data lower_data;
+        lower->write(lower_data);
+        // A = L + L^T with a dominant diagonal is symmetric positive definite
+        mtx_data data{lower->get_size()};
+        std::vector<value_type> row_sums(num_rows);
+        for (const auto &entry : lower_data.nonzeros) {
+            if (entry.row != entry.column) {
+                data.nonzeros.emplace_back(entry.row, entry.column,
+                                           entry.value);
+                data.nonzeros.emplace_back(entry.column, entry.row,
+                                           entry.value);
+                row_sums[entry.row] += std::abs(entry.value);
+                row_sums[entry.column] += std::abs(entry.value);
+            }
+        }
+        for (gko::size_type row = 0; row < num_rows; ++row) {
+            data.nonzeros.emplace_back(row, row, row_sums[row] + 1.0);
+        }
+        data.ensure_row_major_order();
+        csr_ref = Csr::create(ref);
+        csr_ref->read(data);
+        csr_omp = Csr::create(omp);
+        csr_omp->copy_from(gko::lend(csr_ref));
+    }
+
+    void initialize_l(std::unique_ptr<Csr> &a_lower, std::unique_ptr<Csr> &l,
+                      std::shared_ptr<const gko::Executor> exec,
+                      const Csr *mtx)
+    {
+        const auto size = mtx->get_size();
+        gko::Array<index_type> row_ptrs{exec, size[0] + 1};
+        if (exec == omp) {
+            gko::kernels::omp::par_ic_factorization::initialize_row_ptrs_l(
+                omp, mtx, row_ptrs.get_data());
+        } else {
+            gko::kernels::reference::par_ic_factorization::
+                initialize_row_ptrs_l(ref, mtx, row_ptrs.get_data());
+        }
+        // both executors share the host memory space
+        const auto nnz =
+            static_cast<gko::size_type>(row_ptrs.get_const_data()[size[0]]);
+        a_lower = Csr::create(exec, size, gko::Array<value_type>{exec, nnz},
+                              gko::Array<index_type>{exec, nnz}, row_ptrs);
+        l = Csr::create(exec, size, gko::Array<value_type>{exec, nnz},
+                        gko::Array<index_type>{exec, nnz}, row_ptrs);
+        if (exec == omp) {
+            gko::kernels::omp::par_ic_factorization::initialize_l(
+                omp, mtx, gko::lend(a_lower), false);
+            gko::kernels::omp::par_ic_factorization::initialize_l(
+                omp, mtx, gko::lend(l), true);
+        } else {
+            gko::kernels::reference::par_ic_factorization::initialize_l(
+                ref, mtx, gko::lend(a_lower), false);
+            gko::kernels::reference::par_ic_factorization::initialize_l(
+                ref, mtx, gko::lend(l), true);
+        }
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::ranlux48 rand_engine;
+    std::unique_ptr<Csr> csr_ref;
+    std::unique_ptr<Csr> csr_omp;
+};
+
+
+TEST_F(ParIc, KernelInitializeRowPtrsLIsEquivalentToRef)
+{
+    const auto num_row_ptrs = csr_ref->get_size()[0] + 1;
+    gko::Array<index_type> row_ptrs_ref{ref, num_row_ptrs};
+    gko::Array<index_type> row_ptrs_omp{omp, num_row_ptrs};
+
+    gko::kernels::reference::par_ic_factorization::initialize_row_ptrs_l(
+        ref, gko::lend(csr_ref), row_ptrs_ref.get_data());
+    gko::kernels::omp::par_ic_factorization::initialize_row_ptrs_l(
+        omp, gko::lend(csr_omp), row_ptrs_omp.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(&row_ptrs_ref, &row_ptrs_omp);
+}
+
+
+TEST_F(ParIc, KernelInitializeLIsEquivalentToRef)
+{
+    std::unique_ptr<Csr> a_lower_ref;
+    std::unique_ptr<Csr> l_ref;
+    std::unique_ptr<Csr> a_lower_omp;
+    std::unique_ptr<Csr> l_omp;
+
+    initialize_l(a_lower_ref, l_ref, ref, gko::lend(csr_ref));
+    initialize_l(a_lower_omp, l_omp, omp, gko::lend(csr_omp));
+
+    GKO_ASSERT_MTX_NEAR(a_lower_ref, a_lower_omp, 0);
+    GKO_ASSERT_MTX_NEAR(l_ref, l_omp, 0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_ref, l_omp);
+}
+
+
+TEST_F(ParIc, KernelComputeFactorIsEquivalentToRef)
+{
+    std::unique_ptr<Csr> a_lower_ref;
+    std::unique_ptr<Csr> l_ref;
+    std::unique_ptr<Csr> a_lower_omp;
+    std::unique_ptr<Csr> l_omp;
+    initialize_l(a_lower_ref, l_ref, ref, gko::lend(csr_ref));
+    initialize_l(a_lower_omp, l_omp, omp, gko::lend(csr_omp));
+
+    // the sequential sweep computes the exact IC(0) factor, the parallel
+    // sweeps converge towards it
+    gko::kernels::reference::par_ic_factorization::compute_factor(
+        ref, 1, gko::lend(a_lower_ref), gko::lend(l_ref));
+    gko::kernels::omp::par_ic_factorization::compute_factor(
+        omp, 20, gko::lend(a_lower_omp), gko::lend(l_omp));
+
+    GKO_ASSERT_MTX_NEAR(l_ref, l_omp, 1e-14);
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_ref, l_omp);
+}
+
+
+}  // namespace
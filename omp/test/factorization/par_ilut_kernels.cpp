@@ -0,0 +1,252 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/par_ilut_kernels.hpp"
+
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/par_ilu.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+class ParIlut : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using ParIlu = gko::factorization::ParIlu<value_type, index_type>;
+
+    ParIlut()
+        : ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create())
+    {}
+
+    void SetUp() override
+    {
+        std::string file_name(gko::matrices::location_ani1_mtx);
+        auto input_file = std::ifstream(file_name, std::ios::in);
+        if (!input_file) {
+            FAIL() << "Could not find the file \"" << file_name
+                   << "\", which is required for this test.\n";
+        }
+        csr_ref = gko::read<Csr>(input_file, ref);
+        csr_omp = Csr::create(omp);
+        csr_omp->copy_from(gko::lend(csr_ref));
+        // use ILU(0) factors as a starting point
+        auto factors = ParIlu::build().on(ref)->generate(csr_ref);
+        l_ref = Csr::create(ref);
+        l_ref->copy_from(factors->get_l_factor().get());
+        u_ref = Csr::create(ref);
+        u_ref->copy_from(factors->get_u_factor().get());
+        l_omp = Csr::create(omp);
+        l_omp->copy_from(gko::lend(l_ref));
+        u_omp = Csr::create(omp);
+        u_omp->copy_from(gko::lend(u_ref));
+    }
+
+    std::unique_ptr<Csr> multiply(const Csr *l, const Csr *u)
+    {
+        auto product = Csr::create(l->get_executor(), l->get_size());
+        l->apply(u, gko::lend(product));
+        product->sort_by_column_index();
+        return product;
+    }
+
+    void add_candidates(std::unique_ptr<Csr> &l_new_ref,
+                        std::unique_ptr<Csr> &u_new_ref,
+                        std::unique_ptr<Csr> &l_new_omp,
+                        std::unique_ptr<Csr> &u_new_omp)
+    {
+        auto lu_ref = multiply(gko::lend(l_ref), gko::lend(u_ref));
+        auto lu_omp = multiply(gko::lend(l_omp), gko::lend(u_omp));
+        gko::Array<index_type> l_row_ptrs_ref{ref};
+        gko::Array<index_type> l_col_idxs_ref{ref};
+        gko::Array<value_type> l_vals_ref{ref};
+        gko::Array<index_type> u_row_ptrs_ref{ref};
+        gko::Array<index_type> u_col_idxs_ref{ref};
+        gko::Array<value_type> u_vals_ref{ref};
+        gko::Array<index_type> l_row_ptrs_omp{omp};
+        gko::Array<index_type> l_col_idxs_omp{omp};
+        gko::Array<value_type> l_vals_omp{omp};
+        gko::Array<index_type> u_row_ptrs_omp{omp};
+        gko::Array<index_type> u_col_idxs_omp{omp};
+        gko::Array<value_type> u_vals_omp{omp};
+
+        gko::kernels::reference::par_ilut_factorization::add_candidates(
+            ref, gko::lend(lu_ref), gko::lend(csr_ref), gko::lend(l_ref),
+            gko::lend(u_ref), l_row_ptrs_ref, l_col_idxs_ref, l_vals_ref,
+            u_row_ptrs_ref, u_col_idxs_ref, u_vals_ref);
+        gko::kernels::omp::par_ilut_factorization::add_candidates(
+            omp, gko::lend(lu_omp), gko::lend(csr_omp), gko::lend(l_omp),
+            gko::lend(u_omp), l_row_ptrs_omp, l_col_idxs_omp, l_vals_omp,
+            u_row_ptrs_omp, u_col_idxs_omp, u_vals_omp);
+
+        const auto size = csr_ref->get_size();
+        l_new_ref = Csr::create(ref, size, std::move(l_vals_ref),
+                                std::move(l_col_idxs_ref),
+                                std::move(l_row_ptrs_ref));
+        u_new_ref = Csr::create(ref, size, std::move(u_vals_ref),
+                                std::move(u_col_idxs_ref),
+                                std::move(u_row_ptrs_ref));
+        l_new_omp = Csr::create(omp, size, std::move(l_vals_omp),
+                                std::move(l_col_idxs_omp),
+                                std::move(l_row_ptrs_omp));
+        u_new_omp = Csr::create(omp, size, std::move(u_vals_omp),
+                                std::move(u_col_idxs_omp),
+                                std::move(u_row_ptrs_omp));
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::shared_ptr<Csr> csr_ref;
+    std::shared_ptr<Csr> csr_omp;
+    std::unique_ptr<Csr> l_ref;
+    std::unique_ptr<Csr> u_ref;
+    std::unique_ptr<Csr> l_omp;
+    std::unique_ptr<Csr> u_omp;
+};
+
+
+TEST_F(ParIlut, KernelAddCandidatesIsEquivalentToRef)
+{
+    std::unique_ptr<Csr> l_new_ref{};
+    std::unique_ptr<Csr> u_new_ref{};
+    std::unique_ptr<Csr> l_new_omp{};
+    std::unique_ptr<Csr> u_new_omp{};
+
+    add_candidates(l_new_ref, u_new_ref, l_new_omp, u_new_omp);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_new_ref, l_new_omp);
+    GKO_ASSERT_MTX_EQ_SPARSITY(u_new_ref, u_new_omp);
+    GKO_ASSERT_MTX_NEAR(l_new_ref, l_new_omp, 1e-14);
+    GKO_ASSERT_MTX_NEAR(u_new_ref, u_new_omp, 1e-14);
+}
+
+
+TEST_F(ParIlut, KernelComputeLUIsEquivalentToRef)
+{
+    std::unique_ptr<Csr> l_new_ref{};
+    std::unique_ptr<Csr> u_new_ref{};
+    std::unique_ptr<Csr> l_new_omp{};
+    std::unique_ptr<Csr> u_new_omp{};
+    add_candidates(l_new_ref, u_new_ref, l_new_omp, u_new_omp);
+    auto u_csc_lin_op_ref = u_new_ref->transpose();
+    auto u_csc_lin_op_omp = u_new_omp->transpose();
+    auto u_csc_ref = static_cast<Csr *>(u_csc_lin_op_ref.get());
+    auto u_csc_omp = static_cast<Csr *>(u_csc_lin_op_omp.get());
+
+    // the asynchronous sweeps converge to the same fixed point
+    for (int sweep = 0; sweep < 20; ++sweep) {
+        gko::kernels::reference::par_ilut_factorization::compute_l_u_factors(
+            ref, gko::lend(csr_ref), gko::lend(l_new_ref),
+            gko::lend(u_new_ref), u_csc_ref);
+        gko::kernels::omp::par_ilut_factorization::compute_l_u_factors(
+            omp, gko::lend(csr_omp), gko::lend(l_new_omp),
+            gko::lend(u_new_omp), u_csc_omp);
+    }
+
+    GKO_ASSERT_MTX_NEAR(l_new_ref, l_new_omp, 1e-14);
+    GKO_ASSERT_MTX_NEAR(u_new_ref, u_new_omp, 1e-14);
+    GKO_ASSERT_MTX_NEAR(u_csc_ref, u_csc_omp, 1e-14);
+}
+
+
+TEST_F(ParIlut, KernelThresholdSelectIsEquivalentToRef)
+{
+    const auto rank =
+        static_cast<index_type>(l_ref->get_num_stored_elements() / 3);
+    gko::Array<value_type> tmp_ref{ref};
+    gko::Array<value_type> tmp_omp{omp};
+    gko::remove_complex<value_type> threshold_ref{};
+    gko::remove_complex<value_type> threshold_omp{};
+
+    gko::kernels::reference::par_ilut_factorization::threshold_select(
+        ref, gko::lend(l_ref), rank, tmp_ref, threshold_ref);
+    gko::kernels::omp::par_ilut_factorization::threshold_select(
+        omp, gko::lend(l_omp), rank, tmp_omp, threshold_omp);
+
+    ASSERT_EQ(threshold_ref, threshold_omp);
+}
+
+
+TEST_F(ParIlut, KernelThresholdFilterIsEquivalentToRef)
+{
+    const auto rank =
+        static_cast<index_type>(u_ref->get_num_stored_elements() / 2);
+    gko::Array<value_type> tmp{ref};
+    gko::remove_complex<value_type> threshold{};
+    gko::kernels::reference::par_ilut_factorization::threshold_select(
+        ref, gko::lend(u_ref), rank, tmp, threshold);
+    gko::Array<index_type> row_ptrs_ref{ref};
+    gko::Array<index_type> col_idxs_ref{ref};
+    gko::Array<value_type> vals_ref{ref};
+    gko::Array<index_type> row_ptrs_omp{omp};
+    gko::Array<index_type> col_idxs_omp{omp};
+    gko::Array<value_type> vals_omp{omp};
+
+    gko::kernels::reference::par_ilut_factorization::threshold_filter(
+        ref, gko::lend(csr_ref), gko::lend(u_ref), threshold, 1e-3,
+        row_ptrs_ref, col_idxs_ref, vals_ref);
+    gko::kernels::omp::par_ilut_factorization::threshold_filter(
+        omp, gko::lend(csr_omp), gko::lend(u_omp), threshold, 1e-3,
+        row_ptrs_omp, col_idxs_omp, vals_omp);
+
+    const auto size = csr_ref->get_size();
+    auto filtered_ref =
+        Csr::create(ref, size, std::move(vals_ref), std::move(col_idxs_ref),
+                    std::move(row_ptrs_ref));
+    auto filtered_omp =
+        Csr::create(omp, size, std::move(vals_omp), std::move(col_idxs_omp),
+                    std::move(row_ptrs_omp));
+    GKO_ASSERT_MTX_EQ_SPARSITY(filtered_ref, filtered_omp);
+    GKO_ASSERT_MTX_NEAR(filtered_ref, filtered_omp, 0.);
+}
+
+
+}  // namespace
@@ -47,6 +47,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
@@ -227,6 +229,66 @@ TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRef)
 }
 
 
+TEST_F(Csr, SimpleApplyWithMergePathIsEquivalentToRef)
+{
+    set_up_apply_data();
+    dmtx->set_strategy(std::make_shared<Mtx::merge_path>());
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Csr, AdvancedApplyToDenseMatrixWithMergePathIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+    dmtx->set_strategy(std::make_shared<Mtx::merge_path>());
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Csr, SimpleApplyWithLoadBalanceIsEquivalentToRef)
+{
+    set_up_apply_data();
+    dmtx->set_strategy(std::make_shared<Mtx::load_balance>(2));
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Csr, AdvancedApplyToDenseMatrixWithLoadBalanceIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+    dmtx->set_strategy(std::make_shared<Mtx::load_balance>(2));
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Csr, AdvancedApplyWithAutomaticalIsEquivalentToRef)
+{
+    set_up_apply_data();
+    dmtx->set_strategy(std::make_shared<Mtx::automatical>(2));
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
 TEST_F(Csr, AdvancedApplyToCsrMatrixIsEquivalentToRef)
 {
     set_up_apply_data();
@@ -255,6 +317,77 @@ TEST_F(Csr, SimpleApplyToCsrMatrixIsEquivalentToRef)
 }
 
 
+TEST_F(Csr, SimpleApplyToSparseCsrMatrixIsEquivalentToRef)
+{
+    auto sparse_mtx = gko::test::generate_random_matrix<Mtx>(
+        mtx_size[0], mtx_size[1], std::uniform_int_distribution<>(0, 5),
+        std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    auto sparse_dmtx = Mtx::create(omp);
+    sparse_dmtx->copy_from(sparse_mtx.get());
+    auto trans = sparse_mtx->transpose();
+    auto d_trans = sparse_dmtx->transpose();
+    auto result = Mtx::create(ref, gko::dim<2>{mtx_size[0]});
+    auto dresult = Mtx::create(omp, gko::dim<2>{mtx_size[0]});
+
+    sparse_mtx->apply(trans.get(), result.get());
+    sparse_dmtx->apply(d_trans.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, result, 1e-14);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+}
+
+
+TEST_F(Csr, ApplyToCsrMatrixProducesSortedResult)
+{
+    set_up_apply_data();
+    auto d_trans = dmtx->transpose();
+
+    dmtx->apply(dalpha.get(), d_trans.get(), dbeta.get(), square_dmtx.get());
+
+    ASSERT_TRUE(square_dmtx->is_sorted_by_column_index());
+}
+
+
+TEST_F(Csr, UpdateProductValuesIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto trans = mtx->transpose();
+    auto d_trans = dmtx->transpose();
+    dmtx->apply(d_trans.get(), square_dmtx.get());
+    for (gko::size_type i = 0; i < mtx->get_num_stored_elements(); ++i) {
+        mtx->get_values()[i] += 1.0;
+    }
+    dmtx->copy_from(mtx.get());
+
+    mtx->apply(trans.get(), square_mtx.get());
+    square_dmtx->update_product_values(dmtx.get(),
+                                       gko::as<Mtx>(d_trans.get()));
+
+    GKO_ASSERT_MTX_NEAR(square_dmtx, square_mtx, 1e-14);
+}
+
+
+TEST_F(Csr, UpdateValuesFromPermutedStreamIsEquivalentToRef)
+{
+    set_up_apply_data();
+    gko::matrix_data<> data;
+    mtx->write(data);
+    std::shuffle(data.nonzeros.begin(), data.nonzeros.end(), rand_engine);
+    auto positions = mtx->compute_value_positions(data);
+    auto dpositions = dmtx->compute_value_positions(data);
+    gko::Array<double> values{ref, data.nonzeros.size()};
+    for (gko::size_type i = 0; i < values.get_num_elems(); ++i) {
+        values.get_data()[i] = data.nonzeros[i].value + 1.0;
+    }
+    gko::Array<double> dvalues{omp, values};
+
+    mtx->update_values(values, positions);
+    dmtx->update_values(dvalues, dpositions);
+
+    GKO_ASSERT_MTX_NEAR(dmtx, mtx, 0.0);
+}
+
+
 TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRef)
 {
     set_up_apply_data(3);
@@ -368,6 +501,103 @@ TEST_F(Csr, MoveToSparsityCsrIsEquivalentToRef)
 }
 
 
+TEST_F(Csr, ConvertToEllIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto ell_mtx = gko::matrix::Ell<>::create(ref);
+    auto dell_mtx = gko::matrix::Ell<>::create(omp);
+
+    mtx->convert_to(ell_mtx.get());
+    dmtx->convert_to(dell_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(dell_mtx.get(), ell_mtx.get(), 1e-14);
+}
+
+
+TEST_F(Csr, MoveToEllIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto ell_mtx = gko::matrix::Ell<>::create(ref);
+    auto dell_mtx = gko::matrix::Ell<>::create(omp);
+
+    mtx->move_to(ell_mtx.get());
+    dmtx->move_to(dell_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(dell_mtx.get(), ell_mtx.get(), 1e-14);
+}
+
+
+TEST_F(Csr, ConvertToSellpIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto sellp_mtx = gko::matrix::Sellp<>::create(ref);
+    auto dsellp_mtx = gko::matrix::Sellp<>::create(omp);
+
+    mtx->convert_to(sellp_mtx.get());
+    dmtx->convert_to(dsellp_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(dsellp_mtx.get(), sellp_mtx.get(), 1e-14);
+}
+
+
+TEST_F(Csr, ConvertToSellpWithSliceSizeAndStrideFactorIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto sellp_mtx =
+        gko::matrix::Sellp<>::create(ref, gko::dim<2>{}, 32, 2, 0);
+    auto dsellp_mtx =
+        gko::matrix::Sellp<>::create(omp, gko::dim<2>{}, 32, 2, 0);
+
+    mtx->convert_to(sellp_mtx.get());
+    dmtx->convert_to(dsellp_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(dsellp_mtx.get(), sellp_mtx.get(), 1e-14);
+}
+
+
+TEST_F(Csr, MoveToSellpIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto sellp_mtx = gko::matrix::Sellp<>::create(ref);
+    auto dsellp_mtx = gko::matrix::Sellp<>::create(omp);
+
+    mtx->move_to(sellp_mtx.get());
+    dmtx->move_to(dsellp_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(dsellp_mtx.get(), sellp_mtx.get(), 1e-14);
+}
+
+
+TEST_F(Csr, CalculatesTotalColsIsEquivalentToRef)
+{
+    set_up_apply_data();
+    gko::size_type total_cols;
+    gko::size_type dtotal_cols;
+
+    gko::kernels::reference::csr::calculate_total_cols(ref, mtx.get(),
+                                                       &total_cols, 2, 32);
+    gko::kernels::omp::csr::calculate_total_cols(omp, dmtx.get(),
+                                                 &dtotal_cols, 2, 32);
+
+    ASSERT_EQ(total_cols, dtotal_cols);
+}
+
+
+TEST_F(Csr, CalculatesMaxNnzPerRowIsEquivalentToRef)
+{
+    set_up_apply_data();
+    gko::size_type max_nnz_per_row;
+    gko::size_type dmax_nnz_per_row;
+
+    gko::kernels::reference::csr::calculate_max_nnz_per_row(ref, mtx.get(),
+                                                            &max_nnz_per_row);
+    gko::kernels::omp::csr::calculate_max_nnz_per_row(omp, dmtx.get(),
+                                                      &dmax_nnz_per_row);
+
+    ASSERT_EQ(max_nnz_per_row, dmax_nnz_per_row);
+}
+
+
 TEST_F(Csr, CalculatesNonzerosPerRow)
 {
     set_up_apply_data();
@@ -383,6 +613,20 @@ TEST_F(Csr, CalculatesNonzerosPerRow)
 }
 
 
+TEST_F(Csr, ExtractDiagonalIsEquivalentToRef)
+{
+    set_up_apply_data();
+    gko::Array<double> diag(ref, square_mtx->get_size()[0]);
+    gko::Array<double> ddiag(omp, square_dmtx->get_size()[0]);
+
+    gko::kernels::reference::csr::extract_diagonal(ref, square_mtx.get(),
+                                                   diag);
+    gko::kernels::omp::csr::extract_diagonal(omp, square_dmtx.get(), ddiag);
+
+    GKO_ASSERT_ARRAY_EQ(&diag, &ddiag);
+}
+
+
 TEST_F(Csr, ConvertToHybridIsEquivalentToRef)
 {
     using Hybrid_type = gko::matrix::Hybrid<>;
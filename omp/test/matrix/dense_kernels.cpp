@@ -99,10 +99,11 @@ protected:
     }
 
     void set_up_vector_data(gko::size_type num_vecs,
-                            bool different_alpha = false)
+                            bool different_alpha = false,
+                            gko::size_type num_rows = 1000)
     {
-        x = gen_mtx<Mtx>(1000, num_vecs);
-        y = gen_mtx<Mtx>(1000, num_vecs);
+        x = gen_mtx<Mtx>(num_rows, num_vecs);
+        y = gen_mtx<Mtx>(num_rows, num_vecs);
         if (different_alpha) {
             alpha = gen_mtx<Mtx>(1, num_vecs);
         } else {
@@ -118,12 +119,13 @@ protected:
         dresult = Mtx::create(omp, gko::dim<2>{1, num_vecs});
     }
 
-    void set_up_apply_data()
+    void set_up_apply_data(int num_rows = 40, int num_inner = 25,
+                           int num_cols = 35)
     {
-        x = gen_mtx<Mtx>(40, 25);
-        c_x = gen_mtx<ComplexMtx>(40, 25);
-        y = gen_mtx<Mtx>(25, 35);
-        expected = gen_mtx<Mtx>(40, 35);
+        x = gen_mtx<Mtx>(num_rows, num_inner);
+        c_x = gen_mtx<ComplexMtx>(num_rows, num_inner);
+        y = gen_mtx<Mtx>(num_inner, num_cols);
+        expected = gen_mtx<Mtx>(num_rows, num_cols);
         alpha = gko::initialize<Mtx>({2.0}, ref);
         beta = gko::initialize<Mtx>({-1.0}, ref);
         dx = Mtx::create(omp);
@@ -281,6 +283,62 @@ TEST_F(Dense, ComputesNorm2IsEquivalentToRef)
 }
 
 
+TEST_F(Dense, SingleVectorOmpComputeNorm2IsEquivalentToRef)
+{
+    set_up_vector_data(1);
+
+    x->compute_norm2(expected.get());
+    dx->compute_norm2(dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Dense, LongSingleVectorOmpComputeDotIsEquivalentToRef)
+{
+    set_up_vector_data(1, false, 50000);
+
+    x->compute_dot(y.get(), expected.get());
+    dx->compute_dot(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-12);
+}
+
+
+TEST_F(Dense, LongMultipleVectorOmpComputeDotIsEquivalentToRef)
+{
+    set_up_vector_data(3, false, 50000);
+
+    x->compute_dot(y.get(), expected.get());
+    dx->compute_dot(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-12);
+}
+
+
+TEST_F(Dense, LongSingleVectorOmpComputeNorm2IsEquivalentToRef)
+{
+    set_up_vector_data(1, false, 50000);
+
+    x->compute_norm2(expected.get());
+    dx->compute_norm2(dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-12);
+}
+
+
+TEST_F(Dense, OmpComputeDotIsDeterministic)
+{
+    set_up_vector_data(2, false, 50000);
+    auto dresult2 = Mtx::create(omp, dresult->get_size());
+
+    dx->compute_dot(dy.get(), dresult.get());
+    dx->compute_dot(dy.get(), dresult2.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, dresult2, 0.0);
+}
+
+
 TEST_F(Dense, SimpleApplyIsEquivalentToRef)
 {
     set_up_apply_data();
@@ -303,6 +361,50 @@ TEST_F(Dense, AdvancedApplyIsEquivalentToRef)
 }
 
 
+TEST_F(Dense, SimpleApplyToVectorIsEquivalentToRef)
+{
+    set_up_apply_data(123, 77, 1);
+
+    x->apply(y.get(), expected.get());
+    dx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Dense, AdvancedApplyToNarrowMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(123, 77, 5);
+
+    x->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-14);
+}
+
+
+TEST_F(Dense, SimpleApplyToLargeMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(131, 300, 1030);
+
+    x->apply(y.get(), expected.get());
+    dx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-13);
+}
+
+
+TEST_F(Dense, AdvancedApplyToLargeMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(131, 300, 1030);
+
+    x->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, 1e-13);
+}
+
+
 TEST_F(Dense, ConvertToCooIsEquivalentToRef)
 {
     auto rmtx = gen_mtx<Mtx>(532, 231);
@@ -417,6 +519,73 @@ TEST_F(Dense, MoveToSparsityCsrIsEquivalentToRef)
 }
 
 
+TEST_F(Dense, ConvertSparseMatrixToCooIsEquivalentToRef)
+{
+    auto rmtx = gen_mtx<Mtx>(532, 231, 0);
+    auto omtx = Mtx::create(omp);
+    omtx->copy_from(rmtx.get());
+    auto srmtx = gko::matrix::Coo<>::create(ref);
+    auto somtx = gko::matrix::Coo<>::create(omp);
+
+    rmtx->convert_to(srmtx.get());
+    omtx->convert_to(somtx.get());
+
+    GKO_ASSERT_MTX_NEAR(srmtx, somtx, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(srmtx, somtx);
+}
+
+
+TEST_F(Dense, ConvertSparseMatrixToCsrIsEquivalentToRef)
+{
+    auto rmtx = gen_mtx<Mtx>(532, 231, 0);
+    auto omtx = Mtx::create(omp);
+    omtx->copy_from(rmtx.get());
+    auto srmtx = gko::matrix::Csr<>::create(ref);
+    auto somtx = gko::matrix::Csr<>::create(omp);
+
+    rmtx->convert_to(srmtx.get());
+    omtx->convert_to(somtx.get());
+
+    GKO_ASSERT_MTX_NEAR(srmtx, somtx, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(srmtx, somtx);
+    ASSERT_TRUE(somtx->is_sorted_by_column_index());
+}
+
+
+TEST_F(Dense, ConvertSparseMatrixToSparsityCsrIsEquivalentToRef)
+{
+    auto mtx = gen_mtx<Mtx>(532, 231, 0);
+    auto dmtx = Mtx::create(omp);
+    dmtx->copy_from(mtx.get());
+    auto sparsity_mtx = gko::matrix::SparsityCsr<>::create(ref);
+    auto d_sparsity_mtx = gko::matrix::SparsityCsr<>::create(omp);
+
+    mtx->convert_to(sparsity_mtx.get());
+    dmtx->convert_to(d_sparsity_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(d_sparsity_mtx.get(), sparsity_mtx.get(), 0.0);
+    ASSERT_TRUE(d_sparsity_mtx->is_sorted_by_column_index());
+}
+
+
+TEST_F(Dense, ConvertSparseMatrixToHybridIsEquivalentToRef)
+{
+    auto rmtx = gen_mtx<Mtx>(532, 231, 0);
+    auto omtx = Mtx::create(omp);
+    omtx->copy_from(rmtx.get());
+    auto srmtx = gko::matrix::Hybrid<>::create(
+        ref, std::make_shared<gko::matrix::Hybrid<>::column_limit>(20));
+    auto somtx = gko::matrix::Hybrid<>::create(
+        omp, std::make_shared<gko::matrix::Hybrid<>::column_limit>(20));
+
+    rmtx->convert_to(srmtx.get());
+    omtx->convert_to(somtx.get());
+
+    GKO_ASSERT_MTX_NEAR(srmtx, somtx, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(srmtx, somtx);
+}
+
+
 TEST_F(Dense, ConvertToEllIsEquivalentToRef)
 {
     auto rmtx = gen_mtx<Mtx>(532, 231);
@@ -475,9 +644,7 @@ TEST_F(Dense, ConvertToHybridIsEquivalentToRef)
     somtx->convert_to(domtx.get());
 
     GKO_ASSERT_MTX_NEAR(drmtx, domtx, 1e-14);
-    // Test between `srmtx` and `somtx` may fail due to the OpenMP
-    // implementation not sorting the Coo matrix part.
-    // Therefore, it is not performed.
+    GKO_ASSERT_MTX_NEAR(srmtx, somtx, 1e-14);
     GKO_ASSERT_MTX_NEAR(domtx, omtx, 1e-14);
 }
 
@@ -498,9 +665,6 @@ TEST_F(Dense, MoveToHybridIsEquivalentToRef)
     somtx->move_to(domtx.get());
 
     GKO_ASSERT_MTX_NEAR(drmtx, domtx, 1e-14);
-    // Test between `srmtx` and `somtx` may fail due to the OpenMP
-    // implementation not sorting the Coo matrix part.
-    // Therefore, it is not performed.
     GKO_ASSERT_MTX_NEAR(domtx, omtx, 1e-14);
 }
 
@@ -0,0 +1,229 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/multigrid/pgm_kernels.hpp"
+
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+
+
+#include "core/matrix/csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Pgm : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using MgLevel = gko::multigrid::Pgm<value_type, index_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+
+    Pgm()
+        : ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create()),
+          rand_engine(42),
+          num_rows(237)
+    {}
+
+    void SetUp() override
+    {
+        auto lower = gko::test::generate_random_lower_triangular_matrix<Csr>(
+            num_rows, num_rows, false,
+            std::uniform_int_distribution<>(1, 6),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        mtx_data lower_data;
+        lower->write(lower_data);
+        // symmetric matrix with a dominant diagonal
+        mtx_data data{lower->get_size()};
+        std::vector<value_type> row_sums(num_rows);
+        for (const auto &entry : lower_data.nonzeros) {
+            if (entry.row != entry.column) {
+                data.nonzeros.emplace_back(entry.row, entry.column,
+                                           entry.value);
+                data.nonzeros.emplace_back(entry.column, entry.row,
+                                           entry.value);
+                row_sums[entry.row] += std::abs(entry.value);
+                row_sums[entry.column] += std::abs(entry.value);
+            }
+        }
+        for (gko::size_type row = 0; row < num_rows; ++row) {
+            data.nonzeros.emplace_back(row, row, row_sums[row] + 1.0);
+        }
+        data.ensure_row_major_order();
+        mtx = gko::share(Csr::create(ref));
+        mtx->read(data);
+        d_mtx = gko::share(Csr::create(omp));
+        d_mtx->copy_from(gko::lend(mtx));
+
+        diag = gko::Array<value_type>(ref, num_rows);
+        gko::kernels::reference::csr::extract_diagonal(ref, mtx.get(), diag);
+        d_diag = gko::Array<value_type>(omp, diag);
+        agg = gko::Array<index_type>(ref, num_rows);
+        gko::kernels::reference::pgm::initialize_agg(ref, agg);
+        // aggregate every third unknown with itself to have a mixed state
+        for (gko::size_type row = 0; row < num_rows; row += 3) {
+            agg.get_data()[row] = row;
+        }
+        d_agg = gko::Array<index_type>(omp, agg);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::ranlux48 rand_engine;
+    gko::size_type num_rows;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+    gko::Array<value_type> diag;
+    gko::Array<value_type> d_diag;
+    gko::Array<index_type> agg;
+    gko::Array<index_type> d_agg;
+};
+
+
+TEST_F(Pgm, InitializeAggIsEquivalentToRef)
+{
+    gko::kernels::reference::pgm::initialize_agg(ref, agg);
+    gko::kernels::omp::pgm::initialize_agg(omp, d_agg);
+
+    GKO_ASSERT_ARRAY_EQ(&d_agg, &agg);
+}
+
+
+TEST_F(Pgm, FindStrongestNeighborIsEquivalentToRef)
+{
+    gko::Array<index_type> strongest(ref, num_rows);
+    gko::Array<index_type> d_strongest(omp, num_rows);
+
+    gko::kernels::reference::pgm::find_strongest_neighbor(ref, mtx.get(), diag,
+                                                          agg, strongest);
+    gko::kernels::omp::pgm::find_strongest_neighbor(omp, d_mtx.get(), d_diag,
+                                                    d_agg, d_strongest);
+
+    GKO_ASSERT_ARRAY_EQ(&d_strongest, &strongest);
+}
+
+
+TEST_F(Pgm, MatchEdgeIsEquivalentToRef)
+{
+    gko::Array<index_type> strongest(ref, num_rows);
+    gko::kernels::reference::pgm::find_strongest_neighbor(ref, mtx.get(), diag,
+                                                          agg, strongest);
+    gko::Array<index_type> d_strongest(omp, strongest);
+
+    gko::kernels::reference::pgm::match_edge(ref, strongest, agg);
+    gko::kernels::omp::pgm::match_edge(omp, d_strongest, d_agg);
+
+    GKO_ASSERT_ARRAY_EQ(&d_agg, &agg);
+}
+
+
+TEST_F(Pgm, CountUnaggIsEquivalentToRef)
+{
+    index_type num_unagg{};
+    index_type d_num_unagg{};
+
+    gko::kernels::reference::pgm::count_unagg(ref, agg, &num_unagg);
+    gko::kernels::omp::pgm::count_unagg(omp, d_agg, &d_num_unagg);
+
+    ASSERT_EQ(d_num_unagg, num_unagg);
+}
+
+
+TEST_F(Pgm, AssignToExistAggIsEquivalentToRef)
+{
+    gko::Array<index_type> intermediate(ref, num_rows);
+    gko::Array<index_type> d_intermediate(omp, num_rows);
+
+    gko::kernels::reference::pgm::assign_to_exist_agg(ref, mtx.get(), diag,
+                                                      agg, intermediate);
+    gko::kernels::omp::pgm::assign_to_exist_agg(omp, d_mtx.get(), d_diag,
+                                                d_agg, d_intermediate);
+
+    GKO_ASSERT_ARRAY_EQ(&d_agg, &agg);
+}
+
+
+TEST_F(Pgm, RenumberIsEquivalentToRef)
+{
+    gko::Array<index_type> intermediate(ref, num_rows);
+    gko::kernels::reference::pgm::assign_to_exist_agg(ref, mtx.get(), diag,
+                                                      agg, intermediate);
+    d_agg = agg;
+    index_type num_agg{};
+    index_type d_num_agg{};
+
+    gko::kernels::reference::pgm::renumber(ref, agg, &num_agg);
+    gko::kernels::omp::pgm::renumber(omp, d_agg, &d_num_agg);
+
+    GKO_ASSERT_ARRAY_EQ(&d_agg, &agg);
+    ASSERT_EQ(d_num_agg, num_agg);
+}
+
+
+TEST_F(Pgm, GenerateIsEquivalentToRef)
+{
+    auto factory = MgLevel::build().with_smoothed_prolongation(true);
+
+    auto level_op = factory.on(ref)->generate(mtx);
+    auto d_level_op = factory.on(omp)->generate(d_mtx);
+
+    auto level = static_cast<MgLevel *>(level_op.get());
+    auto d_level = static_cast<MgLevel *>(d_level_op.get());
+    GKO_ASSERT_ARRAY_EQ(&d_level->get_const_agg(), &level->get_const_agg());
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_level->get_prolong_op().get()),
+                        gko::as<Csr>(level->get_prolong_op().get()), 1e-14);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_level->get_coarse_op().get()),
+                        gko::as<Csr>(level->get_coarse_op().get()), 1e-14);
+}
+
+
+}  // namespace
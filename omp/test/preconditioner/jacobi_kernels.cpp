@@ -287,6 +287,51 @@ TEST_F(Jacobi,
 }
 
 
+TEST_F(Jacobi, OmpFindsSameBlocksAsRefInLargeBlockDiagonalMatrix)
+{
+    using data = gko::matrix_data<double, int>;
+    std::ranlux48 engine(42);
+    // some of the diagonal blocks exceed the maximum block size
+    std::uniform_int_distribution<int> block_size_dist(1, 40);
+    data mtx_data;
+    int block_start = 0;
+    while (block_start < 10000) {
+        const auto block_size = block_size_dist(engine);
+        for (int row = 0; row < block_size; ++row) {
+            for (int col = 0; col < block_size; ++col) {
+                mtx_data.nonzeros.emplace_back(block_start + row,
+                                               block_start + col,
+                                               row == col ? 50.0 : 1.0);
+            }
+        }
+        block_start += block_size;
+    }
+    mtx_data.size = gko::dim<2>(block_start, block_start);
+    auto mtx = share(Mtx::create(ref));
+    mtx->read(mtx_data);
+
+    for (auto max_block_size : {1u, 5u, 13u, 32u}) {
+        auto bj = Bj::build()
+                      .with_max_block_size(max_block_size)
+                      .on(ref)
+                      ->generate(mtx);
+        auto d_bj = Bj::build()
+                        .with_max_block_size(max_block_size)
+                        .on(omp)
+                        ->generate(mtx);
+
+        const auto num_blocks = bj->get_num_blocks();
+        ASSERT_EQ(d_bj->get_num_blocks(), num_blocks);
+        const auto ptrs = bj->get_parameters().block_pointers.get_const_data();
+        const auto d_ptrs =
+            d_bj->get_parameters().block_pointers.get_const_data();
+        for (gko::size_type i = 0; i <= num_blocks; ++i) {
+            ASSERT_EQ(d_ptrs[i], ptrs[i]);
+        }
+    }
+}
+
+
 TEST_F(Jacobi, OmpPreconditionerEquivalentToRefWithBlockSize32)
 {
     initialize_data({0, 32, 64, 96, 128}, {}, {}, 32, 100, 110);
@@ -310,6 +355,20 @@ TEST_F(Jacobi, OmpPreconditionerEquivalentToRefWithDifferentBlockSize)
 }
 
 
+TEST_F(Jacobi, OmpPreconditionerEquivalentToRefWithAllBlockSizes)
+{
+    initialize_data({0,   1,   3,   6,   10,  15,  21,  28,  36,  45,  55,
+                     66,  78,  91,  105, 120, 136, 153, 171, 190, 210, 231,
+                     253, 276, 300, 325, 351, 378, 406, 435, 465, 496, 528},
+                    {}, {}, 32, 520, 528);
+
+    auto bj = bj_factory->generate(mtx);
+    auto d_bj = d_bj_factory->generate(mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Bj>(d_bj.get()), gko::as<Bj>(bj.get()), 1e-12);
+}
+
+
 TEST_F(Jacobi, OmpPreconditionerEquivalentToRefWithMPW)
 {
     initialize_data({0, 11, 24, 33, 45, 55, 67, 70, 80, 92, 100}, {}, {}, 13,
@@ -363,6 +422,22 @@ TEST_F(Jacobi, OmpApplyEquivalentToRef)
 }
 
 
+TEST_F(Jacobi, OmpApplyEquivalentToRefWithAllBlockSizes)
+{
+    initialize_data({0,   1,   3,   6,   10,  15,  21,  28,  36,  45,  55,
+                     66,  78,  91,  105, 120, 136, 153, 171, 190, 210, 231,
+                     253, 276, 300, 325, 351, 378, 406, 435, 465, 496, 528},
+                    {}, {}, 32, 520, 528, 3);
+    auto bj = bj_factory->generate(mtx);
+    auto d_bj = d_bj_factory->generate(mtx);
+
+    bj->apply(b.get(), x.get());
+    d_bj->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
 TEST_F(Jacobi, OmpLinearCombinationApplyEquivalentToRef)
 {
     initialize_data({0, 11, 24, 33, 45, 55, 67, 70, 80, 92, 100}, {}, {}, 13,
@@ -381,6 +456,78 @@ TEST_F(Jacobi, OmpLinearCombinationApplyEquivalentToRef)
 }
 
 
+TEST_F(Jacobi, OmpScalarPreconditionerEquivalentToRef)
+{
+    initialize_data({0, 500}, {}, {}, 1, 10, 20);
+
+    auto bj = Bj::build().with_max_block_size(1u).on(ref)->generate(mtx);
+    auto d_bj = Bj::build().with_max_block_size(1u).on(omp)->generate(mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Bj>(d_bj.get()), gko::as<Bj>(bj.get()), 1e-14);
+}
+
+
+TEST_F(Jacobi, OmpScalarApplyToMultipleVectorsEquivalentToRef)
+{
+    initialize_data({0, 500}, {}, {}, 1, 10, 20, 5);
+    auto bj = Bj::build().with_max_block_size(1u).on(ref)->generate(mtx);
+    auto d_bj = Bj::build().with_max_block_size(1u).on(omp)->generate(mtx);
+
+    bj->apply(b.get(), x.get());
+    d_bj->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+TEST_F(Jacobi, OmpScalarLinearCombinationApplyEquivalentToRef)
+{
+    initialize_data({0, 500}, {}, {}, 1, 10, 20, 3);
+    auto alpha = gko::initialize<Vec>({2.0}, ref);
+    auto d_alpha = gko::initialize<Vec>({2.0}, omp);
+    auto beta = gko::initialize<Vec>({-1.0}, ref);
+    auto d_beta = gko::initialize<Vec>({-1.0}, omp);
+    auto bj = Bj::build().with_max_block_size(1u).on(ref)->generate(mtx);
+    auto d_bj = Bj::build().with_max_block_size(1u).on(omp)->generate(mtx);
+
+    bj->apply(alpha.get(), b.get(), beta.get(), x.get());
+    d_bj->apply(d_alpha.get(), d_b.get(), d_beta.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+TEST_F(Jacobi, OmpScalarLinearCombinationApplyWithZeroBetaEquivalentToRef)
+{
+    initialize_data({0, 500}, {}, {}, 1, 10, 20, 3);
+    auto alpha = gko::initialize<Vec>({2.0}, ref);
+    auto d_alpha = gko::initialize<Vec>({2.0}, omp);
+    auto beta = gko::initialize<Vec>({0.0}, ref);
+    auto d_beta = gko::initialize<Vec>({0.0}, omp);
+    auto bj = Bj::build().with_max_block_size(1u).on(ref)->generate(mtx);
+    auto d_bj = Bj::build().with_max_block_size(1u).on(omp)->generate(mtx);
+
+    bj->apply(alpha.get(), b.get(), beta.get(), x.get());
+    d_bj->apply(d_alpha.get(), d_b.get(), d_beta.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+TEST_F(Jacobi, OmpScalarPreconditionerEquivalentToRefInLargeMatrix)
+{
+    initialize_data({0, 10000}, {}, {}, 1, 10, 30, 2);
+
+    auto bj = Bj::build().with_max_block_size(1u).on(ref)->generate(mtx);
+    auto d_bj = Bj::build().with_max_block_size(1u).on(omp)->generate(mtx);
+    bj->apply(b.get(), x.get());
+    d_bj->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Bj>(d_bj.get()), gko::as<Bj>(bj.get()), 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
 TEST_F(Jacobi, OmpApplyToMultipleVectorsEquivalentToRef)
 {
     initialize_data({0, 11, 24, 33, 45, 55, 67, 70, 80, 92, 100}, {}, {}, 13,
@@ -279,15 +279,19 @@ TEST_F(Bicgstab, OmpBicgstabStep2IsEquivalentToRef)
 {
     initialize_data();
 
-    gko::kernels::reference::bicgstab::step_2(ref, r.get(), s.get(), v.get(),
-                                              rho.get(), alpha.get(),
-                                              beta.get(), stop_status.get());
-    gko::kernels::omp::bicgstab::step_2(omp, d_r.get(), d_s.get(), d_v.get(),
-                                        d_rho.get(), d_alpha.get(),
-                                        d_beta.get(), d_stop_status.get());
+    auto s_norm = Mtx::create(ref, rho->get_size());
+    auto d_s_norm = Mtx::create(omp, rho->get_size());
+
+    gko::kernels::reference::bicgstab::step_2(
+        ref, r.get(), s.get(), v.get(), rho.get(), alpha.get(), beta.get(),
+        s_norm.get(), stop_status.get());
+    gko::kernels::omp::bicgstab::step_2(
+        omp, d_r.get(), d_s.get(), d_v.get(), d_rho.get(), d_alpha.get(),
+        d_beta.get(), d_s_norm.get(), d_stop_status.get());
 
     GKO_ASSERT_MTX_NEAR(d_alpha, alpha, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_s, s, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_s_norm, s_norm, 1e-13);
 }
 
 
@@ -295,17 +299,23 @@ TEST_F(Bicgstab, OmpBicgstabStep3IsEquivalentToRef)
 {
     initialize_data();
 
+    auto residual_norm = Mtx::create(ref, rho->get_size());
+    auto d_residual_norm = Mtx::create(omp, rho->get_size());
+
     gko::kernels::reference::bicgstab::step_3(
         ref, x.get(), r.get(), s.get(), t.get(), y.get(), z.get(), alpha.get(),
-        beta.get(), gamma.get(), omega.get(), stop_status.get());
+        beta.get(), gamma.get(), omega.get(), rr.get(), rho.get(),
+        residual_norm.get(), stop_status.get());
     gko::kernels::omp::bicgstab::step_3(
         omp, d_x.get(), d_r.get(), d_s.get(), d_t.get(), d_y.get(), d_z.get(),
-        d_alpha.get(), d_beta.get(), d_gamma.get(), d_omega.get(),
-        d_stop_status.get());
+        d_alpha.get(), d_beta.get(), d_gamma.get(), d_omega.get(), d_rr.get(),
+        d_rho.get(), d_residual_norm.get(), d_stop_status.get());
 
     GKO_ASSERT_MTX_NEAR(d_omega, omega, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_r, r, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_rho, rho, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
 }
 
 
@@ -94,6 +94,9 @@ protected:
         hessenberg = gen_mtx(gko::solver::default_krylov_dim + 1,
                              gko::solver::default_krylov_dim * n);
         hessenberg_iter = gen_mtx(gko::solver::default_krylov_dim + 1, n);
+        projection = gen_mtx(gko::solver::default_krylov_dim + 1, n);
+        reduction_workspace = std::unique_ptr<gko::Array<Mtx::value_type>>(
+            new gko::Array<Mtx::value_type>(ref));
         residual = gen_mtx(m, n);
         residual_norm = gen_mtx(1, n);
         residual_norm_collection =
@@ -128,6 +131,10 @@ protected:
         d_hessenberg->copy_from(hessenberg.get());
         d_hessenberg_iter = Mtx::create(omp);
         d_hessenberg_iter->copy_from(hessenberg_iter.get());
+        d_projection = Mtx::create(omp);
+        d_projection->copy_from(projection.get());
+        d_reduction_workspace = std::unique_ptr<gko::Array<Mtx::value_type>>(
+            new gko::Array<Mtx::value_type>(omp));
         d_residual = Mtx::create(omp);
         d_residual->copy_from(residual.get());
         d_residual_norm = Mtx::create(omp);
@@ -160,6 +167,8 @@ protected:
     std::unique_ptr<Mtx> next_krylov_basis;
     std::unique_ptr<Mtx> hessenberg;
     std::unique_ptr<Mtx> hessenberg_iter;
+    std::unique_ptr<Mtx> projection;
+    std::unique_ptr<gko::Array<Mtx::value_type>> reduction_workspace;
     std::unique_ptr<Mtx> residual;
     std::unique_ptr<Mtx> residual_norm;
     std::unique_ptr<Mtx> residual_norm_collection;
@@ -177,6 +186,8 @@ protected:
     std::unique_ptr<Mtx> d_next_krylov_basis;
     std::unique_ptr<Mtx> d_hessenberg;
     std::unique_ptr<Mtx> d_hessenberg_iter;
+    std::unique_ptr<Mtx> d_projection;
+    std::unique_ptr<gko::Array<Mtx::value_type>> d_reduction_workspace;
     std::unique_ptr<Mtx> d_residual;
     std::unique_ptr<Mtx> d_residual_norm;
     std::unique_ptr<Mtx> d_residual_norm_collection;
@@ -232,17 +243,19 @@ TEST_F(Gmres, OmpGmresStep1IsEquivalentToRef)
 {
     initialize_data();
     int iter = 5;
+    const auto ortho = gko::solver::gmres::ortho_method::mgs;
 
     gko::kernels::reference::gmres::step_1(
         ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
         residual_norm.get(), residual_norm_collection.get(), krylov_bases.get(),
-        hessenberg_iter.get(), b_norm.get(), iter, final_iter_nums.get(),
-        stop_status.get());
+        hessenberg_iter.get(), projection.get(), reduction_workspace.get(),
+        b_norm.get(), iter, final_iter_nums.get(), stop_status.get(), ortho);
     gko::kernels::omp::gmres::step_1(
         omp, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
         d_residual_norm.get(), d_residual_norm_collection.get(),
-        d_krylov_bases.get(), d_hessenberg_iter.get(), d_b_norm.get(), iter,
-        d_final_iter_nums.get(), d_stop_status.get());
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
 
     GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-14);
     GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-14);
@@ -256,6 +269,92 @@ TEST_F(Gmres, OmpGmresStep1IsEquivalentToRef)
 }
 
 
+TEST_F(Gmres, OmpGmresStep1WithCgsIsEquivalentToRef)
+{
+    initialize_data();
+    int iter = 5;
+    const auto ortho = gko::solver::gmres::ortho_method::cgs;
+
+    gko::kernels::reference::gmres::step_1(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(), krylov_bases.get(),
+        hessenberg_iter.get(), projection.get(), reduction_workspace.get(),
+        b_norm.get(), iter, final_iter_nums.get(), stop_status.get(), ortho);
+    gko::kernels::omp::gmres::step_1(
+        omp, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
+
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-13);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_krylov_bases, krylov_bases, 1e-13);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
+TEST_F(Gmres, OmpGmresStep1WithCgs2IsEquivalentToRef)
+{
+    initialize_data();
+    int iter = 5;
+    const auto ortho = gko::solver::gmres::ortho_method::cgs2;
+
+    gko::kernels::reference::gmres::step_1(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(), krylov_bases.get(),
+        hessenberg_iter.get(), projection.get(), reduction_workspace.get(),
+        b_norm.get(), iter, final_iter_nums.get(), stop_status.get(), ortho);
+    gko::kernels::omp::gmres::step_1(
+        omp, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
+
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-13);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_krylov_bases, krylov_bases, 1e-13);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
+TEST_F(Gmres, OmpGmresStep1WithCgs2ReusesReductionWorkspace)
+{
+    initialize_data();
+    const auto ortho = gko::solver::gmres::ortho_method::cgs2;
+    gko::kernels::omp::gmres::step_1(
+        omp, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_krylov_bases.get(), d_hessenberg_iter.get(), d_projection.get(),
+        d_reduction_workspace.get(), d_b_norm.get(), 0,
+        d_final_iter_nums.get(), d_stop_status.get(), ortho);
+    const auto data = d_reduction_workspace->get_const_data();
+
+    for (gko::size_type iter = 1; iter < 10; ++iter) {
+        gko::kernels::omp::gmres::step_1(
+            omp, d_next_krylov_basis.get(), d_givens_sin.get(),
+            d_givens_cos.get(), d_residual_norm.get(),
+            d_residual_norm_collection.get(), d_krylov_bases.get(),
+            d_hessenberg_iter.get(), d_projection.get(),
+            d_reduction_workspace.get(), d_b_norm.get(), iter,
+            d_final_iter_nums.get(), d_stop_status.get(), ortho);
+    }
+
+    ASSERT_EQ(d_reduction_workspace->get_const_data(), data);
+}
+
+
 TEST_F(Gmres, OmpGmresStep2IsEquivalentToRef)
 {
     initialize_data();
@@ -274,4 +373,67 @@ TEST_F(Gmres, OmpGmresStep2IsEquivalentToRef)
 }
 
 
+TEST_F(Gmres, OmpGmresCompressedStepsAreEquivalentToRef)
+{
+    initialize_data();
+    const auto storage_prec = gko::precision_reduction(0, 1);
+    const auto num_rows = next_krylov_basis->get_size()[0];
+    const auto num_rhs = next_krylov_basis->get_size()[1];
+    // float storage needs half the number of double values
+    const auto storage_size =
+        (krylov_bases->get_num_stored_elements() + 1) / 2;
+    gko::Array<Mtx::value_type> compressed_bases(ref, storage_size);
+    gko::Array<Mtx::value_type> d_compressed_bases(omp, storage_size);
+
+    gko::kernels::reference::gmres::initialize_2_compressed(
+        ref, residual.get(), residual_norm.get(),
+        residual_norm_collection.get(), next_krylov_basis.get(),
+        &compressed_bases, storage_prec, final_iter_nums.get(),
+        gko::solver::default_krylov_dim);
+    gko::kernels::omp::gmres::initialize_2_compressed(
+        omp, d_residual.get(), d_residual_norm.get(),
+        d_residual_norm_collection.get(), d_next_krylov_basis.get(),
+        &d_compressed_bases, storage_prec, d_final_iter_nums.get(),
+        gko::solver::default_krylov_dim);
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-14);
+    for (gko::size_type iter = 0; iter < 3; ++iter) {
+        next_krylov_basis = gen_mtx(num_rows, num_rhs);
+        d_next_krylov_basis->copy_from(next_krylov_basis.get());
+        gko::kernels::reference::gmres::step_1_compressed(
+            ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+            residual_norm.get(), residual_norm_collection.get(),
+            &compressed_bases, storage_prec, hessenberg_iter.get(),
+            projection.get(), reduction_workspace.get(), b_norm.get(), iter,
+            gko::solver::default_krylov_dim, final_iter_nums.get(),
+            stop_status.get(), gko::solver::gmres::ortho_method::mgs);
+        gko::kernels::omp::gmres::step_1_compressed(
+            omp, d_next_krylov_basis.get(), d_givens_sin.get(),
+            d_givens_cos.get(), d_residual_norm.get(),
+            d_residual_norm_collection.get(), &d_compressed_bases,
+            storage_prec, d_hessenberg_iter.get(), d_projection.get(),
+            d_reduction_workspace.get(), d_b_norm.get(), iter,
+            gko::solver::default_krylov_dim, d_final_iter_nums.get(),
+            d_stop_status.get(), gko::solver::gmres::ortho_method::mgs);
+    }
+    gko::kernels::reference::gmres::step_2_compressed(
+        ref, residual_norm_collection.get(), &compressed_bases, storage_prec,
+        hessenberg.get(), y.get(), before_preconditioner.get(),
+        final_iter_nums.get(), gko::solver::default_krylov_dim);
+    gko::kernels::omp::gmres::step_2_compressed(
+        omp, d_residual_norm_collection.get(), &d_compressed_bases,
+        storage_prec, d_hessenberg.get(), d_y.get(),
+        d_before_preconditioner.get(), d_final_iter_nums.get(),
+        gko::solver::default_krylov_dim);
+
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-13);
+    GKO_ASSERT_MTX_NEAR(d_y, y, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_before_preconditioner, before_preconditioner,
+                        1e-13);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
 }  // namespace
@@ -37,6 +37,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <random>
 
 
+#include <omp.h>
+
+
 #include <gtest/gtest.h>
 
 
@@ -81,15 +84,16 @@ protected:
             std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
     }
 
-    std::shared_ptr<Mtx> gen_l_mtx(int num_rows, int num_cols)
+    std::shared_ptr<Mtx> gen_l_mtx(int num_rows, int num_cols,
+                                  int min_nnz_row, int max_nnz_row)
     {
         return gko::test::generate_random_lower_triangular_matrix<Mtx>(
             num_rows, num_cols, false,
-            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::uniform_int_distribution<>(min_nnz_row, max_nnz_row),
             std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
     }
 
-    void initialize_data(int m, int n)
+    void initialize_data(int m, int n, int max_nnz_row = -1)
     {
         b = gen_mtx(m, n);
         x = gen_mtx(m, n);
@@ -105,7 +109,8 @@ protected:
         dt_b->copy_from(b.get());
         dt_x = Mtx::create(omp);
         dt_x->copy_from(x.get());
-        mat = gen_l_mtx(m, m);
+        mat = max_nnz_row < 0 ? gen_l_mtx(m, m, m, m)
+                              : gen_l_mtx(m, m, 1, max_nnz_row);
         csr_mat = CsrMtx::create(ref);
         mat->convert_to(csr_mat.get());
         d_mat = Mtx::create(omp);
@@ -181,6 +186,39 @@ TEST_F(LowerTrs, OmpLowerTrsSolveIsEquivalentToRef)
 }
 
 
+TEST_F(LowerTrs, OmpLowerTrsSolveConjTransposedIsEquivalentToRef)
+{
+    initialize_data(59, 43);
+
+    gko::kernels::reference::lower_trs::solve_conj_transposed(
+        ref, csr_mat.get(), solve_struct_ref.get(), b.get(), x.get());
+    gko::kernels::omp::lower_trs::solve_conj_transposed(
+        omp, d_csr_mat.get(), solve_struct_omp.get(), d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+}
+
+
+TEST_F(LowerTrs, OmpLowerTrsSolveConjTransposedWithLevelsIsEquivalentToRef)
+{
+    initialize_data(1000, 3, 5);
+    // the analysis only stores levels if more than one thread is used
+    const auto prev_num_threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+    gko::kernels::omp::lower_trs::init_struct(omp, solve_struct_omp);
+    gko::kernels::omp::lower_trs::generate(omp, d_csr_mat.get(),
+                                           solve_struct_omp.get(), 3);
+
+    gko::kernels::reference::lower_trs::solve_conj_transposed(
+        ref, csr_mat.get(), solve_struct_ref.get(), b.get(), x.get());
+    gko::kernels::omp::lower_trs::solve_conj_transposed(
+        omp, d_csr_mat.get(), solve_struct_omp.get(), d_b.get(), d_x.get());
+    omp_set_num_threads(prev_num_threads);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
 TEST_F(LowerTrs, ApplyIsEquivalentToRef)
 {
     initialize_data(59, 3);
@@ -196,4 +234,34 @@ TEST_F(LowerTrs, ApplyIsEquivalentToRef)
 }
 
 
+TEST_F(LowerTrs, ApplyWithSparseMatrixIsEquivalentToRef)
+{
+    initialize_data(1000, 1, 5);
+    auto lower_trs_factory = gko::solver::LowerTrs<>::build().on(ref);
+    auto d_lower_trs_factory = gko::solver::LowerTrs<>::build().on(omp);
+    auto solver = lower_trs_factory->generate(csr_mat);
+    auto d_solver = d_lower_trs_factory->generate(d_csr_mat);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+}
+
+
+TEST_F(LowerTrs, ApplyToMultipleVectorsWithSparseMatrixIsEquivalentToRef)
+{
+    initialize_data(1000, 3, 5);
+    auto lower_trs_factory = gko::solver::LowerTrs<>::build().on(ref);
+    auto d_lower_trs_factory = gko::solver::LowerTrs<>::build().on(omp);
+    auto solver = lower_trs_factory->generate(csr_mat);
+    auto d_solver = d_lower_trs_factory->generate(d_csr_mat);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+}
+
+
 }  // namespace
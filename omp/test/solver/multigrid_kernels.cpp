@@ -0,0 +1,142 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/multigrid.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <random>
+
+
+#include <core/solver/multigrid_kernels.hpp>
+#include <core/test/utils.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+namespace {
+
+
+class Multigrid : public ::testing::Test {
+protected:
+    using Mtx = gko::matrix::Dense<>;
+    using Csr = gko::matrix::Csr<>;
+    Multigrid() : rand_engine(30) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    std::unique_ptr<Mtx> gen_mtx(int num_rows, int num_cols)
+    {
+        return gko::test::generate_random_matrix<Mtx>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    // 3-point stencil of the 1D Laplacian
+    std::unique_ptr<Csr> gen_laplacian(int num_rows)
+    {
+        gko::matrix_data<> data{gko::dim<2>(num_rows, num_rows)};
+        for (int row = 0; row < num_rows; ++row) {
+            if (row > 0) {
+                data.nonzeros.emplace_back(row, row - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(row, row, 2.0);
+            if (row < num_rows - 1) {
+                data.nonzeros.emplace_back(row, row + 1, -1.0);
+            }
+        }
+        auto mtx = Csr::create(ref);
+        mtx->read(data);
+        return mtx;
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::ranlux48 rand_engine;
+};
+
+
+TEST_F(Multigrid, FillZeroIsEquivalentToRef)
+{
+    auto x = gen_mtx(43, 3);
+    auto d_x = clone(omp, x);
+
+    gko::kernels::reference::multigrid::fill_zero(ref, x.get());
+    gko::kernels::omp::multigrid::fill_zero(omp, d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 0.0);
+}
+
+
+TEST_F(Multigrid, ApplyIsEquivalentToRef)
+{
+    auto mtx = gko::share(gen_laplacian(200));
+    auto x = gen_mtx(200, 3);
+    auto b = gen_mtx(200, 3);
+    auto d_mtx = gko::share(clone(omp, mtx));
+    auto d_x = clone(omp, x);
+    auto d_b = clone(omp, b);
+    auto mg_factory =
+        gko::solver::Multigrid<>::build()
+            .with_min_coarse_rows(8u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(ref))
+            .on(ref);
+    auto d_mg_factory =
+        gko::solver::Multigrid<>::build()
+            .with_min_coarse_rows(8u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(omp))
+            .on(omp);
+    auto solver = mg_factory->generate(mtx);
+    auto d_solver = d_mg_factory->generate(d_mtx);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+}  // namespace
@@ -0,0 +1,326 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/pipe_cg.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <random>
+
+
+#include <core/solver/pipe_cg_kernels.hpp>
+#include <core/test/utils.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm_reduction.hpp>
+
+namespace {
+
+
+class PipeCg : public ::testing::Test {
+protected:
+    using Mtx = gko::matrix::Dense<>;
+    PipeCg() : rand_engine(30) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    void TearDown()
+    {
+        if (omp != nullptr) {
+            ASSERT_NO_THROW(omp->synchronize());
+        }
+    }
+
+    std::unique_ptr<Mtx> gen_mtx(int num_rows, int num_cols)
+    {
+        return gko::test::generate_random_matrix<Mtx>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void initialize_data()
+    {
+        int num_rows = 597;
+        int num_cols = 43;
+        b = gen_mtx(num_rows, num_cols);
+        r = gen_mtx(num_rows, num_cols);
+        u = gen_mtx(num_rows, num_cols);
+        w = gen_mtx(num_rows, num_cols);
+        m = gen_mtx(num_rows, num_cols);
+        n = gen_mtx(num_rows, num_cols);
+        p = gen_mtx(num_rows, num_cols);
+        q = gen_mtx(num_rows, num_cols);
+        s = gen_mtx(num_rows, num_cols);
+        z = gen_mtx(num_rows, num_cols);
+        x = gen_mtx(num_rows, num_cols);
+        gamma = gen_mtx(1, num_cols);
+        prev_gamma = gen_mtx(1, num_cols);
+        delta = gen_mtx(1, num_cols);
+        alpha = gen_mtx(1, num_cols);
+        beta = gen_mtx(1, num_cols);
+        residual_norm = gen_mtx(1, num_cols);
+        stop_status = std::unique_ptr<gko::Array<gko::stopping_status>>(
+            new gko::Array<gko::stopping_status>(ref, num_cols));
+        for (size_t i = 0; i < stop_status->get_num_elems(); ++i) {
+            stop_status->get_data()[i].reset();
+        }
+        // check that stopped columns are left untouched
+        stop_status->get_data()[1].stop(1);
+
+        d_b = Mtx::create(omp);
+        d_b->copy_from(b.get());
+        d_r = Mtx::create(omp);
+        d_r->copy_from(r.get());
+        d_u = Mtx::create(omp);
+        d_u->copy_from(u.get());
+        d_w = Mtx::create(omp);
+        d_w->copy_from(w.get());
+        d_m = Mtx::create(omp);
+        d_m->copy_from(m.get());
+        d_n = Mtx::create(omp);
+        d_n->copy_from(n.get());
+        d_p = Mtx::create(omp);
+        d_p->copy_from(p.get());
+        d_q = Mtx::create(omp);
+        d_q->copy_from(q.get());
+        d_s = Mtx::create(omp);
+        d_s->copy_from(s.get());
+        d_z = Mtx::create(omp);
+        d_z->copy_from(z.get());
+        d_x = Mtx::create(omp);
+        d_x->copy_from(x.get());
+        d_gamma = Mtx::create(omp);
+        d_gamma->copy_from(gamma.get());
+        d_prev_gamma = Mtx::create(omp);
+        d_prev_gamma->copy_from(prev_gamma.get());
+        d_delta = Mtx::create(omp);
+        d_delta->copy_from(delta.get());
+        d_alpha = Mtx::create(omp);
+        d_alpha->copy_from(alpha.get());
+        d_beta = Mtx::create(omp);
+        d_beta->copy_from(beta.get());
+        d_residual_norm = Mtx::create(omp);
+        d_residual_norm->copy_from(residual_norm.get());
+        d_stop_status = std::unique_ptr<gko::Array<gko::stopping_status>>(
+            new gko::Array<gko::stopping_status>(omp, num_cols));
+        *d_stop_status = *stop_status;
+    }
+
+    void make_symetric(Mtx *mtx)
+    {
+        for (int i = 0; i < mtx->get_size()[0]; ++i) {
+            for (int j = i + 1; j < mtx->get_size()[1]; ++j) {
+                mtx->at(i, j) = mtx->at(j, i);
+            }
+        }
+    }
+
+    void make_diag_dominant(Mtx *mtx)
+    {
+        using std::abs;
+        for (int i = 0; i < mtx->get_size()[0]; ++i) {
+            auto sum = gko::zero<Mtx::value_type>();
+            for (int j = 0; j < mtx->get_size()[1]; ++j) {
+                sum += abs(mtx->at(i, j));
+            }
+            mtx->at(i, i) = sum;
+        }
+    }
+
+    void make_spd(Mtx *mtx)
+    {
+        make_symetric(mtx);
+        make_diag_dominant(mtx);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::ranlux48 rand_engine;
+
+    std::unique_ptr<Mtx> b;
+    std::unique_ptr<Mtx> r;
+    std::unique_ptr<Mtx> u;
+    std::unique_ptr<Mtx> w;
+    std::unique_ptr<Mtx> m;
+    std::unique_ptr<Mtx> n;
+    std::unique_ptr<Mtx> p;
+    std::unique_ptr<Mtx> q;
+    std::unique_ptr<Mtx> s;
+    std::unique_ptr<Mtx> z;
+    std::unique_ptr<Mtx> x;
+    std::unique_ptr<Mtx> gamma;
+    std::unique_ptr<Mtx> prev_gamma;
+    std::unique_ptr<Mtx> delta;
+    std::unique_ptr<Mtx> alpha;
+    std::unique_ptr<Mtx> beta;
+    std::unique_ptr<Mtx> residual_norm;
+    std::unique_ptr<gko::Array<gko::stopping_status>> stop_status;
+
+    std::unique_ptr<Mtx> d_b;
+    std::unique_ptr<Mtx> d_r;
+    std::unique_ptr<Mtx> d_u;
+    std::unique_ptr<Mtx> d_w;
+    std::unique_ptr<Mtx> d_m;
+    std::unique_ptr<Mtx> d_n;
+    std::unique_ptr<Mtx> d_p;
+    std::unique_ptr<Mtx> d_q;
+    std::unique_ptr<Mtx> d_s;
+    std::unique_ptr<Mtx> d_z;
+    std::unique_ptr<Mtx> d_x;
+    std::unique_ptr<Mtx> d_gamma;
+    std::unique_ptr<Mtx> d_prev_gamma;
+    std::unique_ptr<Mtx> d_delta;
+    std::unique_ptr<Mtx> d_alpha;
+    std::unique_ptr<Mtx> d_beta;
+    std::unique_ptr<Mtx> d_residual_norm;
+    std::unique_ptr<gko::Array<gko::stopping_status>> d_stop_status;
+};
+
+
+TEST_F(PipeCg, OmpPipeCgInitializeIsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::pipe_cg::initialize(
+        ref, b.get(), r.get(), p.get(), q.get(), s.get(), z.get(),
+        prev_gamma.get(), alpha.get(), stop_status.get());
+    gko::kernels::omp::pipe_cg::initialize(
+        omp, d_b.get(), d_r.get(), d_p.get(), d_q.get(), d_s.get(), d_z.get(),
+        d_prev_gamma.get(), d_alpha.get(), d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_r, r, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_p, p, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_q, q, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_s, s, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_z, z, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_prev_gamma, prev_gamma, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_alpha, alpha, 1e-14);
+    GKO_ASSERT_ARRAY_EQ(d_stop_status, stop_status);
+}
+
+
+TEST_F(PipeCg, OmpPipeCgStep1IsEquivalentToRef)
+{
+    initialize_data();
+    gko::Array<Mtx::value_type> buffer(ref);
+    gko::Array<Mtx::value_type> d_buffer(omp);
+
+    gko::kernels::reference::pipe_cg::step_1(ref, r.get(), u.get(), w.get(),
+                                             gamma.get(), delta.get(),
+                                             residual_norm.get(), &buffer);
+    gko::kernels::omp::pipe_cg::step_1(omp, d_r.get(), d_u.get(), d_w.get(),
+                                       d_gamma.get(), d_delta.get(),
+                                       d_residual_norm.get(), &d_buffer);
+
+    GKO_ASSERT_MTX_NEAR(d_gamma, gamma, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_delta, delta, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-13);
+}
+
+
+TEST_F(PipeCg, OmpPipeCgStep2IsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::pipe_cg::step_2(
+        ref, x.get(), r.get(), u.get(), w.get(), p.get(), q.get(), s.get(),
+        z.get(), m.get(), n.get(), gamma.get(), prev_gamma.get(), delta.get(),
+        alpha.get(), beta.get(), stop_status.get());
+    gko::kernels::omp::pipe_cg::step_2(
+        omp, d_x.get(), d_r.get(), d_u.get(), d_w.get(), d_p.get(), d_q.get(),
+        d_s.get(), d_z.get(), d_m.get(), d_n.get(), d_gamma.get(),
+        d_prev_gamma.get(), d_delta.get(), d_alpha.get(), d_beta.get(),
+        d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_r, r, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_u, u, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_w, w, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_p, p, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_q, q, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_s, s, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_z, z, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_alpha, alpha, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_beta, beta, 1e-14);
+}
+
+
+TEST_F(PipeCg, ApplyIsEquivalentToRef)
+{
+    auto mtx = gen_mtx(50, 50);
+    make_spd(mtx.get());
+    auto x = gen_mtx(50, 3);
+    auto b = gen_mtx(50, 3);
+    auto d_mtx = Mtx::create(omp);
+    d_mtx->copy_from(mtx.get());
+    auto d_x = Mtx::create(omp);
+    d_x->copy_from(x.get());
+    auto d_b = Mtx::create(omp);
+    d_b->copy_from(b.get());
+    auto pipe_cg_factory =
+        gko::solver::PipeCg<>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u).on(ref),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-14)
+                    .on(ref))
+            .on(ref);
+    auto d_pipe_cg_factory =
+        gko::solver::PipeCg<>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u).on(omp),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-14)
+                    .on(omp))
+            .on(omp);
+    auto solver = pipe_cg_factory->generate(std::move(mtx));
+    auto d_solver = d_pipe_cg_factory->generate(std::move(d_mtx));
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-13);
+}
+
+
+}  // namespace
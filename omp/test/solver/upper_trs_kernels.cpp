@@ -81,15 +81,16 @@ protected:
             std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
     }
 
-    std::shared_ptr<Mtx> gen_u_mtx(int num_rows, int num_cols)
+    std::shared_ptr<Mtx> gen_u_mtx(int num_rows, int num_cols,
+                                  int min_nnz_row, int max_nnz_row)
     {
         return gko::test::generate_random_upper_triangular_matrix<Mtx>(
             num_rows, num_cols, false,
-            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::uniform_int_distribution<>(min_nnz_row, max_nnz_row),
             std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
     }
 
-    void initialize_data(int m, int n)
+    void initialize_data(int m, int n, int max_nnz_row = -1)
     {
         b = gen_mtx(m, n);
         x = gen_mtx(m, n);
@@ -105,7 +106,8 @@ protected:
         dt_b->copy_from(b.get());
         dt_x = Mtx::create(omp);
         dt_x->copy_from(x.get());
-        mat = gen_u_mtx(m, m);
+        mat = max_nnz_row < 0 ? gen_u_mtx(m, m, m, m)
+                              : gen_u_mtx(m, m, 1, max_nnz_row);
         csr_mat = CsrMtx::create(ref);
         mat->convert_to(csr_mat.get());
         d_mat = Mtx::create(omp);
@@ -195,4 +197,34 @@ TEST_F(UpperTrs, ApplyIsEquivalentToRef)
 }
 
 
+TEST_F(UpperTrs, ApplyWithSparseMatrixIsEquivalentToRef)
+{
+    initialize_data(1000, 1, 5);
+    auto upper_trs_factory = gko::solver::UpperTrs<>::build().on(ref);
+    auto d_upper_trs_factory = gko::solver::UpperTrs<>::build().on(omp);
+    auto solver = upper_trs_factory->generate(csr_mat);
+    auto d_solver = d_upper_trs_factory->generate(d_csr_mat);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+}
+
+
+TEST_F(UpperTrs, ApplyToMultipleVectorsWithSparseMatrixIsEquivalentToRef)
+{
+    initialize_data(1000, 3, 5);
+    auto upper_trs_factory = gko::solver::UpperTrs<>::build().on(ref);
+    auto d_upper_trs_factory = gko::solver::UpperTrs<>::build().on(omp);
+    auto solver = upper_trs_factory->generate(csr_mat);
+    auto d_solver = d_upper_trs_factory->generate(d_csr_mat);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+}
+
+
 }  // namespace
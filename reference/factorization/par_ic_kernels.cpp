@@ -0,0 +1,171 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/par_ic_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The parallel ic factorization namespace.
+ *
+ * @ingroup factor
+ */
+namespace par_ic_factorization {
+
+
+template <typename ValueType, typename IndexType>
+void initialize_row_ptrs_l(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::Csr<ValueType, IndexType> *system_matrix,
+    IndexType *l_row_ptrs)
+{
+    auto row_ptrs = system_matrix->get_const_row_ptrs();
+    auto col_idxs = system_matrix->get_const_col_idxs();
+    size_type l_nnz{};
+
+    l_row_ptrs[0] = 0;
+    for (size_type row = 0; row < system_matrix->get_size()[0]; ++row) {
+        bool has_diagonal{};
+        for (size_type el = row_ptrs[row]; el < row_ptrs[row + 1]; ++el) {
+            size_type col = col_idxs[el];
+            if (col <= row) {
+                ++l_nnz;
+            }
+            has_diagonal |= col == row;
+        }
+        l_nnz += !has_diagonal;
+        l_row_ptrs[row + 1] = l_nnz;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_IC_INITIALIZE_ROW_PTRS_L_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void initialize_l(std::shared_ptr<const ReferenceExecutor> exec,
+                  const matrix::Csr<ValueType, IndexType> *system_matrix,
+                  matrix::Csr<ValueType, IndexType> *csr_l, bool diag_sqrt)
+{
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto vals = system_matrix->get_const_values();
+
+    const auto row_ptrs_l = csr_l->get_const_row_ptrs();
+    auto col_idxs_l = csr_l->get_col_idxs();
+    auto vals_l = csr_l->get_values();
+
+    for (size_type row = 0; row < system_matrix->get_size()[0]; ++row) {
+        size_type current_index_l = row_ptrs_l[row];
+        // if there is no diagonal entry, set it to one
+        auto diag_val = one<ValueType>();
+        for (size_type el = row_ptrs[row]; el < row_ptrs[row + 1]; ++el) {
+            const auto col = col_idxs[el];
+            const auto val = vals[el];
+            if (col < row) {
+                col_idxs_l[current_index_l] = col;
+                vals_l[current_index_l] = val;
+                ++current_index_l;
+            } else if (col == row) {
+                diag_val = val;
+            }
+        }
+        // store the diagonal entry last
+        auto l_diag_idx = row_ptrs_l[row + 1] - 1;
+        col_idxs_l[l_diag_idx] = row;
+        vals_l[l_diag_idx] = diag_sqrt ? sqrt(diag_val) : diag_val;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_IC_INITIALIZE_L_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_factor(std::shared_ptr<const ReferenceExecutor> exec,
+                    size_type iterations,
+                    const matrix::Csr<ValueType, IndexType> *a_lower,
+                    matrix::Csr<ValueType, IndexType> *l_factor)
+{
+    // If `iterations` is set to `Auto`, a single iteration is sufficient since
+    // it is computed sequentially
+    iterations = (iterations == 0) ? 1 : iterations;
+    const auto num_rows = a_lower->get_size()[0];
+    const auto row_ptrs = l_factor->get_const_row_ptrs();
+    const auto col_idxs = l_factor->get_const_col_idxs();
+    const auto a_vals = a_lower->get_const_values();
+    auto l_vals = l_factor->get_values();
+    for (size_type iter = 0; iter < iterations; ++iter) {
+        for (size_type row = 0; row < num_rows; ++row) {
+            for (auto l_nz = row_ptrs[row]; l_nz < row_ptrs[row + 1]; ++l_nz) {
+                const auto col = col_idxs[l_nz];
+                // sum = a(row, col) - dot(l(row, :col), conj(l(col, :col)))
+                auto sum = a_vals[l_nz];
+                auto row_nz = row_ptrs[row];
+                auto col_nz = row_ptrs[col];
+                while (row_nz < l_nz && col_nz < row_ptrs[col + 1] - 1) {
+                    const auto row_col = col_idxs[row_nz];
+                    const auto col_col = col_idxs[col_nz];
+                    if (row_col == col_col) {
+                        sum -= l_vals[row_nz] * conj(l_vals[col_nz]);
+                    }
+                    row_nz += row_col <= col_col;
+                    col_nz += col_col <= row_col;
+                }
+                // the diagonal entry is stored last in each row
+                const auto to_write =
+                    static_cast<size_type>(col) == row
+                        ? sqrt(sum)
+                        : sum / l_vals[row_ptrs[col + 1] - 1];
+                if (::gko::isfinite(to_write)) {
+                    l_vals[l_nz] = to_write;
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_IC_COMPUTE_FACTOR_KERNEL);
+
+
+}  // namespace par_ic_factorization
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -316,6 +316,44 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType> *a,
+                    const matrix::Csr<ValueType, IndexType> *b,
+                    matrix::Csr<ValueType, IndexType> *c)
+{
+    auto a_row_ptrs = a->get_const_row_ptrs();
+    auto a_col_idxs = a->get_const_col_idxs();
+    auto a_vals = a->get_const_values();
+    auto b_row_ptrs = b->get_const_row_ptrs();
+    auto b_col_idxs = b->get_const_col_idxs();
+    auto b_vals = b->get_const_values();
+    auto c_row_ptrs = c->get_const_row_ptrs();
+    auto c_col_idxs = c->get_const_col_idxs();
+    auto c_vals = c->get_values();
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        auto c_begin = c_col_idxs + c_row_ptrs[row];
+        auto c_end = c_col_idxs + c_row_ptrs[row + 1];
+        std::fill(c_vals + c_row_ptrs[row], c_vals + c_row_ptrs[row + 1],
+                  zero<ValueType>());
+        for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+            auto b_row = a_col_idxs[a_nz];
+            for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+                 ++b_nz) {
+                auto it = std::lower_bound(c_begin, c_end, b_col_idxs[b_nz]);
+                if (it != c_end && *it == b_col_idxs[b_nz]) {
+                    c_vals[it - c_col_idxs] += a_vals[a_nz] * b_vals[b_nz];
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+
+
 template <typename IndexType>
 void convert_row_ptrs_to_idxs(std::shared_ptr<const ReferenceExecutor> exec,
                               const IndexType *ptrs, size_type num_rows,
@@ -840,6 +878,52 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_IS_SORTED_BY_COLUMN_INDEX);
 
 
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *orig,
+                      Array<ValueType> &diag)
+{
+    const auto row_ptrs = orig->get_const_row_ptrs();
+    const auto col_idxs = orig->get_const_col_idxs();
+    const auto values = orig->get_const_values();
+    const auto diag_size = diag.get_num_elems();
+    auto diag_values = diag.get_data();
+
+    for (size_type row = 0; row < diag_size; ++row) {
+        diag_values[row] = zero<ValueType>();
+        for (auto idx = row_ptrs[row]; idx < row_ptrs[row + 1]; ++idx) {
+            if (col_idxs[idx] == static_cast<IndexType>(row)) {
+                diag_values[row] = values[idx];
+                break;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
+
+
+template <typename ValueType, typename IndexType>
+void scatter_values(std::shared_ptr<const ReferenceExecutor> exec,
+                    const Array<ValueType> &values,
+                    const Array<IndexType> &positions,
+                    matrix::Csr<ValueType, IndexType> *mtx)
+{
+    const auto in_values = values.get_const_data();
+    const auto in_positions = positions.get_const_data();
+    auto out_values = mtx->get_values();
+
+    for (size_type i = 0; i < values.get_num_elems(); ++i) {
+        if (in_positions[i] >= 0) {
+            out_values[in_positions[i]] = in_values[i];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SCATTER_VALUES_KERNEL);
+
+
 }  // namespace csr
 }  // namespace reference
 }  // namespace kernels
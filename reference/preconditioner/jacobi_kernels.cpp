@@ -583,6 +583,66 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_JACOBI_CONVERT_TO_DENSE_KERNEL);
 
 
+template <typename ValueType>
+void invert_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                     Array<ValueType> &diag)
+{
+    auto values = diag.get_data();
+    for (size_type i = 0; i < diag.get_num_elems(); ++i) {
+        // singular 1x1 blocks are left as they are, like in generate
+        if (values[i] != zero<ValueType>()) {
+            values[i] = one<ValueType>() / values[i];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_JACOBI_INVERT_DIAGONAL_KERNEL);
+
+
+template <typename ValueType>
+void scalar_apply(std::shared_ptr<const ReferenceExecutor> exec,
+                  const Array<ValueType> &inverse_diag,
+                  const matrix::Dense<ValueType> *alpha,
+                  const matrix::Dense<ValueType> *b,
+                  const matrix::Dense<ValueType> *beta,
+                  matrix::Dense<ValueType> *x)
+{
+    const auto diag = inverse_diag.get_const_data();
+    const auto alpha_value = alpha->at(0, 0);
+    const auto beta_value = beta->at(0, 0);
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type col = 0; col < x->get_size()[1]; ++col) {
+            if (beta_value != zero<ValueType>()) {
+                x->at(row, col) = beta_value * x->at(row, col) +
+                                  alpha_value * diag[row] * b->at(row, col);
+            } else {
+                x->at(row, col) = alpha_value * diag[row] * b->at(row, col);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_JACOBI_SCALAR_APPLY_KERNEL);
+
+
+template <typename ValueType>
+void simple_scalar_apply(std::shared_ptr<const ReferenceExecutor> exec,
+                         const Array<ValueType> &inverse_diag,
+                         const matrix::Dense<ValueType> *b,
+                         matrix::Dense<ValueType> *x)
+{
+    const auto diag = inverse_diag.get_const_data();
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type col = 0; col < x->get_size()[1]; ++col) {
+            x->at(row, col) = diag[row] * b->at(row, col);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_JACOBI_SIMPLE_SCALAR_APPLY_KERNEL);
+
+
 }  // namespace jacobi
 }  // namespace reference
 }  // namespace kernels
@@ -125,22 +125,29 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
             const matrix::Dense<ValueType> *rho,
             matrix::Dense<ValueType> *alpha,
             const matrix::Dense<ValueType> *beta,
+            matrix::Dense<ValueType> *s_norm,
             const Array<stopping_status> *stop_status)
 {
+    for (size_type j = 0; j < s->get_size()[1]; ++j) {
+        s_norm->at(j) = zero<ValueType>();
+    }
     for (size_type i = 0; i < s->get_size()[0]; ++i) {
         for (size_type j = 0; j < s->get_size()[1]; ++j) {
-            if (stop_status->get_const_data()[j].has_stopped()) {
-                continue;
-            }
-            if (beta->at(j) != zero<ValueType>()) {
-                alpha->at(j) = rho->at(j) / beta->at(j);
-                s->at(i, j) = r->at(i, j) - alpha->at(j) * v->at(i, j);
-            } else {
-                alpha->at(j) = zero<ValueType>();
-                s->at(i, j) = r->at(i, j);
+            if (!stop_status->get_const_data()[j].has_stopped()) {
+                if (beta->at(j) != zero<ValueType>()) {
+                    alpha->at(j) = rho->at(j) / beta->at(j);
+                    s->at(i, j) = r->at(i, j) - alpha->at(j) * v->at(i, j);
+                } else {
+                    alpha->at(j) = zero<ValueType>();
+                    s->at(i, j) = r->at(i, j);
+                }
             }
+            s_norm->at(j) += squared_norm(s->at(i, j));
         }
     }
+    for (size_type j = 0; j < s->get_size()[1]; ++j) {
+        s_norm->at(j) = sqrt(abs(s_norm->at(j)));
+    }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_2_KERNEL);
@@ -153,7 +160,9 @@ void step_3(
     const matrix::Dense<ValueType> *t, const matrix::Dense<ValueType> *y,
     const matrix::Dense<ValueType> *z, const matrix::Dense<ValueType> *alpha,
     const matrix::Dense<ValueType> *beta, const matrix::Dense<ValueType> *gamma,
-    matrix::Dense<ValueType> *omega, const Array<stopping_status> *stop_status)
+    matrix::Dense<ValueType> *omega, const matrix::Dense<ValueType> *rr,
+    matrix::Dense<ValueType> *rho, matrix::Dense<ValueType> *residual_norm,
+    const Array<stopping_status> *stop_status)
 {
     for (size_type j = 0; j < x->get_size()[1]; ++j) {
         if (stop_status->get_const_data()[j].has_stopped()) {
@@ -165,16 +174,24 @@ void step_3(
             omega->at(j) = zero<ValueType>();
         }
     }
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        rho->at(j) = zero<ValueType>();
+        residual_norm->at(j) = zero<ValueType>();
+    }
     for (size_type i = 0; i < x->get_size()[0]; ++i) {
         for (size_type j = 0; j < x->get_size()[1]; ++j) {
-            if (stop_status->get_const_data()[j].has_stopped()) {
-                continue;
+            if (!stop_status->get_const_data()[j].has_stopped()) {
+                x->at(i, j) +=
+                    alpha->at(j) * y->at(i, j) + omega->at(j) * z->at(i, j);
+                r->at(i, j) = s->at(i, j) - omega->at(j) * t->at(i, j);
             }
-            x->at(i, j) +=
-                alpha->at(j) * y->at(i, j) + omega->at(j) * z->at(i, j);
-            r->at(i, j) = s->at(i, j) - omega->at(j) * t->at(i, j);
+            rho->at(j) += conj(rr->at(i, j)) * r->at(i, j);
+            residual_norm->at(j) += squared_norm(r->at(i, j));
         }
     }
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        residual_norm->at(j) = sqrt(abs(residual_norm->at(j)));
+    }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_KERNEL);
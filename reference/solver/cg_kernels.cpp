@@ -106,20 +106,26 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
             const matrix::Dense<ValueType> *q,
             const matrix::Dense<ValueType> *beta,
             const matrix::Dense<ValueType> *rho,
+            matrix::Dense<ValueType> *residual_norm,
             const Array<stopping_status> *stop_status)
 {
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        residual_norm->at(j) = zero<ValueType>();
+    }
     for (size_type i = 0; i < x->get_size()[0]; ++i) {
         for (size_type j = 0; j < x->get_size()[1]; ++j) {
-            if (stop_status->get_const_data()[j].has_stopped()) {
-                continue;
-            }
-            if (beta->at(j) != zero<ValueType>()) {
+            if (!stop_status->get_const_data()[j].has_stopped() &&
+                beta->at(j) != zero<ValueType>()) {
                 auto tmp = rho->at(j) / beta->at(j);
                 x->at(i, j) += tmp * p->at(i, j);
                 r->at(i, j) -= tmp * q->at(i, j);
             }
+            residual_norm->at(j) += squared_norm(r->at(i, j));
         }
     }
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        residual_norm->at(j) = sqrt(abs(residual_norm->at(j)));
+    }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
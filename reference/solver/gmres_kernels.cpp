@@ -36,10 +36,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/range_accessors.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
 
 
+#include "core/preconditioner/jacobi_utils.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace reference {
@@ -54,51 +58,92 @@ namespace gmres {
 namespace {
 
 
-template <typename ValueType>
+template <typename ValueType, typename Accessor>
 void finish_arnoldi(matrix::Dense<ValueType> *next_krylov_basis,
-                    matrix::Dense<ValueType> *krylov_bases,
-                    matrix::Dense<ValueType> *hessenberg_iter, size_type iter,
-                    const stopping_status *stop_status)
+                    const range<Accessor> &krylov_bases,
+                    matrix::Dense<ValueType> *hessenberg_iter,
+                    matrix::Dense<ValueType> *projection, size_type iter,
+                    const stopping_status *stop_status,
+                    solver::gmres::ortho_method ortho)
 {
-    for (size_type i = 0; i < next_krylov_basis->get_size()[1]; ++i) {
+    const auto num_rows = next_krylov_basis->get_size()[0];
+    const auto num_rhs = next_krylov_basis->get_size()[1];
+    for (size_type i = 0; i < num_rhs; ++i) {
         if (stop_status[i].has_stopped()) {
             continue;
         }
-        for (size_type k = 0; k < iter + 1; ++k) {
-            hessenberg_iter->at(k, i) = 0;
-            for (size_type j = 0; j < next_krylov_basis->get_size()[0]; ++j) {
-                hessenberg_iter->at(k, i) +=
-                    next_krylov_basis->at(j, i) *
-                    krylov_bases->at(j,
-                                     next_krylov_basis->get_size()[1] * k + i);
+        if (ortho == solver::gmres::ortho_method::mgs) {
+            for (size_type k = 0; k < iter + 1; ++k) {
+                hessenberg_iter->at(k, i) = 0;
+                for (size_type j = 0; j < num_rows; ++j) {
+                    hessenberg_iter->at(k, i) +=
+                        next_krylov_basis->at(j, i) *
+                        static_cast<ValueType>(
+                            krylov_bases(j, num_rhs * k + i));
+                }
+                for (size_type j = 0; j < num_rows; ++j) {
+                    next_krylov_basis->at(j, i) -=
+                        hessenberg_iter->at(k, i) *
+                        static_cast<ValueType>(
+                            krylov_bases(j, num_rhs * k + i));
+                }
             }
-            for (size_type j = 0; j < next_krylov_basis->get_size()[0]; ++j) {
-                next_krylov_basis->at(j, i) -=
-                    hessenberg_iter->at(k, i) *
-                    krylov_bases->at(j,
-                                     next_krylov_basis->get_size()[1] * k + i);
+            // for i in 1:iter
+            //     hessenberg(iter, i) =
+            //         next_krylov_basis' * krylov_bases(:, i)
+            //     next_krylov_basis  -=
+            //         hessenberg(iter, i) * krylov_bases(:, i)
+            // end
+        } else {
+            for (size_type k = 0; k < iter + 1; ++k) {
+                hessenberg_iter->at(k, i) = 0;
             }
+            const auto num_passes =
+                ortho == solver::gmres::ortho_method::cgs2 ? 2 : 1;
+            for (int pass = 0; pass < num_passes; ++pass) {
+                for (size_type k = 0; k < iter + 1; ++k) {
+                    projection->at(k, i) = zero<ValueType>();
+                    for (size_type j = 0; j < num_rows; ++j) {
+                        projection->at(k, i) +=
+                            next_krylov_basis->at(j, i) *
+                            static_cast<ValueType>(
+                                krylov_bases(j, num_rhs * k + i));
+                    }
+                }
+                for (size_type k = 0; k < iter + 1; ++k) {
+                    for (size_type j = 0; j < num_rows; ++j) {
+                        next_krylov_basis->at(j, i) -=
+                            projection->at(k, i) *
+                            static_cast<ValueType>(
+                                krylov_bases(j, num_rhs * k + i));
+                    }
+                    hessenberg_iter->at(k, i) += projection->at(k, i);
+                }
+            }
+            // repeat once (CGS) or twice (CGS2):
+            //     projection          = krylov_bases(:, 1:iter)' *
+            //                           next_krylov_basis
+            //     next_krylov_basis  -= krylov_bases(:, 1:iter) * projection
+            //     hessenberg(iter, :) += projection
         }
-        // for i in 1:iter
-        //     hessenberg(iter, i) = next_krylov_basis' * krylov_bases(:, i)
-        //     next_krylov_basis  -= hessenberg(iter, i) * krylov_bases(:, i)
-        // end
 
         hessenberg_iter->at(iter + 1, i) = 0;
-        for (size_type j = 0; j < next_krylov_basis->get_size()[0]; ++j) {
+        for (size_type j = 0; j < num_rows; ++j) {
             hessenberg_iter->at(iter + 1, i) +=
                 next_krylov_basis->at(j, i) * next_krylov_basis->at(j, i);
         }
         hessenberg_iter->at(iter + 1, i) =
             sqrt(hessenberg_iter->at(iter + 1, i));
         // hessenberg(iter, iter + 1) = norm(next_krylov_basis)
-        for (size_type j = 0; j < next_krylov_basis->get_size()[0]; ++j) {
-            next_krylov_basis->at(j, i) /= hessenberg_iter->at(iter + 1, i);
-            krylov_bases->at(j, next_krylov_basis->get_size()[1] * (iter + 1) +
-                                    i) = next_krylov_basis->at(j, i);
+        for (size_type j = 0; j < num_rows; ++j) {
+            krylov_bases(j, num_rhs * (iter + 1) + i) =
+                next_krylov_basis->at(j, i) / hessenberg_iter->at(iter + 1, i);
+            next_krylov_basis->at(j, i) =
+                krylov_bases(j, num_rhs * (iter + 1) + i);
         }
-        // next_krylov_basis /= hessenberg(iter, iter + 1)
-        // krylov_bases(:, iter + 1) = next_krylov_basis
+        // krylov_bases(:, iter + 1) = next_krylov_basis / hessenberg(iter,
+        //                                                  iter + 1)
+        // next_krylov_basis = krylov_bases(:, iter + 1)
         // End of arnoldi
     }
 }
@@ -210,19 +255,19 @@ void solve_upper_triangular(
 }
 
 
-template <typename ValueType>
-void calculate_qy(const matrix::Dense<ValueType> *krylov_bases,
+template <typename ValueType, typename Accessor>
+void calculate_qy(const range<Accessor> &krylov_bases,
                   const matrix::Dense<ValueType> *y,
                   matrix::Dense<ValueType> *before_preconditioner,
                   const size_type *final_iter_nums)
 {
-    for (size_type k = 0; k < before_preconditioner->get_size()[1]; ++k) {
+    const auto num_rhs = before_preconditioner->get_size()[1];
+    for (size_type k = 0; k < num_rhs; ++k) {
         for (size_type i = 0; i < before_preconditioner->get_size()[0]; ++i) {
             before_preconditioner->at(i, k) = zero<ValueType>();
             for (size_type j = 0; j < final_iter_nums[k]; ++j) {
                 before_preconditioner->at(i, k) +=
-                    krylov_bases->at(
-                        i, j * before_preconditioner->get_size()[1] + k) *
+                    static_cast<ValueType>(krylov_bases(i, j * num_rhs + k)) *
                     y->at(j, k);
             }
         }
@@ -230,6 +275,97 @@ void calculate_qy(const matrix::Dense<ValueType> *krylov_bases,
 }
 
 
+template <typename ValueType, typename Accessor>
+void initialize_krylov_bases(const matrix::Dense<ValueType> *residual,
+                             matrix::Dense<ValueType> *residual_norm,
+                             matrix::Dense<ValueType> *residual_norm_collection,
+                             const range<Accessor> &krylov_bases,
+                             size_type *final_iter_nums, size_type krylov_dim)
+{
+    for (size_type j = 0; j < residual->get_size()[1]; ++j) {
+        // Calculate residual norm
+        residual_norm->at(0, j) = 0;
+        for (size_type i = 0; i < residual->get_size()[0]; ++i) {
+            residual_norm->at(0, j) += residual->at(i, j) * residual->at(i, j);
+        }
+        residual_norm->at(0, j) = sqrt(residual_norm->at(0, j));
+
+        for (size_type i = 0; i < krylov_dim + 1; ++i) {
+            if (i == 0) {
+                residual_norm_collection->at(i, j) = residual_norm->at(0, j);
+            } else {
+                residual_norm_collection->at(i, j) = zero<ValueType>();
+            }
+        }
+        for (size_type i = 0; i < residual->get_size()[0]; ++i) {
+            krylov_bases(i, j) = residual->at(i, j) / residual_norm->at(0, j);
+        }
+        final_iter_nums[j] = 0;
+    }
+
+    for (size_type j = residual->get_size()[1]; j < krylov_bases.length(1);
+         ++j) {
+        for (size_type i = 0; i < krylov_bases.length(0); ++i) {
+            krylov_bases(i, j) = zero<ValueType>();
+        }
+    }
+}
+
+
+template <typename ValueType, typename Accessor>
+void load_first_basis(const range<Accessor> &krylov_bases,
+                      matrix::Dense<ValueType> *next_krylov_basis)
+{
+    for (size_type i = 0; i < next_krylov_basis->get_size()[0]; ++i) {
+        for (size_type j = 0; j < next_krylov_basis->get_size()[1]; ++j) {
+            next_krylov_basis->at(i, j) = krylov_bases(i, j);
+        }
+    }
+    // next_krylov_basis = krylov_bases(:, 0)
+}
+
+
+template <typename ValueType>
+range<accessor::row_major<ValueType, 2>> get_bases_range(
+    matrix::Dense<ValueType> *krylov_bases)
+{
+    return range<accessor::row_major<ValueType, 2>>(
+        krylov_bases->get_values(), krylov_bases->get_size()[0],
+        krylov_bases->get_size()[1], krylov_bases->get_stride());
+}
+
+
+template <typename ValueType>
+range<accessor::row_major<const ValueType, 2>> get_bases_range(
+    const matrix::Dense<ValueType> *krylov_bases)
+{
+    return range<accessor::row_major<const ValueType, 2>>(
+        krylov_bases->get_const_values(), krylov_bases->get_size()[0],
+        krylov_bases->get_size()[1], krylov_bases->get_stride());
+}
+
+
+template <typename StorageType, typename ValueType>
+range<accessor::reduced_row_major<ValueType, StorageType>> get_bases_range(
+    Array<ValueType> *krylov_bases, size_type num_rows, size_type num_cols)
+{
+    return range<accessor::reduced_row_major<ValueType, StorageType>>(
+        reinterpret_cast<StorageType *>(krylov_bases->get_data()), num_rows,
+        num_cols, num_cols);
+}
+
+
+template <typename StorageType, typename ValueType>
+range<accessor::reduced_row_major<ValueType, const StorageType>>
+get_bases_range(const Array<ValueType> *krylov_bases, size_type num_rows,
+                size_type num_cols)
+{
+    return range<accessor::reduced_row_major<ValueType, const StorageType>>(
+        reinterpret_cast<const StorageType *>(krylov_bases->get_const_data()),
+        num_rows, num_cols, num_cols);
+}
+
+
 }  // namespace
 
 
@@ -272,34 +408,9 @@ void initialize_2(std::shared_ptr<const ReferenceExecutor> exec,
                   matrix::Dense<ValueType> *krylov_bases,
                   Array<size_type> *final_iter_nums, size_type krylov_dim)
 {
-    for (size_type j = 0; j < residual->get_size()[1]; ++j) {
-        // Calculate residual norm
-        residual_norm->at(0, j) = 0;
-        for (size_type i = 0; i < residual->get_size()[0]; ++i) {
-            residual_norm->at(0, j) += residual->at(i, j) * residual->at(i, j);
-        }
-        residual_norm->at(0, j) = sqrt(residual_norm->at(0, j));
-
-        for (size_type i = 0; i < krylov_dim + 1; ++i) {
-            if (i == 0) {
-                residual_norm_collection->at(i, j) = residual_norm->at(0, j);
-            } else {
-                residual_norm_collection->at(i, j) = zero<ValueType>();
-            }
-        }
-        for (size_type i = 0; i < residual->get_size()[0]; ++i) {
-            krylov_bases->at(i, j) =
-                residual->at(i, j) / residual_norm->at(0, j);
-        }
-        final_iter_nums->get_data()[j] = 0;
-    }
-
-    for (size_type j = residual->get_size()[1]; j < krylov_bases->get_size()[1];
-         ++j) {
-        for (size_type i = 0; i < krylov_bases->get_size()[0]; ++i) {
-            krylov_bases->at(i, j) = zero<ValueType>();
-        }
-    }
+    initialize_krylov_bases(residual, residual_norm, residual_norm_collection,
+                            get_bases_range(krylov_bases),
+                            final_iter_nums->get_data(), krylov_dim);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_INITIALIZE_2_KERNEL);
@@ -314,17 +425,21 @@ void step_1(std::shared_ptr<const ReferenceExecutor> exec,
             matrix::Dense<ValueType> *residual_norm_collection,
             matrix::Dense<ValueType> *krylov_bases,
             matrix::Dense<ValueType> *hessenberg_iter,
+            matrix::Dense<ValueType> *projection,
+            Array<ValueType> *reduction_workspace,
             const matrix::Dense<ValueType> *b_norm, size_type iter,
             Array<size_type> *final_iter_nums,
-            const Array<stopping_status> *stop_status)
+            const Array<stopping_status> *stop_status,
+            solver::gmres::ortho_method ortho)
 {
     for (size_type i = 0; i < final_iter_nums->get_num_elems(); ++i) {
         final_iter_nums->get_data()[i] +=
             (1 - stop_status->get_const_data()[i].has_stopped());
     }
 
-    finish_arnoldi(next_krylov_basis, krylov_bases, hessenberg_iter, iter,
-                   stop_status->get_const_data());
+    finish_arnoldi(next_krylov_basis, get_bases_range(krylov_bases),
+                   hessenberg_iter, projection, iter,
+                   stop_status->get_const_data(), ortho);
     givens_rotation(next_krylov_basis, givens_sin, givens_cos, hessenberg_iter,
                     iter, stop_status->get_const_data());
     calculate_next_residual_norm(givens_sin, givens_cos, residual_norm,
@@ -346,13 +461,106 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
 {
     solve_upper_triangular(residual_norm_collection, hessenberg, y,
                            final_iter_nums->get_const_data());
-    calculate_qy(krylov_bases, y, before_preconditioner,
+    calculate_qy(get_bases_range(krylov_bases), y, before_preconditioner,
                  final_iter_nums->get_const_data());
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void initialize_2_compressed(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::Dense<ValueType> *residual,
+    matrix::Dense<ValueType> *residual_norm,
+    matrix::Dense<ValueType> *residual_norm_collection,
+    matrix::Dense<ValueType> *next_krylov_basis,
+    Array<ValueType> *krylov_bases, precision_reduction storage_prec,
+    Array<size_type> *final_iter_nums, size_type krylov_dim)
+{
+    const auto num_rows = residual->get_size()[0];
+    const auto num_rhs = residual->get_size()[1];
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, storage_prec,
+        auto bases = get_bases_range<resolved_precision>(
+            krylov_bases, num_rows, (krylov_dim + 1) * num_rhs);
+        initialize_krylov_bases(residual, residual_norm,
+                                residual_norm_collection, bases,
+                                final_iter_nums->get_data(), krylov_dim);
+        load_first_basis(bases, next_krylov_basis));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_GMRES_INITIALIZE_2_COMPRESSED_KERNEL);
+
+
+template <typename ValueType>
+void step_1_compressed(std::shared_ptr<const ReferenceExecutor> exec,
+                       matrix::Dense<ValueType> *next_krylov_basis,
+                       matrix::Dense<ValueType> *givens_sin,
+                       matrix::Dense<ValueType> *givens_cos,
+                       matrix::Dense<ValueType> *residual_norm,
+                       matrix::Dense<ValueType> *residual_norm_collection,
+                       Array<ValueType> *krylov_bases,
+                       precision_reduction storage_prec,
+                       matrix::Dense<ValueType> *hessenberg_iter,
+                       matrix::Dense<ValueType> *projection,
+                       Array<ValueType> *reduction_workspace,
+                       const matrix::Dense<ValueType> *b_norm, size_type iter,
+                       size_type krylov_dim, Array<size_type> *final_iter_nums,
+                       const Array<stopping_status> *stop_status,
+                       solver::gmres::ortho_method ortho)
+{
+    for (size_type i = 0; i < final_iter_nums->get_num_elems(); ++i) {
+        final_iter_nums->get_data()[i] +=
+            (1 - stop_status->get_const_data()[i].has_stopped());
+    }
+
+    const auto num_rows = next_krylov_basis->get_size()[0];
+    const auto num_rhs = next_krylov_basis->get_size()[1];
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, storage_prec,
+        finish_arnoldi(next_krylov_basis,
+                       get_bases_range<resolved_precision>(
+                           krylov_bases, num_rows, (krylov_dim + 1) * num_rhs),
+                       hessenberg_iter, projection, iter,
+                       stop_status->get_const_data(), ortho));
+    givens_rotation(next_krylov_basis, givens_sin, givens_cos, hessenberg_iter,
+                    iter, stop_status->get_const_data());
+    calculate_next_residual_norm(givens_sin, givens_cos, residual_norm,
+                                 residual_norm_collection, b_norm, iter,
+                                 stop_status->get_const_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_STEP_1_COMPRESSED_KERNEL);
+
+
+template <typename ValueType>
+void step_2_compressed(std::shared_ptr<const ReferenceExecutor> exec,
+                       const matrix::Dense<ValueType> *residual_norm_collection,
+                       const Array<ValueType> *krylov_bases,
+                       precision_reduction storage_prec,
+                       const matrix::Dense<ValueType> *hessenberg,
+                       matrix::Dense<ValueType> *y,
+                       matrix::Dense<ValueType> *before_preconditioner,
+                       const Array<size_type> *final_iter_nums,
+                       size_type krylov_dim)
+{
+    const auto num_rows = before_preconditioner->get_size()[0];
+    const auto num_rhs = before_preconditioner->get_size()[1];
+    solve_upper_triangular(residual_norm_collection, hessenberg, y,
+                           final_iter_nums->get_const_data());
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, storage_prec,
+        calculate_qy(get_bases_range<resolved_precision>(
+                         krylov_bases, num_rows, (krylov_dim + 1) * num_rhs),
+                     y, before_preconditioner,
+                     final_iter_nums->get_const_data()));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_STEP_2_COMPRESSED_KERNEL);
+
+
 }  // namespace gmres
 }  // namespace reference
 }  // namespace kernels
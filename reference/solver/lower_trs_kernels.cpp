@@ -118,6 +118,49 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_LOWER_TRS_SOLVE_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void solve_conj_transposed(std::shared_ptr<const ReferenceExecutor> exec,
+                           const matrix::Csr<ValueType, IndexType> *matrix,
+                           const solver::SolveStruct *solve_struct,
+                           const matrix::Dense<ValueType> *b,
+                           matrix::Dense<ValueType> *x)
+{
+    auto row_ptrs = matrix->get_const_row_ptrs();
+    auto col_idxs = matrix->get_const_col_idxs();
+    auto vals = matrix->get_const_values();
+
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+
+    // row `row` of L is column `row` of L^H, so a column-oriented backward
+    // substitution with L^H only needs the rows of L
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        for (IndexType row = 0; row < num_rows; ++row) {
+            x->at(row, j) = b->at(row, j);
+        }
+        for (auto row = num_rows - 1; row >= 0; --row) {
+            // the diagonal is found by its column index, so the entries of a
+            // row may be stored in any order
+            auto diag = zero<ValueType>();
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                if (col_idxs[k] == row) {
+                    diag = conj(vals[k]);
+                }
+            }
+            x->at(row, j) /= diag;
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                const auto col = col_idxs[k];
+                if (col < row) {
+                    x->at(col, j) -= conj(vals[k]) * x->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_LOWER_TRS_SOLVE_CONJ_TRANSPOSED_KERNEL);
+
+
 }  // namespace lower_trs
 }  // namespace reference
 }  // namespace kernels
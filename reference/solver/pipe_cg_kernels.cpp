@@ -0,0 +1,163 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The pipelined CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *r,
+                matrix::Dense<ValueType> *p, matrix::Dense<ValueType> *q,
+                matrix::Dense<ValueType> *s, matrix::Dense<ValueType> *z,
+                matrix::Dense<ValueType> *prev_gamma,
+                matrix::Dense<ValueType> *alpha,
+                Array<stopping_status> *stop_status)
+{
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        prev_gamma->at(j) = zero<ValueType>();
+        alpha->at(j) = one<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+            p->at(i, j) = q->at(i, j) = zero<ValueType>();
+            s->at(i, j) = z->at(i, j) = zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const ReferenceExecutor> exec,
+            const matrix::Dense<ValueType> *r,
+            const matrix::Dense<ValueType> *u,
+            const matrix::Dense<ValueType> *w, matrix::Dense<ValueType> *gamma,
+            matrix::Dense<ValueType> *delta,
+            matrix::Dense<ValueType> *residual_norm,
+            Array<ValueType> *reduction_buffer)
+{
+    for (size_type j = 0; j < r->get_size()[1]; ++j) {
+        gamma->at(j) = zero<ValueType>();
+        delta->at(j) = zero<ValueType>();
+        residual_norm->at(j) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < r->get_size()[0]; ++i) {
+        for (size_type j = 0; j < r->get_size()[1]; ++j) {
+            gamma->at(j) += conj(r->at(i, j)) * u->at(i, j);
+            delta->at(j) += conj(w->at(i, j)) * u->at(i, j);
+            residual_norm->at(j) += squared_norm(r->at(i, j));
+        }
+    }
+    for (size_type j = 0; j < r->get_size()[1]; ++j) {
+        residual_norm->at(j) = sqrt(residual_norm->at(j));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType> *x, matrix::Dense<ValueType> *r,
+            matrix::Dense<ValueType> *u, matrix::Dense<ValueType> *w,
+            matrix::Dense<ValueType> *p, matrix::Dense<ValueType> *q,
+            matrix::Dense<ValueType> *s, matrix::Dense<ValueType> *z,
+            const matrix::Dense<ValueType> *m,
+            const matrix::Dense<ValueType> *n,
+            const matrix::Dense<ValueType> *gamma,
+            const matrix::Dense<ValueType> *prev_gamma,
+            const matrix::Dense<ValueType> *delta,
+            matrix::Dense<ValueType> *alpha, matrix::Dense<ValueType> *beta,
+            const Array<stopping_status> *stop_status)
+{
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        auto tmp_beta = zero<ValueType>();
+        auto denom = delta->at(j);
+        if (prev_gamma->at(j) != zero<ValueType>()) {
+            tmp_beta = gamma->at(j) / prev_gamma->at(j);
+            if (alpha->at(j) != zero<ValueType>()) {
+                denom -= tmp_beta * gamma->at(j) / alpha->at(j);
+            }
+        }
+        beta->at(j) = tmp_beta;
+        alpha->at(j) = denom == zero<ValueType>() ? zero<ValueType>()
+                                                  : gamma->at(j) / denom;
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            const auto tmp_alpha = alpha->at(j);
+            const auto tmp_beta = beta->at(j);
+            z->at(i, j) = n->at(i, j) + tmp_beta * z->at(i, j);
+            q->at(i, j) = m->at(i, j) + tmp_beta * q->at(i, j);
+            s->at(i, j) = w->at(i, j) + tmp_beta * s->at(i, j);
+            p->at(i, j) = u->at(i, j) + tmp_beta * p->at(i, j);
+            x->at(i, j) += tmp_alpha * p->at(i, j);
+            r->at(i, j) -= tmp_alpha * s->at(i, j);
+            u->at(i, j) -= tmp_alpha * q->at(i, j);
+            w->at(i, j) -= tmp_alpha * z->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
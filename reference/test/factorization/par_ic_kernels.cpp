@@ -0,0 +1,241 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/par_ic.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/factorization/par_ic_kernels.hpp"
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+class ParIc : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Dense = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using par_ic_type = gko::factorization::ParIc<value_type, index_type>;
+
+    ParIc()
+        : ref(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx_small(gko::initialize<Csr>(
+              {{4., 2., 2.},
+               {2., 5., 3.},
+               {2., 3., 6.}}, ref)),
+          small_l_expected(gko::initialize<Csr>(
+              {{2., 0., 0.},
+               {1., 2., 0.},
+               {1., 1., 2.}}, ref)),
+          mtx_missing_diag(gko::initialize<Csr>(
+              {{4., 2., 0.},
+               {2., 0., 3.},
+               {0., 3., 9.}}, ref)),
+          mtx_cycle(gko::initialize<Csr>(
+              {{4., 1., 0., 1.},
+               {1., 4., 1., 0.},
+               {0., 1., 4., 1.},
+               {1., 0., 1., 4.}}, ref))
+    // clang-format on
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<const Csr> mtx_small;
+    std::shared_ptr<const Csr> small_l_expected;
+    std::shared_ptr<const Csr> mtx_missing_diag;
+    std::shared_ptr<const Csr> mtx_cycle;
+};
+
+
+TEST_F(ParIc, KernelInitializeRowPtrsL)
+{
+    index_type l_row_ptrs[4]{};
+
+    gko::kernels::reference::par_ic_factorization::initialize_row_ptrs_l(
+        ref, gko::lend(mtx_missing_diag), l_row_ptrs);
+
+    ASSERT_EQ(l_row_ptrs[0], 0);
+    ASSERT_EQ(l_row_ptrs[1], 1);
+    ASSERT_EQ(l_row_ptrs[2], 3);
+    ASSERT_EQ(l_row_ptrs[3], 5);
+}
+
+
+TEST_F(ParIc, KernelInitializeL)
+{
+    // clang-format off
+    auto expected = gko::initialize<Dense>({{2., 0., 0.},
+                                            {2., 1., 0.},
+                                            {0., 3., 3.}}, ref);
+    // clang-format on
+    auto l_mtx = Csr::create(ref, mtx_missing_diag->get_size(), 5);
+    auto row_ptrs = l_mtx->get_row_ptrs();
+    gko::kernels::reference::par_ic_factorization::initialize_row_ptrs_l(
+        ref, gko::lend(mtx_missing_diag), row_ptrs);
+
+    gko::kernels::reference::par_ic_factorization::initialize_l(
+        ref, gko::lend(mtx_missing_diag), gko::lend(l_mtx), true);
+
+    GKO_ASSERT_MTX_NEAR(l_mtx, expected, 1e-14);
+}
+
+
+TEST_F(ParIc, KernelComputeFactor)
+{
+    auto a_lower = Csr::create(ref, mtx_small->get_size(), 6);
+    auto l_mtx = Csr::create(ref, mtx_small->get_size(), 6);
+    gko::kernels::reference::par_ic_factorization::initialize_row_ptrs_l(
+        ref, gko::lend(mtx_small), a_lower->get_row_ptrs());
+    gko::kernels::reference::par_ic_factorization::initialize_row_ptrs_l(
+        ref, gko::lend(mtx_small), l_mtx->get_row_ptrs());
+    gko::kernels::reference::par_ic_factorization::initialize_l(
+        ref, gko::lend(mtx_small), gko::lend(a_lower), false);
+    gko::kernels::reference::par_ic_factorization::initialize_l(
+        ref, gko::lend(mtx_small), gko::lend(l_mtx), true);
+
+    gko::kernels::reference::par_ic_factorization::compute_factor(
+        ref, 1, gko::lend(a_lower), gko::lend(l_mtx));
+
+    GKO_ASSERT_MTX_NEAR(l_mtx, small_l_expected, 1e-14);
+}
+
+
+TEST_F(ParIc, ThrowDimensionMismatch)
+{
+    auto matrix = Csr::create(ref, gko::dim<2>{2, 3}, 4);
+
+    ASSERT_THROW(par_ic_type::build().on(ref)->generate(gko::share(matrix)),
+                 gko::DimensionMismatch);
+}
+
+
+TEST_F(ParIc, SetLStrategy)
+{
+    auto l_strategy = std::make_shared<typename Csr::merge_path>();
+
+    auto factory = par_ic_type::build().with_l_strategy(l_strategy).on(ref);
+    auto par_ic = factory->generate(mtx_small);
+
+    ASSERT_EQ(par_ic->get_l_factor()->get_strategy(), l_strategy);
+    ASSERT_EQ(par_ic->get_lt_factor()->get_strategy(), l_strategy);
+}
+
+
+TEST_F(ParIc, GenerateForCsrSmall)
+{
+    auto factors = par_ic_type::build().on(ref)->generate(mtx_small);
+    auto lt_expected = small_l_expected->transpose();
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), small_l_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(factors->get_lt_factor(),
+                        static_cast<Csr *>(lt_expected.get()), 1e-14);
+}
+
+
+TEST_F(ParIc, GenerateOnlyLFactor)
+{
+    auto factors = par_ic_type::build()
+                       .with_both_factors(false)
+                       .on(ref)
+                       ->generate(mtx_small);
+
+    ASSERT_EQ(factors->get_operators().size(), 1);
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), small_l_expected, 1e-14);
+    ASSERT_THROW(factors->get_lt_factor(), gko::NotSupported);
+}
+
+
+TEST_F(ParIc, GenerateMatchesMatrixOnItsPattern)
+{
+    // clang-format off
+    auto expected = gko::initialize<Dense>({{4., 1., 0., 1.},
+                                            {1., 4., 1., 0.},
+                                            {0., 1., 4., 1.},
+                                            {1., 0., 1., 4.}}, ref);
+    auto l_pattern = gko::initialize<Csr>({{1., 0., 0., 0.},
+                                           {1., 1., 0., 0.},
+                                           {0., 1., 1., 0.},
+                                           {1., 0., 1., 1.}}, ref);
+    // clang-format on
+    auto factors = par_ic_type::build().on(ref)->generate(mtx_cycle);
+    auto product = Dense::create(ref, mtx_cycle->get_size());
+    auto lt = Dense::create(ref);
+    factors->get_lt_factor()->convert_to(lt.get());
+
+    factors->get_l_factor()->apply(lt.get(), product.get());
+
+    // the fill-in at (3, 1) and (1, 3) is not part of the pattern of IC(0)
+    product->at(3, 1) = 0.;
+    product->at(1, 3) = 0.;
+    GKO_ASSERT_MTX_NEAR(product, expected, 1e-14);
+    GKO_ASSERT_MTX_EQ_SPARSITY(factors->get_l_factor(), l_pattern);
+}
+
+
+TEST_F(ParIc, UpdatesValues)
+{
+    // clang-format off
+    auto scaled = gko::share(gko::initialize<Csr>(
+        {{8., 4., 4.},
+         {4., 10., 6.},
+         {4., 6., 12.}}, ref));
+    // clang-format on
+    auto factors = par_ic_type::build().on(ref)->generate(scaled);
+    auto l_values = factors->get_l_factor()->get_const_values();
+    auto lt_expected = small_l_expected->transpose();
+
+    factors->update_values(mtx_small);
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), small_l_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(factors->get_lt_factor(),
+                        static_cast<Csr *>(lt_expected.get()), 1e-14);
+    ASSERT_EQ(factors->get_l_factor()->get_const_values(), l_values);
+}
+
+
+}  // namespace
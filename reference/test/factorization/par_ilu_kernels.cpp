@@ -532,4 +532,29 @@ TEST_F(ParIlu, GenerateForReverseCsrSmall)
 }
 
 
+TEST_F(ParIlu, UpdatesValues)
+{
+    auto scaled = gko::share(gko::clone(exec, mtx_big));
+    scaled->scale(gko::initialize<Dense>({2.}, exec).get());
+    auto factors = ilu_factory_sort->generate(scaled);
+    auto l_values = factors->get_l_factor()->get_const_values();
+    auto u_values = factors->get_u_factor()->get_const_values();
+
+    factors->update_values(mtx_big);
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), big_l_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(factors->get_u_factor(), big_u_expected, 1e-14);
+    ASSERT_EQ(factors->get_l_factor()->get_const_values(), l_values);
+    ASSERT_EQ(factors->get_u_factor()->get_const_values(), u_values);
+}
+
+
+TEST_F(ParIlu, UpdateValuesThrowsDimensionMismatch)
+{
+    auto factors = ilu_factory_skip->generate(mtx_big);
+
+    ASSERT_THROW(factors->update_values(mtx_small), gko::DimensionMismatch);
+}
+
+
 }  // namespace
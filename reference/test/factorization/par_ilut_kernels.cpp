@@ -0,0 +1,317 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/par_ilut.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/factorization/par_ilut_kernels.hpp"
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+class ParIlut : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Dense = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using par_ilut_type = gko::factorization::ParIlut<value_type, index_type>;
+
+    ParIlut()
+        : ref(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx_small(gko::initialize<Csr>(
+              {{4., 6., 8.},
+               {2., 2., 5.},
+               {1., 1., 1.}}, ref)),
+          small_l_expected(gko::initialize<Csr>(
+              {{1., 0., 0.},
+               {0.5, 1., 0.},
+               {0.25, 0.5, 1.}}, ref)),
+          small_u_expected(gko::initialize<Csr>(
+              {{4., 6., 8.},
+               {0., -1., 1.},
+               {0., 0., -1.5}}, ref)),
+          mtx_arrow(gko::initialize<Csr>(
+              {{4., 1., 1., 1.},
+               {1., 4., 0., 0.},
+               {1., 0., 4., 0.},
+               {1., 0., 0., 4.}}, ref)),
+          mtx_filter(gko::initialize<Csr>(
+              {{1., -5., 0.},
+               {2., 0., -3.},
+               {0., 0.5, 4.}}, ref))
+    // clang-format on
+    {}
+
+    std::unique_ptr<Csr> multiply(const Csr *l, const Csr *u)
+    {
+        auto product = Csr::create(ref, l->get_size());
+        l->apply(u, gko::lend(product));
+        return product;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<const Csr> mtx_small;
+    std::shared_ptr<const Csr> small_l_expected;
+    std::shared_ptr<const Csr> small_u_expected;
+    std::shared_ptr<const Csr> mtx_arrow;
+    std::shared_ptr<const Csr> mtx_filter;
+};
+
+
+TEST_F(ParIlut, KernelAddCandidates)
+{
+    // clang-format off
+    auto l_mtx = gko::initialize<Csr>({{1., 0., 0.},
+                                       {0.5, 1., 0.},
+                                       {0., 0., 1.}}, ref);
+    auto u_mtx = gko::initialize<Csr>({{4., 6., 0.},
+                                       {0., -1., 1.},
+                                       {0., 0., -1.5}}, ref);
+    auto l_expected = gko::initialize<Dense>({{1., 0., 0.},
+                                              {0.5, 1., 0.},
+                                              {0.25, -1., 1.}}, ref);
+    auto u_expected = gko::initialize<Dense>({{4., 6., 8.},
+                                              {0., -1., 1.},
+                                              {0., 0., -1.5}}, ref);
+    // clang-format on
+    auto lu = multiply(gko::lend(l_mtx), gko::lend(u_mtx));
+    lu->sort_by_column_index();
+    gko::Array<index_type> l_row_ptrs{ref};
+    gko::Array<index_type> l_col_idxs{ref};
+    gko::Array<value_type> l_vals{ref};
+    gko::Array<index_type> u_row_ptrs{ref};
+    gko::Array<index_type> u_col_idxs{ref};
+    gko::Array<value_type> u_vals{ref};
+
+    gko::kernels::reference::par_ilut_factorization::add_candidates(
+        ref, gko::lend(lu), gko::lend(mtx_small), gko::lend(l_mtx),
+        gko::lend(u_mtx), l_row_ptrs, l_col_idxs, l_vals, u_row_ptrs,
+        u_col_idxs, u_vals);
+
+    auto l_new = Csr::create(ref, l_mtx->get_size(), std::move(l_vals),
+                             std::move(l_col_idxs), std::move(l_row_ptrs));
+    auto u_new = Csr::create(ref, u_mtx->get_size(), std::move(u_vals),
+                             std::move(u_col_idxs), std::move(u_row_ptrs));
+    ASSERT_EQ(l_new->get_num_stored_elements(), 6);
+    ASSERT_EQ(u_new->get_num_stored_elements(), 6);
+    GKO_ASSERT_MTX_NEAR(l_new, l_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(u_new, u_expected, 1e-14);
+}
+
+
+TEST_F(ParIlut, KernelComputeLU)
+{
+    // clang-format off
+    auto l_mtx = gko::initialize<Csr>({{1., 0., 0.},
+                                       {2., 1., 0.},
+                                       {1., 1., 1.}}, ref);
+    auto u_mtx = gko::initialize<Csr>({{4., 6., 8.},
+                                       {0., 2., 5.},
+                                       {0., 0., 1.}}, ref);
+    // clang-format on
+    auto u_csc_lin_op = u_mtx->transpose();
+    auto u_csc = static_cast<Csr *>(u_csc_lin_op.get());
+    auto u_expected_transpose_lin_op = small_u_expected->transpose();
+    auto u_expected_transpose =
+        static_cast<Csr *>(u_expected_transpose_lin_op.get());
+
+    gko::kernels::reference::par_ilut_factorization::compute_l_u_factors(
+        ref, gko::lend(mtx_small), gko::lend(l_mtx), gko::lend(u_mtx), u_csc);
+
+    GKO_ASSERT_MTX_NEAR(l_mtx, small_l_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(u_mtx, small_u_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(u_csc, u_expected_transpose, 1e-14);
+}
+
+
+TEST_F(ParIlut, KernelThresholdSelect)
+{
+    gko::Array<value_type> tmp{ref};
+    gko::remove_complex<value_type> threshold{};
+
+    gko::kernels::reference::par_ilut_factorization::threshold_select(
+        ref, gko::lend(mtx_filter), 2, tmp, threshold);
+
+    ASSERT_EQ(threshold, 2.);
+}
+
+
+TEST_F(ParIlut, KernelThresholdFilterKeepsLargeAndDiagonalEntries)
+{
+    // clang-format off
+    auto expected = gko::initialize<Csr>({{1., -5., 0.},
+                                          {2., 0., -3.},
+                                          {0., 0., 4.}}, ref);
+    // clang-format on
+    gko::Array<index_type> row_ptrs{ref};
+    gko::Array<index_type> col_idxs{ref};
+    gko::Array<value_type> vals{ref};
+
+    gko::kernels::reference::par_ilut_factorization::threshold_filter(
+        ref, gko::lend(mtx_filter), gko::lend(mtx_filter), 2., 0., row_ptrs,
+        col_idxs, vals);
+
+    auto filtered =
+        Csr::create(ref, mtx_filter->get_size(), std::move(vals),
+                    std::move(col_idxs), std::move(row_ptrs));
+    GKO_ASSERT_MTX_EQ_SPARSITY(filtered, expected);
+    GKO_ASSERT_MTX_NEAR(filtered, expected, 0.);
+}
+
+
+TEST_F(ParIlut, KernelThresholdFilterUsesRelativeDropTolerance)
+{
+    // clang-format off
+    auto expected = gko::initialize<Csr>({{1., -5., 0.},
+                                          {0., 0., -3.},
+                                          {0., 0., 4.}}, ref);
+    // clang-format on
+    gko::Array<index_type> row_ptrs{ref};
+    gko::Array<index_type> col_idxs{ref};
+    gko::Array<value_type> vals{ref};
+
+    gko::kernels::reference::par_ilut_factorization::threshold_filter(
+        ref, gko::lend(mtx_filter), gko::lend(mtx_filter), 0., 0.6, row_ptrs,
+        col_idxs, vals);
+
+    auto filtered =
+        Csr::create(ref, mtx_filter->get_size(), std::move(vals),
+                    std::move(col_idxs), std::move(row_ptrs));
+    GKO_ASSERT_MTX_EQ_SPARSITY(filtered, expected);
+    GKO_ASSERT_MTX_NEAR(filtered, expected, 0.);
+}
+
+
+TEST_F(ParIlut, ThrowDimensionMismatch)
+{
+    auto matrix = Csr::create(ref, gko::dim<2>{2, 3}, 4);
+
+    ASSERT_THROW(par_ilut_type::build().on(ref)->generate(gko::share(matrix)),
+                 gko::DimensionMismatch);
+}
+
+
+TEST_F(ParIlut, GenerateForCsrSmallIsExact)
+{
+    auto factors = par_ilut_type::build().on(ref)->generate(mtx_small);
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), small_l_expected, 1e-14);
+    GKO_ASSERT_MTX_NEAR(factors->get_u_factor(), small_u_expected, 1e-14);
+}
+
+
+TEST_F(ParIlut, GenerateAddsFillIn)
+{
+    auto factors = par_ilut_type::build()
+                       .with_fill_in_limit(10.)
+                       .on(ref)
+                       ->generate(mtx_arrow);
+    auto l_mtx = factors->get_l_factor();
+    auto u_mtx = factors->get_u_factor();
+
+    // the arrow matrix needs fill-in everywhere for an exact factorization
+    ASSERT_EQ(l_mtx->get_num_stored_elements(), 10);
+    ASSERT_EQ(u_mtx->get_num_stored_elements(), 10);
+    GKO_ASSERT_MTX_NEAR(multiply(gko::lend(l_mtx), gko::lend(u_mtx)),
+                        mtx_arrow, 1e-14);
+}
+
+
+TEST_F(ParIlut, GenerateRespectsFillInLimit)
+{
+    auto factors = par_ilut_type::build()
+                       .with_fill_in_limit(1.)
+                       .on(ref)
+                       ->generate(mtx_arrow);
+
+    // the fill-in entries are the smallest ones, so they are dropped again
+    ASSERT_EQ(factors->get_l_factor()->get_num_stored_elements(), 7);
+    ASSERT_EQ(factors->get_u_factor()->get_num_stored_elements(), 7);
+}
+
+
+TEST_F(ParIlut, GenerateRespectsDropTolerance)
+{
+    auto factors = par_ilut_type::build()
+                       .with_fill_in_limit(10.)
+                       .with_drop_tolerance(0.02)
+                       .on(ref)
+                       ->generate(mtx_arrow);
+
+    // only the fill-in entries of L are small compared to the rows of A
+    ASSERT_EQ(factors->get_l_factor()->get_num_stored_elements(), 7);
+    ASSERT_EQ(factors->get_u_factor()->get_num_stored_elements(), 10);
+}
+
+
+TEST_F(ParIlut, SetLStrategy)
+{
+    auto l_strategy = std::make_shared<typename Csr::merge_path>();
+
+    auto factory = par_ilut_type::build().with_l_strategy(l_strategy).on(ref);
+    auto par_ilut = factory->generate(mtx_small);
+
+    ASSERT_EQ(factory->get_parameters().l_strategy, l_strategy);
+    ASSERT_EQ(par_ilut->get_l_factor()->get_strategy(), l_strategy);
+}
+
+
+TEST_F(ParIlut, SetUStrategy)
+{
+    auto u_strategy = std::make_shared<typename Csr::classical>();
+
+    auto factory = par_ilut_type::build().with_u_strategy(u_strategy).on(ref);
+    auto par_ilut = factory->generate(mtx_small);
+
+    ASSERT_EQ(factory->get_parameters().u_strategy, u_strategy);
+    ASSERT_EQ(par_ilut->get_u_factor()->get_strategy(), u_strategy);
+}
+
+
+}  // namespace
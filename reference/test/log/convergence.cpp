@@ -70,4 +70,34 @@ TEST(Record, CatchesCriterionCheckCompleted)
 }
 
 
+TEST(Record, OnlyStoresResidualNormIfRequested)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Convergence<>::create(
+        exec, gko::log::Logger::criterion_check_completed_mask, false);
+    auto criterion =
+        gko::stop::Iteration::build().with_max_iters(3u).on(exec)->generate(
+            nullptr, nullptr, nullptr);
+    constexpr gko::uint8 RelativeStoppingId{42};
+    gko::Array<gko::stopping_status> stop_status(exec, 1);
+    using Mtx = gko::matrix::Dense<>;
+    auto residual = gko::initialize<Mtx>({1.0, 2.0, 2.0}, exec);
+    auto residual2 = gko::initialize<Mtx>({0.0, 3.0, 4.0}, exec);
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        criterion.get(), 1, residual.get(), nullptr, nullptr,
+        RelativeStoppingId, true, &stop_status, true, true);
+    auto norm = logger->get_residual_norm();
+
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        criterion.get(), 2, residual2.get(), nullptr, nullptr,
+        RelativeStoppingId, true, &stop_status, true, true);
+
+    ASSERT_EQ(logger->get_num_iterations(), 2);
+    ASSERT_EQ(logger->get_residual(), nullptr);
+    ASSERT_EQ(logger->get_residual_norm(), norm);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(logger->get_residual_norm()), l({5.0}),
+                        0.0);
+}
+
+
 }  // namespace
@@ -569,6 +569,142 @@ TEST_F(Csr, ApplyFailsOnWrongNumberOfCols)
 }
 
 
+TEST_F(Csr, UpdatesProductValues)
+{
+    auto product = Mtx::create(exec, gko::dim<2>{2, 3});
+    auto expected = Mtx::create(exec, gko::dim<2>{2, 3});
+    mtx->apply(mtx3_sorted.get(), product.get());
+    product->sort_by_column_index();
+    mtx->get_values()[0] = 2.0;
+    mtx->get_values()[3] = -1.0;
+
+    product->update_product_values(mtx.get(), mtx3_sorted.get());
+
+    mtx->apply(mtx3_sorted.get(), expected.get());
+    GKO_ASSERT_MTX_NEAR(product, expected, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(product, expected);
+}
+
+
+TEST_F(Csr, UpdateProductValuesFailsOnWrongInnerDimension)
+{
+    ASSERT_THROW(mtx2->update_product_values(mtx.get(), mtx.get()),
+                 gko::DimensionMismatch);
+}
+
+
+TEST_F(Csr, UpdatesValues)
+{
+    auto col_idxs = mtx->get_const_col_idxs();
+    auto row_ptrs = mtx->get_const_row_ptrs();
+
+    mtx->update_values(gko::Array<double>{exec, {-1.0, 2.0, -3.0, 4.0}});
+
+    ASSERT_EQ(mtx->get_const_values()[0], -1.0);
+    ASSERT_EQ(mtx->get_const_values()[1], 2.0);
+    ASSERT_EQ(mtx->get_const_values()[2], -3.0);
+    ASSERT_EQ(mtx->get_const_values()[3], 4.0);
+    ASSERT_EQ(mtx->get_const_col_idxs(), col_idxs);
+    ASSERT_EQ(mtx->get_const_row_ptrs(), row_ptrs);
+}
+
+
+TEST_F(Csr, UpdateValuesFailsOnWrongSize)
+{
+    ASSERT_THROW(mtx->update_values(gko::Array<double>{exec, {1.0, 2.0}}),
+                 gko::ValueMismatch);
+}
+
+
+TEST_F(Csr, ComputesValuePositions)
+{
+    gko::matrix_data<> data{gko::dim<2>{2, 3},
+                            {{1, 1, 6.0},
+                             {0, 2, 4.0},
+                             {1, 0, 0.0},
+                             {0, 0, 7.0},
+                             {0, 1, 8.0}}};
+
+    auto positions = mtx->compute_value_positions(data);
+
+    ASSERT_EQ(positions.get_num_elems(), 5);
+    ASSERT_EQ(positions.get_const_data()[0], 3);
+    ASSERT_EQ(positions.get_const_data()[1], 2);
+    ASSERT_EQ(positions.get_const_data()[2], -1);
+    ASSERT_EQ(positions.get_const_data()[3], 0);
+    ASSERT_EQ(positions.get_const_data()[4], 1);
+}
+
+
+TEST_F(Csr, ComputesDistinctValuePositionsForDuplicates)
+{
+    gko::matrix_data<> data{gko::dim<2>{2, 2},
+                            {{0, 1, 1.0}, {0, 1, 2.0}, {1, 0, 3.0}}};
+    auto dup_mtx = Mtx::create(exec);
+    dup_mtx->read(data);
+    gko::matrix_data<> stream{gko::dim<2>{2, 2},
+                              {{1, 0, 3.0},
+                               {0, 1, 2.0},
+                               {0, 1, 1.0},
+                               {0, 1, 5.0}}};
+
+    auto positions = dup_mtx->compute_value_positions(stream);
+
+    ASSERT_EQ(positions.get_num_elems(), 4);
+    ASSERT_EQ(positions.get_const_data()[0], 2);
+    ASSERT_EQ(positions.get_const_data()[1], 0);
+    ASSERT_EQ(positions.get_const_data()[2], 1);
+    ASSERT_EQ(positions.get_const_data()[3], -1);
+}
+
+
+TEST_F(Csr, ComputesValuePositionsInUnsortedRows)
+{
+    auto unsorted = Mtx::create(exec, gko::dim<2>{2, 3},
+                                gko::Array<double>{exec, {1.0, 2.0, 3.0, 4.0}},
+                                gko::Array<gko::int32>{exec, {2, 0, 1, 0}},
+                                gko::Array<gko::int32>{exec, {0, 3, 4}});
+    gko::matrix_data<> stream{
+        gko::dim<2>{2, 3},
+        {{0, 1, 3.0}, {1, 0, 4.0}, {0, 2, 1.0}, {0, 0, 2.0}, {1, 2, 5.0}}};
+
+    auto positions = unsorted->compute_value_positions(stream);
+
+    ASSERT_EQ(positions.get_num_elems(), 5);
+    ASSERT_EQ(positions.get_const_data()[0], 2);
+    ASSERT_EQ(positions.get_const_data()[1], 3);
+    ASSERT_EQ(positions.get_const_data()[2], 0);
+    ASSERT_EQ(positions.get_const_data()[3], 1);
+    ASSERT_EQ(positions.get_const_data()[4], -1);
+}
+
+
+TEST_F(Csr, UpdatesValuesFromPermutedStream)
+{
+    gko::matrix_data<> data{gko::dim<2>{2, 3},
+                            {{1, 1, 6.0},
+                             {0, 2, 4.0},
+                             {1, 0, 0.0},
+                             {0, 0, 7.0},
+                             {0, 1, 8.0}}};
+    auto positions = mtx->compute_value_positions(data);
+
+    mtx->update_values(gko::Array<double>{exec, {6.0, 4.0, 0.0, 7.0, 8.0}},
+                       positions);
+
+    GKO_ASSERT_MTX_NEAR(mtx, l({{7.0, 8.0, 4.0}, {0.0, 6.0, 0.0}}), 0.0);
+}
+
+
+TEST_F(Csr, UpdatesValuesFromPartialStream)
+{
+    mtx->update_values(gko::Array<double>{exec, {9.0, -2.0}},
+                       gko::Array<gko::int32>{exec, {3, 1}});
+
+    GKO_ASSERT_MTX_NEAR(mtx, l({{1.0, -2.0, 2.0}, {0.0, 9.0, 0.0}}), 0.0);
+}
+
+
 TEST_F(Csr, ConvertsToDense)
 {
     auto dense_mtx = gko::matrix::Dense<>::create(mtx->get_executor());
@@ -718,6 +854,44 @@ TEST_F(Csr, CalculatesNonzerosPerRow)
 }
 
 
+TEST_F(Csr, ExtractsDiagonal)
+{
+    gko::Array<Mtx::value_type> diag(exec, 2);
+
+    gko::kernels::reference::csr::extract_diagonal(exec, mtx2.get(), diag);
+
+    auto diag_val = diag.get_const_data();
+    ASSERT_EQ(diag_val[0], 1.0);
+    ASSERT_EQ(diag_val[1], 5.0);
+}
+
+
+TEST_F(Csr, ExtractsMissingDiagonalEntriesAsZero)
+{
+    /*
+     * 0   2
+     * 3   4
+     */
+    auto mtx = Mtx::create(exec, gko::dim<2>{2, 2}, 3);
+    mtx->get_row_ptrs()[0] = 0;
+    mtx->get_row_ptrs()[1] = 1;
+    mtx->get_row_ptrs()[2] = 3;
+    mtx->get_col_idxs()[0] = 1;
+    mtx->get_col_idxs()[1] = 0;
+    mtx->get_col_idxs()[2] = 1;
+    mtx->get_values()[0] = 2.0;
+    mtx->get_values()[1] = 3.0;
+    mtx->get_values()[2] = 4.0;
+    gko::Array<Mtx::value_type> diag(exec, 2);
+
+    gko::kernels::reference::csr::extract_diagonal(exec, mtx.get(), diag);
+
+    auto diag_val = diag.get_const_data();
+    ASSERT_EQ(diag_val[0], 0.0);
+    ASSERT_EQ(diag_val[1], 4.0);
+}
+
+
 TEST_F(Csr, CalculatesTotalCols)
 {
     gko::size_type total_cols;
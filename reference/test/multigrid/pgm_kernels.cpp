@@ -0,0 +1,323 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/multigrid/pgm.hpp>
+
+
+#include <complex>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/multigrid/pgm_kernels.hpp"
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+class Pgm : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Dense = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using MgLevel = gko::multigrid::Pgm<value_type, index_type>;
+
+    Pgm()
+        : ref(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx(gko::initialize<Csr>(
+              {{4., -3., 0., 0., 0.},
+               {-3., 4., -1., 0., 0.},
+               {0., -1., 4., -2., 0.},
+               {0., 0., -2., 4., -1.},
+               {0., 0., 0., -1., 4.}}, ref)),
+          // clang-format on
+          diag(ref, {4., 4., 4., 4., 4.}),
+          unagg(ref, {-1, -1, -1, -1, -1}),
+          strongest(ref, {1, 0, 3, 2, 3}),
+          matched(ref, {0, 0, 2, 2, -1}),
+          assigned(ref, {0, 0, 2, 2, 2}),
+          renumbered(ref, {0, 0, 1, 1, 1}),
+          pgm_factory(MgLevel::build().on(ref))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<Csr> mtx;
+    gko::Array<value_type> diag;
+    gko::Array<index_type> unagg;
+    gko::Array<index_type> strongest;
+    gko::Array<index_type> matched;
+    gko::Array<index_type> assigned;
+    gko::Array<index_type> renumbered;
+    std::unique_ptr<MgLevel::Factory> pgm_factory;
+};
+
+
+TEST_F(Pgm, KernelInitializeAgg)
+{
+    gko::Array<index_type> agg(ref, 5);
+
+    gko::kernels::reference::pgm::initialize_agg(ref, agg);
+
+    GKO_ASSERT_ARRAY_EQ(&agg, &unagg);
+}
+
+
+TEST_F(Pgm, KernelFindStrongestNeighbor)
+{
+    gko::Array<index_type> strongest_neighbor(ref, 5);
+
+    gko::kernels::reference::pgm::find_strongest_neighbor(
+        ref, mtx.get(), diag, unagg, strongest_neighbor);
+
+    GKO_ASSERT_ARRAY_EQ(&strongest_neighbor, &strongest);
+}
+
+
+TEST_F(Pgm, KernelFindStrongestNeighborSkipsAggregated)
+{
+    gko::Array<index_type> strongest_neighbor(ref, 5);
+    gko::Array<index_type> expected(ref, {-1, -1, -1, -1, -1});
+
+    gko::kernels::reference::pgm::find_strongest_neighbor(
+        ref, mtx.get(), diag, matched, strongest_neighbor);
+
+    GKO_ASSERT_ARRAY_EQ(&strongest_neighbor, &expected);
+}
+
+
+TEST_F(Pgm, KernelFindStrongestNeighborMatchesIsolatedRowWithItself)
+{
+    auto isolated = gko::initialize<Csr>(
+        {{2., 0., 0.}, {0., 2., -1.}, {0., -1., 2.}}, ref);
+    gko::Array<value_type> isolated_diag(ref, {2., 2., 2.});
+    gko::Array<index_type> agg(ref, {-1, -1, -1});
+    gko::Array<index_type> strongest_neighbor(ref, 3);
+    gko::Array<index_type> expected(ref, {0, 2, 1});
+
+    gko::kernels::reference::pgm::find_strongest_neighbor(
+        ref, isolated.get(), isolated_diag, agg, strongest_neighbor);
+
+    GKO_ASSERT_ARRAY_EQ(&strongest_neighbor, &expected);
+}
+
+
+TEST_F(Pgm, KernelMatchEdge)
+{
+    gko::kernels::reference::pgm::match_edge(ref, strongest, unagg);
+
+    GKO_ASSERT_ARRAY_EQ(&unagg, &matched);
+}
+
+
+TEST_F(Pgm, KernelCountUnagg)
+{
+    index_type num_unagg{};
+
+    gko::kernels::reference::pgm::count_unagg(ref, matched, &num_unagg);
+
+    ASSERT_EQ(num_unagg, 1);
+}
+
+
+TEST_F(Pgm, KernelAssignToExistAgg)
+{
+    gko::Array<index_type> intermediate_agg(ref, 5);
+
+    gko::kernels::reference::pgm::assign_to_exist_agg(ref, mtx.get(), diag,
+                                                      matched, intermediate_agg);
+
+    GKO_ASSERT_ARRAY_EQ(&matched, &assigned);
+}
+
+
+TEST_F(Pgm, KernelRenumber)
+{
+    index_type num_agg{};
+
+    gko::kernels::reference::pgm::renumber(ref, assigned, &num_agg);
+
+    GKO_ASSERT_ARRAY_EQ(&assigned, &renumbered);
+    ASSERT_EQ(num_agg, 2);
+}
+
+
+TEST_F(Pgm, KernelFillTentativeProlong)
+{
+    auto prolong = Csr::create(ref, gko::dim<2>{5, 2}, 5);
+
+    gko::kernels::reference::pgm::fill_tentative_prolong(ref, renumbered,
+                                                         prolong.get());
+
+    GKO_ASSERT_MTX_NEAR(
+        prolong, l({{1., 0.}, {1., 0.}, {0., 1.}, {0., 1.}, {0., 1.}}), 0.0);
+}
+
+
+TEST_F(Pgm, KernelScaleByInverseDiag)
+{
+    auto scaled = gko::initialize<Csr>({{2., -1.}, {-1., 4.}}, ref);
+    gko::Array<value_type> scaled_diag(ref, {2., 4.});
+    value_type max_row_sum{};
+
+    gko::kernels::reference::pgm::scale_by_inverse_diag(
+        ref, scaled_diag, scaled.get(), &max_row_sum);
+
+    GKO_ASSERT_MTX_NEAR(scaled, l({{1., -0.5}, {-0.25, 1.}}), 0.0);
+    ASSERT_EQ(max_row_sum, 1.5);
+}
+
+
+TEST_F(Pgm, GeneratesAggregates)
+{
+    auto level = pgm_factory->generate(mtx);
+
+    auto agg = static_cast<MgLevel *>(level.get())->get_const_agg();
+    GKO_ASSERT_ARRAY_EQ(&agg, &renumbered);
+}
+
+
+TEST_F(Pgm, GeneratesPiecewiseConstantProlongation)
+{
+    auto level_op = pgm_factory->generate(mtx);
+    auto level = static_cast<MgLevel *>(level_op.get());
+
+    auto prolong = gko::as<Csr>(level->get_prolong_op().get());
+    auto restrict = gko::as<Csr>(level->get_restrict_op().get());
+    GKO_ASSERT_MTX_NEAR(
+        prolong, l({{1., 0.}, {1., 0.}, {0., 1.}, {0., 1.}, {0., 1.}}), 0.0);
+    GKO_ASSERT_MTX_NEAR(restrict,
+                        l({{1., 1., 0., 0., 0.}, {0., 0., 1., 1., 1.}}), 0.0);
+}
+
+
+TEST_F(Pgm, GeneratesGalerkinCoarseOperator)
+{
+    auto level_op = pgm_factory->generate(mtx);
+    auto level = static_cast<MgLevel *>(level_op.get());
+
+    auto coarse = gko::as<Csr>(level->get_coarse_op().get());
+    GKO_ASSERT_MTX_NEAR(coarse, l({{2., -1.}, {-1., 6.}}), 1e-14);
+    ASSERT_TRUE(coarse->is_sorted_by_column_index());
+}
+
+
+TEST_F(Pgm, GeneratesSmoothedProlongation)
+{
+    auto level_op = MgLevel::build()
+                        .with_smoothed_prolongation(true)
+                        .with_prolongation_smoothing_weight(1.0)
+                        .on(ref)
+                        ->generate(mtx);
+    auto level = static_cast<MgLevel *>(level_op.get());
+
+    auto prolong = gko::as<Csr>(level->get_prolong_op().get());
+    // the row sums of D^{-1} A are bounded by 2, so P = (I - 0.5 D^{-1} A) P
+    GKO_ASSERT_MTX_NEAR(prolong,
+                        l({{0.875, 0.},
+                           {0.875, 0.125},
+                           {0.125, 0.75},
+                           {0., 0.875},
+                           {0., 0.625}}),
+                        1e-14);
+}
+
+
+TEST_F(Pgm, GeneratesHermitianCoarseOperatorForComplexSmoothedProlongation)
+{
+    using c_type = std::complex<double>;
+    using ComplexCsr = gko::matrix::Csr<c_type, index_type>;
+    using ComplexMgLevel = gko::multigrid::Pgm<c_type, index_type>;
+    // clang-format off
+    std::shared_ptr<ComplexCsr> hermitian = gko::initialize<ComplexCsr>(
+        {{c_type{4., 0.}, c_type{-3., 1.}, 0., 0., 0.},
+         {c_type{-3., -1.}, c_type{4., 0.}, c_type{-1., 2.}, 0., 0.},
+         {0., c_type{-1., -2.}, c_type{4., 0.}, c_type{-2., 0.}, 0.},
+         {0., 0., c_type{-2., 0.}, c_type{4., 0.}, c_type{-1., -1.}},
+         {0., 0., 0., c_type{-1., 1.}, c_type{4., 0.}}}, ref);
+    // clang-format on
+
+    auto level_op = ComplexMgLevel::build()
+                        .with_smoothed_prolongation(true)
+                        .on(ref)
+                        ->generate(hermitian);
+    auto level = static_cast<ComplexMgLevel *>(level_op.get());
+
+    auto prolong = gko::as<ComplexCsr>(level->get_prolong_op().get());
+    auto restrict = gko::as<ComplexCsr>(level->get_restrict_op().get());
+    auto coarse = gko::as<ComplexCsr>(level->get_coarse_op().get());
+    auto prolong_h = prolong->conj_transpose();
+    auto coarse_h = coarse->conj_transpose();
+    GKO_ASSERT_MTX_NEAR(restrict, gko::as<ComplexCsr>(prolong_h.get()), 0.0);
+    GKO_ASSERT_MTX_NEAR(coarse, gko::as<ComplexCsr>(coarse_h.get()), 1e-14);
+}
+
+
+TEST_F(Pgm, AppliesTwoLevelApproximation)
+{
+    auto level = pgm_factory->generate(mtx);
+    auto b = gko::initialize<Dense>({1., 1., 1., 1., 1.}, ref);
+    auto x = Dense::create(ref, gko::dim<2>{5, 1});
+
+    level->apply(b.get(), x.get());
+
+    // P A_c R b with R b = [2, 3] and A_c R b = [1, 16]
+    GKO_ASSERT_MTX_NEAR(x, l({1., 1., 16., 16., 16.}), 1e-14);
+}
+
+
+TEST_F(Pgm, AppliesTwoLevelApproximationUsingAdvancedApply)
+{
+    auto level = pgm_factory->generate(mtx);
+    auto alpha = gko::initialize<Dense>({2.0}, ref);
+    auto beta = gko::initialize<Dense>({-1.0}, ref);
+    auto b = gko::initialize<Dense>({1., 1., 1., 1., 1.}, ref);
+    auto x = gko::initialize<Dense>({1., 2., 3., 4., 5.}, ref);
+
+    level->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1., 0., 29., 28., 27.}), 1e-14);
+}
+
+
+}  // namespace
@@ -0,0 +1,187 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/ic.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/par_ic.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+class Ic : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using ic_prec_type = gko::preconditioner::Ic<>;
+    using par_ic_type = gko::factorization::ParIc<value_type, index_type>;
+    using composition = gko::Composition<value_type>;
+
+    Ic()
+        : exec(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx(gko::initialize<Csr>({{4., 2., 2.},
+                                    {2., 5., 3.},
+                                    {2., 3., 6.}}, exec)),
+          l_factor(gko::initialize<Csr>({{2., 0., 0.},
+                                         {1., 2., 0.},
+                                         {1., 1., 2.}}, exec)),
+          // clang-format on
+          ic_pre_factory(ic_prec_type::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> l_factor;
+    std::shared_ptr<ic_prec_type::Factory> ic_pre_factory;
+};
+
+
+TEST_F(Ic, GeneratesLFactorFromMatrix)
+{
+    auto ic = ic_pre_factory->generate(mtx);
+
+    GKO_ASSERT_MTX_NEAR(ic->get_l_solver()->get_system_matrix(), l_factor,
+                        1e-14);
+}
+
+
+TEST_F(Ic, UsesFirstFactorOfComposition)
+{
+    std::shared_ptr<composition> l_composition =
+        composition::create(l_factor);
+
+    auto ic = ic_pre_factory->generate(l_composition);
+
+    ASSERT_EQ(ic->get_l_solver()->get_system_matrix(), l_factor);
+}
+
+
+TEST_F(Ic, CanBeGeneratedFromParIc)
+{
+    auto par_ic = par_ic_type::build().on(exec)->generate(mtx);
+
+    auto ic = ic_pre_factory->generate(gko::share(par_ic));
+
+    GKO_ASSERT_MTX_NEAR(ic->get_l_solver()->get_system_matrix(), l_factor,
+                        1e-14);
+}
+
+
+TEST_F(Ic, SolvesSingleRhs)
+{
+    auto b = gko::initialize<Mtx>({14., 21., 26.}, exec);
+    auto x = Mtx::create(exec, gko::dim<2>{3, 1});
+    auto ic = ic_pre_factory->generate(mtx);
+
+    ic->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1., 2., 3.}), 1e-14);
+}
+
+
+TEST_F(Ic, SolvesMultipleRhs)
+{
+    // clang-format off
+    auto b = gko::initialize<Mtx>({{14., 4.},
+                                   {21., 2.},
+                                   {26., 2.}}, exec);
+    // clang-format on
+    auto x = Mtx::create(exec, gko::dim<2>{3, 2});
+    auto ic = ic_pre_factory->generate(mtx);
+
+    ic->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1., 1.}, {2., 0.}, {3., 0.}}), 1e-14);
+}
+
+
+TEST_F(Ic, SolvesAdvancedSingleRhs)
+{
+    auto alpha = gko::initialize<Mtx>({2.}, exec);
+    auto beta = gko::initialize<Mtx>({-1.}, exec);
+    auto b = gko::initialize<Mtx>({14., 21., 26.}, exec);
+    auto x = gko::initialize<Mtx>({1., 1., 1.}, exec);
+    auto ic = ic_pre_factory->generate(mtx);
+
+    ic->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1., 3., 5.}), 1e-14);
+}
+
+
+TEST_F(Ic, UpdatesValues)
+{
+    // clang-format off
+    auto scaled = gko::share(gko::initialize<Csr>({{16., 8., 8.},
+                                                   {8., 20., 12.},
+                                                   {8., 12., 24.}}, exec));
+    // clang-format on
+    auto b = gko::initialize<Mtx>({14., 21., 26.}, exec);
+    auto x = Mtx::create(exec, gko::dim<2>{3, 1});
+    auto ic = ic_pre_factory->generate(scaled);
+    auto l_solver = ic->get_l_solver();
+
+    ic->update_values(mtx);
+    ic->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1., 2., 3.}), 1e-14);
+    ASSERT_EQ(ic->get_l_solver(), l_solver);
+}
+
+
+TEST_F(Ic, UpdateValuesThrowsForComposition)
+{
+    auto ic = ic_pre_factory->generate(composition::create(l_factor));
+
+    ASSERT_THROW(ic->update_values(mtx), gko::NotSupported);
+}
+
+
+}  // namespace
@@ -426,4 +426,32 @@ TEST_F(Ilu, CanBeUsedAsGeneratedPreconditioner)
 }
 
 
+TEST_F(Ilu, UpdatesValues)
+{
+    auto scaled = gko::share(gko::clone(exec, mtx));
+    scaled->scale(gko::initialize<Mtx>({2.0}, exec).get());
+    auto preconditioner =
+        default_ilu_prec_type::build().on(exec)->generate(scaled);
+    auto l_solver = preconditioner->get_l_solver();
+    auto u_solver = preconditioner->get_u_solver();
+    const auto b = gko::initialize<Mtx>({1.0, 3.0, 6.0}, exec);
+    auto x = Mtx::create(exec, gko::dim<2>{3, 1});
+
+    preconditioner->update_values(mtx);
+    preconditioner->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x.get(), l({-0.125, 0.25, 1.0}), 1e-14);
+    ASSERT_EQ(preconditioner->get_l_solver(), l_solver);
+    ASSERT_EQ(preconditioner->get_u_solver(), u_solver);
+}
+
+
+TEST_F(Ilu, UpdateValuesThrowsForComposition)
+{
+    auto preconditioner = ilu_pre_factory->generate(l_u_composition);
+
+    ASSERT_THROW(preconditioner->update_values(mtx), gko::NotSupported);
+}
+
+
 }  // namespace
@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <limits>
 
 
 #include <gtest/gtest.h>
@@ -653,4 +654,180 @@ TEST_F(Jacobi, ConvertsToDenseWithAdaptivePrecision)
 }
 
 
+TEST_F(Jacobi, GeneratesScalarJacobi)
+{
+    auto bj = Bj::build().with_max_block_size(1u).on(exec)->generate(mtx);
+
+    ASSERT_EQ(bj->get_num_blocks(), 5);
+    ASSERT_EQ(bj->get_num_stored_elements(), 5);
+    auto diag = bj->get_blocks();
+    EXPECT_EQ(diag[0], 0.25);
+    EXPECT_EQ(diag[1], 0.25);
+    EXPECT_EQ(diag[2], 0.25);
+    EXPECT_EQ(diag[3], 0.25);
+    EXPECT_EQ(diag[4], 0.25);
+    auto ptrs = bj->get_parameters().block_pointers.get_const_data();
+    for (int i = 0; i <= 5; ++i) {
+        EXPECT_EQ(ptrs[i], i);
+    }
+}
+
+
+TEST_F(Jacobi, ScalarJacobiKeepsZeroDiagonalEntries)
+{
+    auto mtx = gko::share(gko::initialize<Mtx>({{2.0, 1.0}, {1.0, 0.0}}, exec));
+
+    auto bj = Bj::build().with_max_block_size(1u).on(exec)->generate(mtx);
+
+    auto diag = bj->get_blocks();
+    EXPECT_EQ(diag[0], 0.5);
+    EXPECT_EQ(diag[1], 0.0);
+}
+
+
+TEST_F(Jacobi, AppliesScalarJacobiToMultipleVectors)
+{
+    auto x = gko::initialize<Vec>(
+        3, {{1.0, 0.5}, {-1.0, -0.5}, {2.0, 1.0}, {-2.0, -1.0}, {3.0, 1.5}},
+        exec);
+    auto b = gko::initialize<Vec>(
+        3, {{4.0, -2.0}, {-1.0, 4.0}, {-2.0, 0.0}, {4.0, -2.0}, {-1.0, 4.0}},
+        exec);
+    auto bj = Bj::build().with_max_block_size(1u).on(exec)->generate(mtx);
+
+    bj->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({{1.0, -0.5},
+                           {-0.25, 1.0},
+                           {-0.5, 0.0},
+                           {1.0, -0.5},
+                           {-0.25, 1.0}}),
+                        1e-14);
+}
+
+
+TEST_F(Jacobi, AppliesScalarJacobiLinearCombinationToVector)
+{
+    auto x = gko::initialize<Vec>({1.0, -1.0, 2.0, -2.0, 3.0}, exec);
+    auto b = gko::initialize<Vec>({4.0, -1.0, -2.0, 4.0, -1.0}, exec);
+    auto alpha = gko::initialize<Vec>({2.0}, exec);
+    auto beta = gko::initialize<Vec>({-1.0}, exec);
+    auto bj = Bj::build().with_max_block_size(1u).on(exec)->generate(mtx);
+
+    bj->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 0.5, -3.0, 4.0, -3.5}), 1e-14);
+}
+
+
+TEST_F(Jacobi, AppliesScalarJacobiLinearCombinationWithZeroBeta)
+{
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    auto x = gko::initialize<Vec>({nan, nan, nan, nan, nan}, exec);
+    auto b = gko::initialize<Vec>({4.0, -1.0, -2.0, 4.0, -1.0}, exec);
+    auto alpha = gko::initialize<Vec>({2.0}, exec);
+    auto beta = gko::initialize<Vec>({0.0}, exec);
+    auto bj = Bj::build().with_max_block_size(1u).on(exec)->generate(mtx);
+
+    bj->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({2.0, -0.5, -1.0, 2.0, -0.5}), 1e-14);
+}
+
+
+TEST_F(Jacobi, ConvertsScalarJacobiToDense)
+{
+    auto dense = gko::matrix::Dense<>::create(exec);
+
+    dense->copy_from(
+        Bj::build().with_max_block_size(1u).on(exec)->generate(mtx));
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(dense,
+        l({{0.25, 0.0,  0.0,  0.0,  0.0},
+           {0.0,  0.25, 0.0,  0.0,  0.0},
+           {0.0,  0.0,  0.25, 0.0,  0.0},
+           {0.0,  0.0,  0.0,  0.25, 0.0},
+           {0.0,  0.0,  0.0,  0.0,  0.25}}), 1e-14);
+    // clang-format on
+}
+
+
+TEST_F(Jacobi, UpdatesValues)
+{
+    auto bj = bj_factory->generate(mtx);
+    for (gko::size_type i = 0; i < mtx->get_num_stored_elements(); ++i) {
+        mtx->get_values()[i] *= 2.0;
+    }
+
+    bj->update_values(mtx.get());
+
+    auto dense = gko::matrix::Dense<>::create(exec);
+    dense->copy_from(bj.get());
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(dense,
+        l({{4.0 / 28, 2.0 / 28,       0.0,       0.0,       0.0},
+           {1.0 / 28, 4.0 / 28,       0.0,       0.0,       0.0},
+           {     0.0,      0.0, 14.0 / 96,  8.0 / 96,  4.0 / 96},
+           {     0.0,      0.0,  4.0 / 96, 16.0 / 96,  8.0 / 96},
+           {     0.0,      0.0,  1.0 / 96,  4.0 / 96, 14.0 / 96}}), 1e-14);
+    // clang-format on
+}
+
+
+TEST_F(Jacobi, UpdatesValuesWithAdaptivePrecision)
+{
+    auto factory =
+        Bj::build()
+            .with_max_block_size(17u)
+            .with_block_pointers(block_pointers)
+            .with_storage_optimization(gko::precision_reduction::autodetect())
+            .with_accuracy(1.5e-3)
+            .on(exec);
+    auto bj = factory->generate(mtx);
+    // increases the condition number of the first block
+    mtx->get_values()[1] = -3.9;
+
+    bj->update_values(mtx.get());
+
+    auto expected = factory->generate(mtx);
+    auto prec =
+        bj->get_parameters().storage_optimization.block_wise.get_const_data();
+    EXPECT_EQ(prec[0], gko::precision_reduction(0, 1));
+    ASSERT_EQ(prec[1], gko::precision_reduction(0, 1));
+    auto dense = gko::matrix::Dense<>::create(exec);
+    auto expected_dense = gko::matrix::Dense<>::create(exec);
+    dense->copy_from(bj.get());
+    expected_dense->copy_from(expected.get());
+    GKO_ASSERT_MTX_NEAR(dense, expected_dense, 0.0);
+}
+
+
+TEST_F(Jacobi, UpdatesScalarJacobiValues)
+{
+    auto bj = Bj::build().with_max_block_size(1u).on(exec)->generate(mtx);
+    mtx->get_values()[0] = 2.0;
+    mtx->get_values()[12] = -8.0;
+
+    bj->update_values(mtx.get());
+
+    auto diag = bj->get_blocks();
+    EXPECT_EQ(diag[0], 0.5);
+    EXPECT_EQ(diag[1], 0.25);
+    EXPECT_EQ(diag[2], 0.25);
+    EXPECT_EQ(diag[3], 0.25);
+    EXPECT_EQ(diag[4], -0.125);
+}
+
+
+TEST_F(Jacobi, UpdateValuesFailsOnWrongDimensions)
+{
+    auto bj = bj_factory->generate(mtx);
+    auto small = gko::initialize<Mtx>({{2.0, 1.0}, {1.0, 2.0}}, exec);
+
+    ASSERT_THROW(bj->update_values(small.get()), gko::DimensionMismatch);
+}
+
+
 }  // namespace
@@ -246,4 +246,68 @@ TEST_F(Cg, SolvesMultipleDenseSystemForDivergenceCheck)
 }
 
 
+TEST_F(Cg, ReusesPooledMemoryAcrossApplies)
+{
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>();
+    auto pooled_exec = gko::ReferenceExecutor::create(alloc);
+    auto solver = cg_factory->get_parameters().on(pooled_exec)->generate(
+        gko::clone(pooled_exec, mtx));
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, pooled_exec);
+    auto x1 = gko::initialize<Mtx>({0.0, 0.0, 0.0}, pooled_exec);
+    auto x2 = gko::initialize<Mtx>({0.0, 0.0, 0.0}, pooled_exec);
+    solver->apply(b.get(), x1.get());
+    auto num_misses = alloc->get_num_misses();
+    auto num_hits = alloc->get_num_hits();
+
+    solver->apply(b.get(), x2.get());
+
+    ASSERT_EQ(alloc->get_num_misses(), num_misses);
+    ASSERT_GT(alloc->get_num_hits(), num_hits);
+    GKO_ASSERT_MTX_NEAR(x2, l({1.0, 3.0, 2.0}), 1e-14);
+}
+
+
+TEST_F(Cg, SolvesSystemsOfDifferentShapesWithSameSolver)
+{
+    auto solver = cg_factory->generate(mtx);
+    auto b1 = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, exec);
+    auto x1 = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    auto b2 = gko::initialize<Mtx>({{-1.0, 1.0}, {3.0, 0.0}, {1.0, 1.0}}, exec);
+    auto x2 = gko::initialize<Mtx>({{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}, exec);
+    auto x3 = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b1.get(), x1.get());
+    solver->apply(b2.get(), x2.get());
+    solver->apply(b1.get(), x3.get());
+
+    GKO_ASSERT_MTX_NEAR(x1, l({1.0, 3.0, 2.0}), 1e-14);
+    GKO_ASSERT_MTX_NEAR(x2, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}), 1e-14);
+    GKO_ASSERT_MTX_NEAR(x3, l({1.0, 3.0, 2.0}), 1e-14);
+}
+
+
+TEST_F(Cg, DoesNotAllocateWorkspaceInRepeatedApplies)
+{
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>();
+    auto pooled_exec = gko::ReferenceExecutor::create(alloc);
+    auto solver = cg_factory->get_parameters().on(pooled_exec)->generate(
+        gko::clone(pooled_exec, mtx));
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, pooled_exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, pooled_exec);
+    solver->apply(b.get(), x.get());
+    auto num_allocations = alloc->get_num_hits() + alloc->get_num_misses();
+    solver->apply(b.get(), x.get());
+    auto num_repeated_allocations =
+        alloc->get_num_hits() + alloc->get_num_misses() - num_allocations;
+
+    solver->release_workspace();
+    solver->apply(b.get(), x.get());
+
+    auto num_released_allocations = alloc->get_num_hits() +
+                                    alloc->get_num_misses() - num_allocations -
+                                    num_repeated_allocations;
+    ASSERT_LT(num_repeated_allocations, num_released_allocations);
+}
+
+
 }  // namespace
@@ -278,6 +278,179 @@ TEST_F(Gmres, SolvesBigDenseSystem1WithRestart)
 }
 
 
+TEST_F(Gmres, SolvesBigDenseSystem1WithCgs)
+{
+    auto solver =
+        gko::solver::Gmres<>::build()
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .on(exec)
+            ->generate(mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}), 1e-10);
+}
+
+
+TEST_F(Gmres, SolvesBigDenseSystem1WithCgs2)
+{
+    auto solver =
+        gko::solver::Gmres<>::build()
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .on(exec)
+            ->generate(mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}), 1e-10);
+}
+
+
+TEST_F(Gmres, SolvesBigDenseSystem1WithRestartAndCgs2)
+{
+    auto gmres_factory_restart =
+        gko::solver::Gmres<>::build()
+            .with_krylov_dim(4u)
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .on(exec);
+    auto solver = gmres_factory_restart->generate(mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}), 1e-5);
+}
+
+
+TEST_F(Gmres, SolvesStencilSystemWithReducedStorage)
+{
+    auto solver = gko::solver::Gmres<>::build()
+                      .with_storage_precision(gko::precision_reduction(0, 1))
+                      .with_criteria(gko::stop::Iteration::build()
+                                         .with_max_iters(4u)
+                                         .on(exec))
+                      .on(exec)
+                      ->generate(mtx);
+    auto b = gko::initialize<Mtx>({13.0, 7.0, 1.0}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), 1e-6);
+}
+
+
+TEST_F(Gmres, SolvesMultipleStencilSystemsWithReducedStorage)
+{
+    auto solver = gko::solver::Gmres<>::build()
+                      .with_storage_precision(gko::precision_reduction(0, 1))
+                      .with_criteria(gko::stop::Iteration::build()
+                                         .with_max_iters(4u)
+                                         .on(exec))
+                      .on(exec)
+                      ->generate(mtx);
+    auto b = gko::initialize<Mtx>({{13.0, 6.0}, {7.0, 4.0}, {1.0, 1.0}}, exec);
+    auto x = gko::initialize<Mtx>({{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}), 1e-6);
+}
+
+
+TEST_F(Gmres, SolvesBigDenseSystem1WithRestartAndFloatStorage)
+{
+    auto solver =
+        gko::solver::Gmres<>::build()
+            .with_krylov_dim(4u)
+            .with_storage_precision(gko::precision_reduction(0, 1))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .on(exec)
+            ->generate(mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}), 1e-5);
+}
+
+
+TEST_F(Gmres, SolvesBigDenseSystem1WithRestartAndHalfStorage)
+{
+    auto solver =
+        gko::solver::Gmres<>::build()
+            .with_krylov_dim(4u)
+            .with_storage_precision(gko::precision_reduction(0, 2))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(400u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .on(exec)
+            ->generate(mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}), 1e-5);
+}
+
+
+TEST_F(Gmres, SolvesBigDenseSystem1WithRestartAndTruncatedStorage)
+{
+    auto solver =
+        gko::solver::Gmres<>::build()
+            .with_krylov_dim(4u)
+            .with_storage_precision(gko::precision_reduction(1, 0))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .on(exec)
+            ->generate(mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}), 1e-5);
+}
+
+
 TEST_F(Gmres, SolvesWithPreconditioner)
 {
     auto gmres_factory_preconditioner =
@@ -303,4 +476,65 @@ TEST_F(Gmres, SolvesWithPreconditioner)
 }
 
 
+TEST_F(Gmres, SolvesWithPreconditionerAndReducedStorage)
+{
+    auto solver =
+        gko::solver::Gmres<>::build()
+            .with_krylov_dim(6u)
+            .with_storage_precision(gko::precision_reduction(0, 1))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(exec),
+                gko::stop::ResidualNormReduction<>::build()
+                    .with_reduction_factor(1e-15)
+                    .on(exec))
+            .with_preconditioner(gko::preconditioner::Jacobi<>::build()
+                                     .with_max_block_size(3u)
+                                     .on(exec))
+            .on(exec)
+            ->generate(mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {175352.10, 313410.50, 131114.10, -134116.30, 179529.30, -43564.90},
+        exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({33.0, -56.0, 81.0, -30.0, 21.0, 40.0}), 1e-10);
+}
+
+
+TEST_F(Gmres, SolvesSystemsOfDifferentShapesWithSameSolver)
+{
+    auto solver = gmres_factory->generate(mtx);
+    auto b1 = gko::initialize<Mtx>({13.0, 7.0, 1.0}, exec);
+    auto x1 = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    auto b2 = gko::initialize<Mtx>({{13.0, 6.0}, {7.0, 4.0}, {1.0, 1.0}}, exec);
+    auto x2 = gko::initialize<Mtx>({{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}, exec);
+    auto x3 = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b1.get(), x1.get());
+    solver->apply(b2.get(), x2.get());
+    solver->apply(b1.get(), x3.get());
+
+    GKO_ASSERT_MTX_NEAR(x1, l({1.0, 3.0, 2.0}), 1e-14);
+    GKO_ASSERT_MTX_NEAR(x2, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}), 1e-14);
+    GKO_ASSERT_MTX_NEAR(x3, l({1.0, 3.0, 2.0}), 1e-14);
+}
+
+
+TEST_F(Gmres, SolvesStencilSystemAfterReleasingWorkspace)
+{
+    auto solver = gmres_factory->generate(mtx);
+    auto b = gko::initialize<Mtx>({13.0, 7.0, 1.0}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    solver->apply(b.get(), x.get());
+    x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+
+    solver->release_workspace();
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), 1e-14);
+}
+
+
 }  // namespace
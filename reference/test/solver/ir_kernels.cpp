@@ -86,6 +86,24 @@ TEST_F(Ir, SolvesTriangularSystem)
 }
 
 
+TEST_F(Ir, AppliesRelaxationFactor)
+{
+    auto solver =
+        gko::solver::Ir<>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(1u).on(exec))
+            .with_relaxation_factor(0.5)
+            .on(exec)
+            ->generate(mtx);
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.95, 4.5, 1.1}), 1e-14);
+}
+
+
 TEST_F(Ir, SolvesMultipleTriangularSystems)
 {
     auto solver = ir_factory->generate(mtx);
@@ -126,4 +144,28 @@ TEST_F(Ir, SolvesMultipleStencilSystemsUsingAdvancedApply)
 }
 
 
+TEST_F(Ir, DoesNotAllocateWorkspaceInRepeatedApplies)
+{
+    auto alloc = std::make_shared<gko::PooledCpuAllocator>();
+    auto pooled_exec = gko::ReferenceExecutor::create(alloc);
+    auto solver = ir_factory->get_parameters().on(pooled_exec)->generate(
+        gko::clone(pooled_exec, mtx));
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, pooled_exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, pooled_exec);
+    solver->apply(b.get(), x.get());
+    auto num_allocations = alloc->get_num_hits() + alloc->get_num_misses();
+    solver->apply(b.get(), x.get());
+    auto num_repeated_allocations =
+        alloc->get_num_hits() + alloc->get_num_misses() - num_allocations;
+
+    solver->release_workspace();
+    solver->apply(b.get(), x.get());
+
+    auto num_released_allocations = alloc->get_num_hits() +
+                                    alloc->get_num_misses() - num_allocations -
+                                    num_repeated_allocations;
+    ASSERT_LT(num_repeated_allocations, num_released_allocations);
+}
+
+
 }  // namespace
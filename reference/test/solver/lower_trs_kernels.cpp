@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/record.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/combined.hpp>
@@ -137,6 +138,67 @@ TEST_F(LowerTrs, SolvesNonUnitTriangularSystem)
     GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, -1.0}), 1e-14);
 }
 
+TEST_F(LowerTrs, SolvesConjTransposedTriangularSystem)
+{
+    std::shared_ptr<Mtx> b = gko::initialize<Mtx>({1.0, 1.0, 8.0}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    auto solver = lower_trs_factory->generate(mtx2);
+
+    solver->apply_conj_transposed(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, -1.0, 2.0}), 1e-14);
+}
+
+
+TEST_F(LowerTrs, SolvesMultipleConjTransposedTriangularSystems)
+{
+    std::shared_ptr<Mtx> b =
+        gko::initialize<Mtx>({{1.0, 2.0}, {1.0, 0.0}, {8.0, 0.0}}, exec);
+    auto x = gko::initialize<Mtx>({{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}, exec);
+    auto solver = lower_trs_factory_mrhs->generate(mtx2);
+
+    solver->apply_conj_transposed(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {-1.0, 0.0}, {2.0, 0.0}}), 1e-14);
+}
+
+
+TEST_F(LowerTrs, SolvesConjTransposedSystemWithUnsortedRows)
+{
+    using Csr = gko::matrix::Csr<>;
+    // mtx2 with the diagonal entry stored first in each row
+    auto csr = gko::share(Csr::create(
+        exec, gko::dim<2>{3},
+        gko::Array<double>{exec, {2.0, 3.0, 3.0, 4.0, 1.0, 2.0}},
+        gko::Array<gko::int32>{exec, {0, 1, 0, 2, 0, 1}},
+        gko::Array<gko::int32>{exec, {0, 1, 3, 6}}));
+    std::shared_ptr<Mtx> b = gko::initialize<Mtx>({1.0, 1.0, 8.0}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    auto solver = lower_trs_factory->generate(csr);
+
+    solver->apply_conj_transposed(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, -1.0, 2.0}), 1e-14);
+}
+
+
+TEST_F(LowerTrs, LogsConjTransposedApply)
+{
+    std::shared_ptr<Mtx> b = gko::initialize<Mtx>({1.0, 1.0, 8.0}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    auto solver = lower_trs_factory->generate(mtx2);
+    std::shared_ptr<gko::log::Record> logger = gko::log::Record::create(
+        exec, gko::log::Logger::linop_apply_started_mask |
+                  gko::log::Logger::linop_apply_completed_mask);
+    solver->add_logger(logger);
+
+    solver->apply_conj_transposed(b.get(), x.get());
+
+    ASSERT_EQ(logger->get().linop_apply_started.size(), 1);
+    ASSERT_EQ(logger->get().linop_apply_completed.size(), 1);
+}
+
+
 TEST_F(LowerTrs, SolvesTriangularSystemUsingAdvancedApply)
 {
     auto alpha = gko::initialize<Mtx>({2.0}, exec);
@@ -0,0 +1,299 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2019, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/multigrid.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/log/compact_record.hpp>
+#include <ginkgo/core/log/convergence.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm_reduction.hpp>
+
+
+#include "core/solver/multigrid_kernels.hpp"
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+class Multigrid : public ::testing::Test {
+protected:
+    using value_type = gko::default_precision;
+    using index_type = gko::int32;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::Multigrid<value_type>;
+
+    Multigrid()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(generate_poisson(grid_size)),
+          b(Vec::create(exec, gko::dim<2>{num_rows, 1})),
+          x(Vec::create(exec, gko::dim<2>{num_rows, 1})),
+          expected(Vec::create(exec, gko::dim<2>{num_rows, 1}))
+    {
+        for (gko::size_type row = 0; row < num_rows; ++row) {
+            expected->at(row, 0) = static_cast<value_type>(row % 7) - 3.0;
+            x->at(row, 0) = 0.0;
+        }
+        mtx->apply(expected.get(), b.get());
+    }
+
+    // 5-point stencil on a grid_size x grid_size grid
+    std::shared_ptr<Mtx> generate_poisson(index_type size)
+    {
+        gko::matrix_data<value_type, index_type> data{
+            gko::dim<2>(size * size, size * size)};
+        for (index_type i = 0; i < size; ++i) {
+            for (index_type j = 0; j < size; ++j) {
+                const auto row = i * size + j;
+                if (i > 0) {
+                    data.nonzeros.emplace_back(row, row - size, -1.0);
+                }
+                if (j > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (j < size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (i < size - 1) {
+                    data.nonzeros.emplace_back(row, row + size, -1.0);
+                }
+            }
+        }
+        auto poisson = gko::share(Mtx::create(exec));
+        poisson->read(data);
+        return poisson;
+    }
+
+    std::unique_ptr<Solver::Factory> build_solver(
+        gko::solver::multigrid_cycle cycle, bool smoothed)
+    {
+        return Solver::build()
+            .with_mg_level(gko::multigrid::Pgm<value_type, index_type>::build()
+                               .with_smoothed_prolongation(smoothed)
+                               .on(exec))
+            .with_min_coarse_rows(4u)
+            .with_cycle(cycle)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(1e-12)
+                    .on(exec))
+            .on(exec);
+    }
+
+    static constexpr index_type grid_size{16};
+    static constexpr gko::size_type num_rows{grid_size * grid_size};
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> expected;
+};
+
+constexpr gko::size_type Multigrid::num_rows;
+
+
+TEST_F(Multigrid, KernelFillZero)
+{
+    gko::kernels::reference::multigrid::fill_zero(exec, expected.get());
+
+    for (gko::size_type row = 0; row < num_rows; ++row) {
+        ASSERT_EQ(expected->at(row, 0), 0.0);
+    }
+}
+
+
+TEST_F(Multigrid, SolvesPoissonWithVCycle)
+{
+    auto solver = build_solver(gko::solver::multigrid_cycle::v, false)
+                      ->generate(mtx);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 1e-8);
+}
+
+
+TEST_F(Multigrid, SolvesPoissonWithWCycle)
+{
+    auto solver = build_solver(gko::solver::multigrid_cycle::w, false)
+                      ->generate(mtx);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 1e-8);
+}
+
+
+TEST_F(Multigrid, SolvesPoissonWithSmoothedAggregation)
+{
+    auto solver = build_solver(gko::solver::multigrid_cycle::v, true)
+                      ->generate(mtx);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 1e-8);
+}
+
+
+TEST_F(Multigrid, SolvesMultiplePoissonSystems)
+{
+    auto solver = build_solver(gko::solver::multigrid_cycle::v, false)
+                      ->generate(mtx);
+    auto multi_b = Vec::create(exec, gko::dim<2>{num_rows, 2});
+    auto multi_x = Vec::create(exec, gko::dim<2>{num_rows, 2});
+    auto multi_expected = Vec::create(exec, gko::dim<2>{num_rows, 2});
+    for (gko::size_type row = 0; row < num_rows; ++row) {
+        multi_b->at(row, 0) = b->at(row, 0);
+        multi_b->at(row, 1) = 2.0 * b->at(row, 0);
+        multi_x->at(row, 0) = 0.0;
+        multi_x->at(row, 1) = 0.0;
+        multi_expected->at(row, 0) = expected->at(row, 0);
+        multi_expected->at(row, 1) = 2.0 * expected->at(row, 0);
+    }
+
+    solver->apply(multi_b.get(), multi_x.get());
+
+    GKO_ASSERT_MTX_NEAR(multi_x, multi_expected, 1e-8);
+}
+
+
+TEST_F(Multigrid, SolvesPoissonUsingAdvancedApply)
+{
+    auto solver = build_solver(gko::solver::multigrid_cycle::v, false)
+                      ->generate(mtx);
+    auto alpha = gko::initialize<Vec>({2.0}, exec);
+    auto beta = gko::initialize<Vec>({-1.0}, exec);
+    auto result = expected->clone();
+    for (gko::size_type row = 0; row < num_rows; ++row) {
+        x->at(row, 0) = 1.0;
+        result->at(row, 0) = 2.0 * expected->at(row, 0) - 1.0;
+    }
+
+    solver->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, result, 1e-8);
+}
+
+
+TEST_F(Multigrid, ReusesResidualInRepeatedApplies)
+{
+    auto solver = build_solver(gko::solver::multigrid_cycle::v, false)
+                      ->generate(mtx);
+    auto logger = gko::share(gko::log::CompactRecord::create(
+        exec, gko::log::Logger::iteration_complete_mask));
+    solver->add_logger(logger);
+    auto x2 = x->clone();
+    solver->apply(b.get(), x.get());
+    const auto residual = logger->get_event(0).input;
+    logger->clear();
+
+    solver->apply(b.get(), x2.get());
+
+    ASSERT_EQ(logger->get_event(0).input, residual);
+    GKO_ASSERT_MTX_NEAR(x2, expected, 1e-8);
+}
+
+
+TEST_F(Multigrid, PreconditionerIgnoresInitialGuess)
+{
+    auto precond =
+        Solver::build().with_min_coarse_rows(4u).on(exec)->generate(mtx);
+    auto other_x = x->clone();
+    for (gko::size_type row = 0; row < num_rows; ++row) {
+        other_x->at(row, 0) = 5.0;
+    }
+
+    precond->apply(b.get(), x.get());
+    precond->apply(b.get(), other_x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, other_x, 0.0);
+}
+
+
+TEST_F(Multigrid, AcceleratesCg)
+{
+    auto logger = gko::share(gko::log::Convergence<value_type>::create(exec));
+    auto plain_logger =
+        gko::share(gko::log::Convergence<value_type>::create(exec));
+    auto build_criterion = [&](std::shared_ptr<const gko::log::Logger> log) {
+        auto criterion =
+            gko::stop::ResidualNormReduction<value_type>::build()
+                .with_reduction_factor(1e-10)
+                .on(exec);
+        criterion->add_logger(log);
+        return gko::share(std::move(criterion));
+    };
+    auto plain_x = x->clone();
+    auto pcg = gko::solver::Cg<value_type>::build()
+                   .with_criteria(gko::stop::Iteration::build()
+                                      .with_max_iters(num_rows)
+                                      .on(exec),
+                                  build_criterion(logger))
+                   .with_preconditioner(
+                       Solver::build().with_min_coarse_rows(4u).on(exec))
+                   .on(exec)
+                   ->generate(mtx);
+    auto cg = gko::solver::Cg<value_type>::build()
+                  .with_criteria(gko::stop::Iteration::build()
+                                     .with_max_iters(num_rows)
+                                     .on(exec),
+                                 build_criterion(plain_logger))
+                  .on(exec)
+                  ->generate(mtx);
+
+    pcg->apply(b.get(), x.get());
+    cg->apply(b.get(), plain_x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 1e-8);
+    ASSERT_LT(2 * logger->get_num_iterations(),
+              plain_logger->get_num_iterations());
+}
+
+
+}  // namespace